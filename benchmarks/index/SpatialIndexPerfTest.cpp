@@ -35,6 +35,18 @@ using geos::index::strtree::ItemBoundable;
 
 using TemplateIntervalTree = TemplateSTRtree<const Interval*, geos::index::strtree::IntervalTraits>;
 
+struct HilbertPackedTree : public TemplateSTRtree<const Envelope*> {
+    HilbertPackedTree() {
+        setHilbertPacking(true);
+    }
+};
+
+struct FlatBoundsTree : public TemplateSTRtree<const Envelope*> {
+    FlatBoundsTree() {
+        setFlatBounds(true);
+    }
+};
+
 //////////////////////////
 // Test Data Generation //
 //////////////////////////
@@ -344,15 +356,19 @@ BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, Quadtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, STRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, SimpleSTRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, TemplateSTRtree<const Envelope*>);
+BENCHMARK_TEMPLATE(BM_STRtree2DConstruct, HilbertPackedTree);
 
 BENCHMARK_TEMPLATE(BM_STRtree2DNearest, STRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DNearest, SimpleSTRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DNearest, TemplateSTRtree<const Envelope*>);
+BENCHMARK_TEMPLATE(BM_STRtree2DNearest, HilbertPackedTree);
 
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, Quadtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, STRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, SimpleSTRtree);
 BENCHMARK_TEMPLATE(BM_STRtree2DQuery, TemplateSTRtree<const Envelope*>);
+BENCHMARK_TEMPLATE(BM_STRtree2DQuery, HilbertPackedTree);
+BENCHMARK_TEMPLATE(BM_STRtree2DQuery, FlatBoundsTree);
 
 BENCHMARK(BM_STRtree2DQueryPairs);
 BENCHMARK(BM_STRtree2DQueryPairsNaive);
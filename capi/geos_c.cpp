@@ -18,6 +18,7 @@
 #include <geos/algorithm/CurveToLineParams.h>
 #include <geos/algorithm/LineToCurveParams.h>
 #include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/index/strtree/DynamicSTRtree.h>
 #include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKBReader.h>
@@ -25,8 +26,11 @@
 #include <geos/io/WKBWriter.h>
 #include <geos/io/GeoJSONReader.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
 #include <geos/operation/buffer/BufferParameters.h>
 #include <geos/operation/cluster/Clusters.h>
+#include <geos/operation/overlayng/OverlayContext.h>
 #include <geos/util/Interrupt.h>
 
 #include <stdexcept>
@@ -48,13 +52,17 @@
 #define GEOSCurveToLineParams geos::algorithm::CurveToLineParams
 #define GEOSBufferParams geos::operation::buffer::BufferParameters
 #define GEOSLineToCurveParams geos::algorithm::LineToCurveParams
+#define GEOSOverlayContext geos::operation::overlayng::OverlayContext
 #define GEOSSTRtree geos::index::strtree::TemplateSTRtree<void*>
+#define GEOSDynamicSTRtree geos::index::strtree::DynamicSTRtree<void*>
 #define GEOSWKTReader geos::io::WKTReader
 #define GEOSWKTWriter geos::io::WKTWriter
 #define GEOSWKBReader geos::io::WKBReader
 #define GEOSWKBWriter geos::io::WKBWriter
 #define GEOSGeoJSONReader geos::io::GeoJSONReader
 #define GEOSGeoJSONWriter geos::io::GeoJSONWriter
+#define GEOSGeoJSONStreamReader geos::io::GeoJSONStreamReader
+#define GEOSGeoJSONStreamWriter geos::io::GeoJSONStreamWriter
 
 // Implementation struct for the GEOSCoverageCleanParams object
 typedef struct {
@@ -340,6 +348,13 @@ extern "C" {
         return GEOSisValidDetail_r(handle, g, flags, reason, location);
     }
 
+    int
+    GEOSisValidBatch(const Geometry* const* geoms, std::size_t n, int flags,
+                     unsigned char* result)
+    {
+        return GEOSisValidBatch_r(handle, geoms, n, flags, result);
+    }
+
 //-----------------------------------------------------------------
 // general purpose
 //-----------------------------------------------------------------
@@ -416,6 +431,12 @@ extern "C" {
         return GEOSFrechetDistanceDensify_r(handle, g1, g2, densifyFrac, dist);
     }
 
+    char
+    GEOSFrechetDistanceWithin(const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return GEOSFrechetDistanceWithin_r(handle, g1, g2, dist);
+    }
+
     int
     GEOSArea(const Geometry* g, double* area)
     {
@@ -759,6 +780,42 @@ extern "C" {
         return GEOSUnionPrec_r(handle, g1, g2, gridSize);
     }
 
+    GEOSOverlayContext*
+    GEOSOverlayContext_create()
+    {
+        return GEOSOverlayContext_create_r(handle);
+    }
+
+    void
+    GEOSOverlayContext_destroy(GEOSOverlayContext* context)
+    {
+        GEOSOverlayContext_destroy_r(handle, context);
+    }
+
+    Geometry*
+    GEOSOverlayContext_intersection(GEOSOverlayContext* context, const Geometry* g1, const Geometry* g2)
+    {
+        return GEOSOverlayContext_intersection_r(handle, context, g1, g2);
+    }
+
+    Geometry*
+    GEOSOverlayContext_difference(GEOSOverlayContext* context, const Geometry* g1, const Geometry* g2)
+    {
+        return GEOSOverlayContext_difference_r(handle, context, g1, g2);
+    }
+
+    Geometry*
+    GEOSOverlayContext_symDifference(GEOSOverlayContext* context, const Geometry* g1, const Geometry* g2)
+    {
+        return GEOSOverlayContext_symDifference_r(handle, context, g1, g2);
+    }
+
+    Geometry*
+    GEOSOverlayContext_union(GEOSOverlayContext* context, const Geometry* g1, const Geometry* g2)
+    {
+        return GEOSOverlayContext_union_r(handle, context, g1, g2);
+    }
+
     Geometry*
     GEOSUnaryUnion(const Geometry* g)
     {
@@ -839,6 +896,11 @@ extern "C" {
         return GEOSGeom_transformXYZ_r(handle, g, callback, userdata);
     }
 
+    Geometry*
+    GEOSGeom_transformAffine(const GEOSGeometry* g, double a, double b, double d, double e, double xoff, double yoff) {
+        return GEOSGeom_transformAffine_r(handle, g, a, b, d, e, xoff, yoff);
+    }
+
 
 //-------------------------------------------------------------------
 // memory management functions
@@ -1312,6 +1374,18 @@ extern "C" {
         return GEOSCoordSeq_copyFromBuffer_r(handle, buf, size, hasZ, hasM);
     }
 
+    CoordinateSequence*
+    GEOSCoordSeq_borrowFromBuffer(const double* buf, unsigned int size, int hasZ, int hasM)
+    {
+        return GEOSCoordSeq_borrowFromBuffer_r(handle, buf, size, hasZ, hasM);
+    }
+
+    char
+    GEOSCoordSeq_isBorrowed(const CoordinateSequence* s)
+    {
+        return GEOSCoordSeq_isBorrowed_r(handle, s);
+    }
+
     int
     GEOSCoordSeq_copyToBuffer(const CoordinateSequence* s, double* buf, int hasZ, int hasM)
     {
@@ -1622,6 +1696,13 @@ extern "C" {
         return GEOSWKTWriter_write_r(handle, writer, geom);
     }
 
+    char*
+    GEOSWKTWriter_writeBatch(WKTWriter* writer, const Geometry* const* geoms, std::size_t n,
+                             std::size_t* offsets, std::size_t* size)
+    {
+        return GEOSWKTWriter_writeBatch_r(handle, writer, geoms, n, offsets, size);
+    }
+
     void
     GEOSWKTWriter_setTrim(WKTWriter* writer, char trim)
     {
@@ -1677,6 +1758,13 @@ extern "C" {
         return GEOSWKBReader_read_r(handle, reader, wkb, size);
     }
 
+    int
+    GEOSWKBReader_readBatch(WKBReader* reader, const unsigned char* const* wkbs,
+                            const std::size_t* sizes, std::size_t n, Geometry** results)
+    {
+        return GEOSWKBReader_readBatch_r(handle, reader, wkbs, sizes, n, results);
+    }
+
     Geometry*
     GEOSWKBReader_readHEX(WKBReader* reader, const unsigned char* hex, std::size_t size)
     {
@@ -1711,6 +1799,19 @@ extern "C" {
         return GEOSWKBWriter_writeHEX_r(handle, writer, geom, size);
     }
 
+    int
+    GEOSWKBWriter_getWKBSize(WKBWriter* writer, const Geometry* geom, std::size_t* size)
+    {
+        return GEOSWKBWriter_getWKBSize_r(handle, writer, geom, size);
+    }
+
+    int
+    GEOSWKBWriter_writeToBuffer(WKBWriter* writer, const Geometry* geom,
+                                unsigned char* buf, std::size_t bufSize, std::size_t* size)
+    {
+        return GEOSWKBWriter_writeToBuffer_r(handle, writer, geom, buf, bufSize, size);
+    }
+
     int
     GEOSWKBWriter_getOutputDimension(const GEOSWKBWriter* writer)
     {
@@ -1814,6 +1915,50 @@ extern "C" {
         return GEOSGeoJSONWriter_getOutputDimension_r(handle, writer);
     }
 
+    /* GeoJSON Stream Reader */
+    GEOSGeoJSONStreamReader*
+    GEOSGeoJSONStreamReader_create(const char* filename)
+    {
+        return GEOSGeoJSONStreamReader_create_r(handle, filename);
+    }
+
+    void
+    GEOSGeoJSONStreamReader_destroy(GEOSGeoJSONStreamReader* reader)
+    {
+        GEOSGeoJSONStreamReader_destroy_r(handle, reader);
+    }
+
+    char
+    GEOSGeoJSONStreamReader_next(GEOSGeoJSONStreamReader* reader, Geometry** geom)
+    {
+        return GEOSGeoJSONStreamReader_next_r(handle, reader, geom);
+    }
+
+    /* GeoJSON Stream Writer */
+    GEOSGeoJSONStreamWriter*
+    GEOSGeoJSONStreamWriter_create(const char* filename)
+    {
+        return GEOSGeoJSONStreamWriter_create_r(handle, filename);
+    }
+
+    void
+    GEOSGeoJSONStreamWriter_destroy(GEOSGeoJSONStreamWriter* writer)
+    {
+        GEOSGeoJSONStreamWriter_destroy_r(handle, writer);
+    }
+
+    int
+    GEOSGeoJSONStreamWriter_write(GEOSGeoJSONStreamWriter* writer, const Geometry* g)
+    {
+        return GEOSGeoJSONStreamWriter_write_r(handle, writer, g);
+    }
+
+    int
+    GEOSGeoJSONStreamWriter_finish(GEOSGeoJSONStreamWriter* writer)
+    {
+        return GEOSGeoJSONStreamWriter_finish_r(handle, writer);
+    }
+
 
 //-----------------------------------------------------------------
 // Prepared Geometry
@@ -1843,6 +1988,22 @@ extern "C" {
         return GEOSPreparedContainsXY_r(handle, pg1, x, y);
     }
 
+    int
+    GEOSPreparedContainsXYBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                                const double* x, const double* y, std::size_t n,
+                                unsigned char* result)
+    {
+        return GEOSPreparedContainsXYBatch_r(handle, pg1, x, y, n, result);
+    }
+
+    int
+    GEOSPreparedContainsBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                              const Geometry* const* geoms, std::size_t n,
+                              unsigned char* result)
+    {
+        return GEOSPreparedContainsBatch_r(handle, pg1, geoms, n, result);
+    }
+
     char
     GEOSPreparedContainsProperly(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2)
     {
@@ -1885,6 +2046,22 @@ extern "C" {
         return GEOSPreparedIntersectsXY_r(handle, pg1, x, y);
     }
 
+    int
+    GEOSPreparedIntersectsXYBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                                  const double* x, const double* y, std::size_t n,
+                                  unsigned char* result)
+    {
+        return GEOSPreparedIntersectsXYBatch_r(handle, pg1, x, y, n, result);
+    }
+
+    int
+    GEOSPreparedIntersectsBatch(const geos::geom::prep::PreparedGeometry* pg1,
+                                const Geometry* const* geoms, std::size_t n,
+                                unsigned char* result)
+    {
+        return GEOSPreparedIntersectsBatch_r(handle, pg1, geoms, n, result);
+    }
+
     char
     GEOSPreparedOverlaps(const geos::geom::prep::PreparedGeometry* pg1, const Geometry* g2)
     {
@@ -1962,6 +2139,15 @@ extern "C" {
         GEOSSTRtree_query_r(handle, tree, g, cb, userdata);
     }
 
+    int
+    GEOSSTRtree_queryBatch(GEOSSTRtree* tree,
+                           const double* xmin, const double* ymin,
+                           const double* xmax, const double* ymax,
+                           size_t n, size_t** offsets, void*** items)
+    {
+        return GEOSSTRtree_queryBatch_r(handle, tree, xmin, ymin, xmax, ymax, n, offsets, items);
+    }
+
     const GEOSGeometry*
     GEOSSTRtree_nearest(GEOSSTRtree* tree,
                         const geos::geom::Geometry* g)
@@ -2000,6 +2186,61 @@ extern "C" {
         GEOSSTRtree_destroy_r(handle, tree);
     }
 
+    GEOSDynamicSTRtree*
+    GEOSDynamicSTRtree_create(std::size_t nodeCapacity)
+    {
+        return GEOSDynamicSTRtree_create_r(handle, nodeCapacity);
+    }
+
+    void
+    GEOSDynamicSTRtree_insert(GEOSDynamicSTRtree* tree,
+                              const Geometry* g,
+                              void* item)
+    {
+        GEOSDynamicSTRtree_insert_r(handle, tree, g, item);
+    }
+
+    void
+    GEOSDynamicSTRtree_query(GEOSDynamicSTRtree* tree,
+                             const Geometry* g,
+                             GEOSQueryCallback cb,
+                             void* userdata)
+    {
+        GEOSDynamicSTRtree_query_r(handle, tree, g, cb, userdata);
+    }
+
+    void
+    GEOSDynamicSTRtree_iterate(GEOSDynamicSTRtree* tree,
+                               GEOSQueryCallback callback,
+                               void* userdata)
+    {
+        GEOSDynamicSTRtree_iterate_r(handle, tree, callback, userdata);
+    }
+
+    char
+    GEOSDynamicSTRtree_remove(GEOSDynamicSTRtree* tree,
+                              const Geometry* g,
+                              void* item)
+    {
+        return GEOSDynamicSTRtree_remove_r(handle, tree, g, item);
+    }
+
+    void
+    GEOSDynamicSTRtree_destroy(GEOSDynamicSTRtree* tree)
+    {
+        GEOSDynamicSTRtree_destroy_r(handle, tree);
+    }
+
+    int
+    GEOSSpatialJoin(const Geometry* const left[], size_t nleft,
+                    const Geometry* const right[], size_t nright,
+                    int predicate, double distance, const char* pattern,
+                    size_t** leftIndices, size_t** rightIndices, size_t* npairs)
+    {
+        return GEOSSpatialJoin_r(handle, left, nleft, right, nright, predicate, distance, pattern,
+                                 leftIndices, rightIndices, npairs);
+    }
+
     double
     GEOSProject(const geos::geom::Geometry* g,
                 const geos::geom::Geometry* p)
@@ -2150,6 +2391,13 @@ extern "C" {
         return GEOSBufferWithParams_r(handle, g, p, w);
     }
 
+    int
+    GEOSBufferWithParamsBatch(const Geometry* const* geoms, std::size_t n,
+                              const GEOSBufferParams* p, double w, Geometry** results)
+    {
+        return GEOSBufferWithParamsBatch_r(handle, geoms, n, p, w, results);
+    }
+
     Geometry*
     GEOSDelaunayTriangulation(const Geometry* g, double tolerance, int onlyEdges)
     {
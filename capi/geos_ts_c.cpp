@@ -38,13 +38,16 @@
 #include <geos/geom/CircularString.h>
 #include <geos/geom/CompoundCurve.h>
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateKernels.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/CoordinateSequenceFilter.h>
 #include <geos/geom/Curve.h>
 #include <geos/geom/CurvePolygon.h>
 #include <geos/geom/Envelope.h>
 #include <geos/geom/Geometry.h>
 #include <geos/geom/GeometryCollection.h>
 #include <geos/geom/GeometryFactory.h>
+#include <geos/geom/HeuristicOverlay.h>
 #include <geos/geom/IntersectionMatrix.h>
 #include <geos/geom/LinearRing.h>
 #include <geos/geom/LineSegment.h>
@@ -63,13 +66,17 @@
 #include <geos/geom/util/Densifier.h>
 #include <geos/geom/util/GeometryFixer.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/index/strtree/DynamicSTRtree.h>
 #include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKBWriter.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/io/Writer.h>
 #include <geos/io/GeoJSONReader.h>
 #include <geos/io/GeoJSONWriter.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
 #include <geos/linearref/LengthIndexedLine.h>
 #include <geos/noding/GeometryNoder.h>
 #include <geos/noding/Noder.h>
@@ -92,7 +99,9 @@
 #include <geos/operation/split/GeometrySplitter.h>
 #include <geos/operation/intersection/Rectangle.h>
 #include <geos/operation/intersection/RectangleIntersection.h>
+#include <geos/operation/join/SpatialJoin.h>
 #include <geos/operation/overlay/snap/GeometrySnapper.h>
+#include <geos/operation/overlayng/OverlayContext.h>
 #include <geos/operation/overlayng/PrecisionReducer.h>
 #include <geos/operation/overlayng/OverlayNG.h>
 #include <geos/operation/overlayng/OverlayNGRobust.h>
@@ -108,6 +117,7 @@
 #include <geos/operation/valid/MakeValid.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
 
+#include <geos/operation/relateng/PreparedRelateCache.h>
 #include <geos/operation/relateng/RelateNG.h>
 
 #include <geos/precision/GeometryPrecisionReducer.h>
@@ -124,6 +134,7 @@
 #include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/util/Machine.h>
 #include <geos/util/Progress.h>
+#include <geos/util/TaskPool.h>
 #include <geos/version.h>
 
 // This should go away
@@ -139,6 +150,7 @@
 #include <sstream>
 #include <string>
 #include <memory>
+#include <algorithm>
 
 #ifdef _MSC_VER
 #pragma warning(disable : 4099)
@@ -156,13 +168,17 @@
 #define GEOSCurveToLineParams geos::algorithm::CurveToLineParams
 #define GEOSBufferParams geos::operation::buffer::BufferParameters
 #define GEOSLineToCurveParams geos::algorithm::LineToCurveParams
+#define GEOSOverlayContext geos::operation::overlayng::OverlayContext
 #define GEOSSTRtree geos::index::strtree::TemplateSTRtree<void*>
+#define GEOSDynamicSTRtree geos::index::strtree::DynamicSTRtree<void*>
 #define GEOSWKTReader geos::io::WKTReader
 #define GEOSWKTWriter geos::io::WKTWriter
 #define GEOSWKBReader geos::io::WKBReader
 #define GEOSWKBWriter geos::io::WKBWriter
 #define GEOSGeoJSONReader geos::io::GeoJSONReader
 #define GEOSGeoJSONWriter geos::io::GeoJSONWriter
+#define GEOSGeoJSONStreamReader geos::io::GeoJSONStreamReader
+#define GEOSGeoJSONStreamWriter geos::io::GeoJSONStreamWriter
 
 // Implementation struct for the GEOSCoverageCleanParams object
 typedef struct {
@@ -235,6 +251,7 @@ using geos::operation::buffer::OffsetCurve;
 using geos::operation::cluster::Clusters;
 using geos::operation::distance::IndexedFacetDistance;
 using geos::operation::geounion::CascadedPolygonUnion;
+using geos::operation::overlayng::OverlayContext;
 using geos::operation::overlayng::OverlayNG;
 using geos::operation::overlayng::UnaryUnionNG;
 using geos::operation::overlayng::OverlayNGRobust;
@@ -267,6 +284,9 @@ typedef struct GEOSContextHandle_HS {
     std::optional<GEOSLineToCurveParams> lineToCurveParams;
     std::optional<GEOSCurveToLineParams> curveToLineParams;
     geos::util::ProgressFunction progressFunction;
+    unsigned int threadCount;
+    std::unique_ptr<geos::util::TaskPool> taskPool;
+    std::unique_ptr<geos::operation::relateng::PreparedRelateCache> preparedCache;
 
     GEOSContextHandle_HS()
         :
@@ -281,7 +301,8 @@ typedef struct GEOSContextHandle_HS {
         progress_cb(nullptr),
         progress_cb_data(nullptr),
         errorData(nullptr),
-        point2d(nullptr)
+        point2d(nullptr),
+        threadCount(1)
     {
         memset(msgBuffer, 0, sizeof(msgBuffer));
         geomFactory = GeometryFactory::getDefaultInstance();
@@ -362,6 +383,78 @@ typedef struct GEOSContextHandle_HS {
         return old;
     }
 
+    unsigned int
+    setThreadCount(unsigned int numThreads)
+    {
+        auto old = threadCount;
+        if (numThreads == 0) {
+            numThreads = static_cast<unsigned int>(geos::util::TaskPool::hardwareConcurrency());
+        }
+        if (numThreads != threadCount) {
+            threadCount = numThreads;
+            taskPool.reset();
+        }
+        return old;
+    }
+
+    // Returns the pool to use for parallel operations, or nullptr
+    // if operations should run sequentially.
+    geos::util::TaskPool*
+    getTaskPool()
+    {
+        if (threadCount <= 1) {
+            return nullptr;
+        }
+        if (!taskPool) {
+            taskPool = std::make_unique<geos::util::TaskPool>(threadCount - 1);
+        }
+        return taskPool.get();
+    }
+
+    void
+    setPreparedCacheParams(std::size_t maxMemory)
+    {
+        if (maxMemory == 0) {
+            preparedCache.reset();
+        }
+        else {
+            preparedCache = std::make_unique<geos::operation::relateng::PreparedRelateCache>(maxMemory);
+        }
+    }
+
+    // Drops a geometry that is being destroyed, modified or passed
+    // to GEOS, and its components, from the prepared geometry cache.
+    void
+    uncachePrepared(const Geometry* g)
+    {
+        if (!preparedCache || preparedCache->isEmpty() || g == nullptr) {
+            return;
+        }
+
+        class Uncache : public geos::geom::GeometryComponentFilter {
+        public:
+            explicit Uncache(geos::operation::relateng::PreparedRelateCache& p_cache) : cache(p_cache) {}
+
+            void filter_ro(const Geometry* component) override {
+                cache.remove(component);
+            }
+
+        private:
+            geos::operation::relateng::PreparedRelateCache& cache;
+        };
+
+        Uncache uncache(*preparedCache);
+        g->apply_ro(&uncache);
+    }
+
+    void
+    uncachePrepared(Geometry* const* geoms, std::size_t ngeoms)
+    {
+        for (std::size_t i = 0; geoms != nullptr && i < ngeoms; i++) {
+            uncachePrepared(geoms[i]);
+        }
+    }
+
     void
     NOTICE_MESSAGE(GEOS_PRINTF_FORMAT const char *fmt, ...) GEOS_PRINTF_FORMAT_ATTR(2, 3)
     {
@@ -489,6 +582,22 @@ InputGeometry convertToLineIfNeeded(GEOSContextHandle_t extHandle, const Geometr
     return InputGeometry(g);
 }
 
+// Returns a prepared RelateNG for g1 from the context cache, or nullptr
+// if the cache is disabled, g1 has not been added to it or does not fit
+// in it, or the cache cannot be used for the arguments.
+geos::operation::relateng::RelateNG*
+getCachedPrepared(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2) {
+    if (!extHandle->preparedCache || !extHandle->preparedCache->contains(g1)) {
+        return nullptr;
+    }
+    for (const Geometry* g : { g1, g2 }) {
+        if (isCurvedType(g->getGeometryTypeId()) || g->hasCurvedComponents()) {
+            return nullptr;
+        }
+    }
+    return extHandle->preparedCache->get(g1);
+}
+
 Geometry* convertToCurveIfNeeded(GEOSContextHandle_t extHandle, std::unique_ptr<Geometry> g) {
     if (extHandle->lineToCurveParams.has_value() && g->hasCurvedComponents()) {
         return g->getCurved(extHandle->lineToCurveParams.value()).release();
@@ -817,6 +926,16 @@ extern "C" {
         return extHandle->setProgressCallback(cb, userData);
     }
 
+    unsigned int
+    GEOSContext_setThreadCount_r(GEOSContextHandle_t extHandle, unsigned int numThreads)
+    {
+        if(0 == extHandle->initialized) {
+            return 0;
+        }
+
+        return extHandle->setThreadCount(numThreads);
+    }
+
     void GEOSContext_setCurveToLineParams_r(GEOSContextHandle_t extHandle, const GEOSCurveToLineParams* params)
     {
         if (params) {
@@ -835,6 +954,72 @@ extern "C" {
         }
     }
 
+    void
+    GEOSContext_setPreparedCacheParams_r(GEOSContextHandle_t extHandle, size_t maxMemoryBytes)
+    {
+        if(0 == extHandle->initialized) {
+            return;
+        }
+
+        extHandle->setPreparedCacheParams(maxMemoryBytes);
+    }
+
+    int
+    GEOSContext_getPreparedCacheStats_r(GEOSContextHandle_t extHandle, size_t* hits, size_t* misses, size_t* memoryUsed)
+    {
+        if(0 == extHandle->initialized || !extHandle->preparedCache) {
+            return 0;
+        }
+
+        const auto& cache = *extHandle->preparedCache;
+        if (hits) {
+            *hits = cache.getHits();
+        }
+        if (misses) {
+            *misses = cache.getMisses();
+        }
+        if (memoryUsed) {
+            *memoryUsed = cache.getMemoryUsed();
+        }
+        return 1;
+    }
+
+    int
+    GEOSContext_addToPreparedCache_r(GEOSContextHandle_t extHandle, const Geometry* g)
+    {
+        return execute(extHandle, 0, [&]() {
+            if (!extHandle->preparedCache || isCurvedType(g->getGeometryTypeId()) || g->hasCurvedComponents()) {
+                return 0;
+            }
+            extHandle->preparedCache->add(g);
+            return 1;
+        });
+    }
+
+    void
+    GEOSContext_removeFromPreparedCache_r(GEOSContextHandle_t extHandle, const Geometry* g)
+    {
+        if(0 == extHandle->initialized) {
+            return;
+        }
+
+        if (extHandle->preparedCache) {
+            extHandle->preparedCache->remove(g);
+        }
+    }
+
+    void
+    GEOSContext_clearPreparedCache_r(GEOSContextHandle_t extHandle)
+    {
+        if(0 == extHandle->initialized) {
+            return;
+        }
+
+        if (extHandle->preparedCache) {
+            extHandle->preparedCache->clear();
+        }
+    }
+
     void
     finishGEOS_r(GEOSContextHandle_t extHandle)
     {
@@ -867,6 +1052,10 @@ extern "C" {
     GEOSDisjoint_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->disjoint(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -878,6 +1067,10 @@ extern "C" {
     GEOSTouches_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->touches(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -889,6 +1082,10 @@ extern "C" {
     GEOSIntersects_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->intersects(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -900,6 +1097,10 @@ extern "C" {
     GEOSCrosses_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->crosses(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -911,6 +1112,10 @@ extern "C" {
     GEOSWithin_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->within(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -922,6 +1127,10 @@ extern "C" {
     GEOSContains_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->contains(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -933,6 +1142,10 @@ extern "C" {
     GEOSOverlaps_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->overlaps(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -944,6 +1157,10 @@ extern "C" {
     GEOSCovers_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->covers(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -955,6 +1172,10 @@ extern "C" {
     GEOSCoveredBy_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->coveredBy(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -966,6 +1187,10 @@ extern "C" {
     GEOSEquals_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2)
     {
         return execute(extHandle, 2, [&]() {
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->equalsTopo(g2);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
@@ -982,10 +1207,14 @@ extern "C" {
     GEOSRelatePattern_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, const char* imPattern)
     {
         return execute(extHandle, 2, [&]() {
+            std::string s(imPattern);
+            if (auto prep = getCachedPrepared(extHandle, g1, g2)) {
+                return prep->relate(g2, s);
+            }
+
             const auto geom1 = convertToLineIfNeeded(extHandle, g1);
             const auto geom2 = convertToLineIfNeeded(extHandle, g2);
 
-            std::string s(imPattern);
             return geom1->relate(geom2, s);
         });
     }
@@ -1014,7 +1243,8 @@ extern "C" {
 
             using geos::geom::IntersectionMatrix;
 
-            auto im = geom1->relate(geom2);
+            auto prep = getCachedPrepared(extHandle, g1, g2);
+            auto im = prep ? prep->relate(g2) : geom1->relate(geom2);
             if(im == nullptr) {
                 return (char*) nullptr;
             }
@@ -1086,6 +1316,7 @@ extern "C" {
             using geos::operation::valid::IsValidOp;
 
             IsValidOp ivo(inputGeom);
+            ivo.setTaskPool(extHandle->getTaskPool());
             const TopologyValidationError* err = ivo.getValidationError();
 
             if(err) {
@@ -1165,6 +1396,33 @@ extern "C" {
         });
     }
 
+    int
+    GEOSisValidBatch_r(GEOSContextHandle_t extHandle,
+                       const Geometry* const* geoms, std::size_t n, int flags,
+                       unsigned char* result)
+    {
+        using geos::operation::valid::IsValidOp;
+
+        return execute(extHandle, 0, [&]() {
+            std::vector<InputGeometry> inputs;
+            inputs.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                inputs.push_back(convertToLineIfNeeded(extHandle, geoms[i]));
+            }
+
+            geos::util::TaskPool* pool = extHandle->getTaskPool();
+            geos::util::parallelFor(pool, n, [&](std::size_t i) {
+                IsValidOp ivo(inputs[i].get());
+                ivo.setTaskPool(pool);
+                if(flags & GEOSVALID_ALLOW_SELFTOUCHING_RING_FORMING_HOLE) {
+                    ivo.setSelfTouchingRingFormingHoleValid(true);
+                }
+                result[i] = ivo.isValid() ? 1 : 0;
+            });
+            return 1;
+        });
+    }
+
 //-----------------------------------------------------------------
 // general purpose
 //-----------------------------------------------------------------
@@ -1221,7 +1479,9 @@ extern "C" {
             const auto input1 = convertToLineIfNeeded(extHandle, g1);
             const auto input2 = convertToLineIfNeeded(extHandle, g2);
 
-            *dist = DiscreteHausdorffDistance::distance(*input1, *input2);
+            DiscreteHausdorffDistance dhd(*input1, *input2);
+            dhd.setTaskPool(extHandle->getTaskPool());
+            *dist = dhd.distance();
             return 1;
         });
     }
@@ -1237,6 +1497,7 @@ extern "C" {
             const auto input2 = convertToLineIfNeeded(extHandle, g2);
 
             DiscreteHausdorffDistance dhd(*input1, *input2);
+            dhd.setTaskPool(extHandle->getTaskPool());
             *dist = dhd.distance();
             const auto& pts = dhd.getCoordinates();
             *p1x = pts[0].x;
@@ -1255,7 +1516,10 @@ extern "C" {
             const auto input1 = convertToLineIfNeeded(extHandle, g1);
             const auto input2 = convertToLineIfNeeded(extHandle, g2);
 
-            *dist = DiscreteHausdorffDistance::distance(*input1, *input2, densifyFrac);
+            DiscreteHausdorffDistance dhd(*input1, *input2);
+            dhd.setDensifyFraction(densifyFrac);
+            dhd.setTaskPool(extHandle->getTaskPool());
+            *dist = dhd.distance();
             return 1;
         });
     }
@@ -1270,6 +1534,7 @@ extern "C" {
 
             DiscreteHausdorffDistance dhd(*input1, *input2);
             dhd.setDensifyFraction(densifyFrac);
+            dhd.setTaskPool(extHandle->getTaskPool());
             *dist = dhd.distance();
             const auto& pts = dhd.getCoordinates();
             *p1x = pts[0].x;
@@ -1305,6 +1570,17 @@ extern "C" {
         });
     }
 
+    char
+    GEOSFrechetDistanceWithin_r(GEOSContextHandle_t extHandle, const Geometry* g1, const Geometry* g2, double dist)
+    {
+        return execute(extHandle, 2, [&]() {
+            const auto input1 = convertToLineIfNeeded(extHandle, g1);
+            const auto input2 = convertToLineIfNeeded(extHandle, g2);
+
+            return DiscreteFrechetDistance::isWithinDistance(*input1, *input2, dist);
+        });
+    }
+
     int
     GEOSArea_r(GEOSContextHandle_t extHandle, const Geometry* g, double* area)
     {
@@ -1472,14 +1748,11 @@ extern "C" {
 
             int byteOrder = handle->WKBByteOrder;
             WKBWriter w(handle->WKBOutputDims, byteOrder);
-            std::ostringstream os(std::ios_base::binary);
-            w.write(*g, os);
-            std::string wkbstring(os.str());
-            const std::size_t len = wkbstring.length();
+            const std::size_t len = w.getWkbSize(*g);
 
             unsigned char* result = static_cast<unsigned char*>(malloc(len));
             if(result) {
-                std::memcpy(result, wkbstring.c_str(), len);
+                w.write(*g, result, len);
                 *size = len;
             }
             return result;
@@ -2058,6 +2331,60 @@ extern "C" {
         });
     }
 
+    GEOSOverlayContext*
+    GEOSOverlayContext_create_r(GEOSContextHandle_t extHandle)
+    {
+        return execute(extHandle, [&]() {
+            return new OverlayContext();
+        });
+    }
+
+    void
+    GEOSOverlayContext_destroy_r(GEOSContextHandle_t extHandle, GEOSOverlayContext* context)
+    {
+        (void)extHandle;
+        delete context;
+    }
+
+    static Geometry*
+    overlayWithContext(GEOSContextHandle_t extHandle, GEOSOverlayContext* context,
+                       const Geometry* g1, const Geometry* g2, int opCode)
+    {
+        return execute(extHandle, [&]() {
+            auto g3 = geos::geom::HeuristicOverlay(g1, g2, opCode, context);
+            g3->setSRID(g1->getSRID());
+            return g3.release();
+        });
+    }
+
+    Geometry*
+    GEOSOverlayContext_intersection_r(GEOSContextHandle_t extHandle, GEOSOverlayContext* context,
+                                      const Geometry* g1, const Geometry* g2)
+    {
+        return overlayWithContext(extHandle, context, g1, g2, OverlayNG::INTERSECTION);
+    }
+
+    Geometry*
+    GEOSOverlayContext_difference_r(GEOSContextHandle_t extHandle, GEOSOverlayContext* context,
+                                    const Geometry* g1, const Geometry* g2)
+    {
+        return overlayWithContext(extHandle, context, g1, g2, OverlayNG::DIFFERENCE);
+    }
+
+    Geometry*
+    GEOSOverlayContext_symDifference_r(GEOSContextHandle_t extHandle, GEOSOverlayContext* context,
+                                       const Geometry* g1, const Geometry* g2)
+    {
+        return overlayWithContext(extHandle, context, g1, g2, OverlayNG::SYMDIFFERENCE);
+    }
+
+    Geometry*
+    GEOSOverlayContext_union_r(GEOSContextHandle_t extHandle, GEOSOverlayContext* context,
+                               const Geometry* g1, const Geometry* g2)
+    {
+        return overlayWithContext(extHandle, context, g1, g2, OverlayNG::UNION);
+    }
+
     Geometry*
     GEOSCoverageUnion_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
@@ -2078,7 +2405,7 @@ extern "C" {
     GEOSUnaryUnion_r(GEOSContextHandle_t extHandle, const Geometry* g)
     {
         return execute<Interruptible, ReportsProgress>(extHandle, [&]() {
-            auto g3 = geos::operation::geounion::UnaryUnionOp::Union(*g, &extHandle->progressFunction);
+            auto g3 = geos::operation::geounion::UnaryUnionOp::Union(*g, &extHandle->progressFunction, extHandle->getTaskPool());
             g3->setSRID(g->getSRID());
             return g3.release();
         });
@@ -2264,6 +2591,53 @@ extern "C" {
         });
     }
 
+    Geometry*
+    GEOSGeom_transformAffine_r(GEOSContextHandle_t handle, const GEOSGeometry* g,
+                               double a, double b, double d, double e, double xoff, double yoff) {
+
+        // Transforms a whole sequence in one call, then stops
+        struct AffineSequenceFilter final: public geos::geom::CoordinateSequenceFilter {
+            explicit AffineSequenceFilter(const double* p_c) : c(p_c) {}
+
+            void filter_rw(CoordinateSequence& seq, std::size_t) override {
+                geos::geom::CoordinateKernels::affine(seq.data(), seq.size(), seq.stride(),
+                                                      c[0], c[1], c[2], c[3], c[4], c[5]);
+                done = true;
+            }
+
+            bool isDone() const override { return done; }
+            bool isGeometryChanged() const override { return true; }
+
+            const double* c;
+            bool done = false;
+        };
+
+        // Applies a sequence filter to each point and curve, so that
+        // the filter is called once per sequence
+        struct AffineFilter final: public geos::geom::GeometryComponentFilter {
+            explicit AffineFilter(const double* p_c) : c(p_c) {}
+
+            void filter_rw(Geometry* component) override {
+                if (component->isCollection() || component->getDimension() == geos::geom::Dimension::A) {
+                    return;
+                }
+                AffineSequenceFilter seqFilter(c);
+                component->apply_rw(seqFilter);
+            }
+
+            const double* c;
+        };
+
+        return execute(handle, [&]() {
+            const double c[6] = { a, b, d, e, xoff, yoff };
+            AffineFilter filter(c);
+            auto ret = g->clone();
+            ret->apply_rw(&filter);
+            ret->geometryChanged();
+            return ret.release();
+        });
+    }
+
 
 //-------------------------------------------------------------------
 // memory management functions
@@ -2276,6 +2650,10 @@ extern "C" {
             // FIXME: mloskot: Does this try-catch around delete means that
             // destructors in GEOS may throw? If it does, this is a serious
             // violation of "never throw an exception from a destructor" principle
+            // the handle may already have been finished
+            if (extHandle != nullptr) {
+                extHandle->uncachePrepared(a);
+            }
             delete a;
         });
     }
@@ -2313,6 +2691,7 @@ extern "C" {
     GEOSNormalize_r(GEOSContextHandle_t extHandle, Geometry* g)
     {
         return execute(extHandle, -1, [&]() {
+            extHandle->uncachePrepared(g);
             g->normalize();
             return 0; // SUCCESS
         });
@@ -2340,6 +2719,7 @@ extern "C" {
             };
 
             OrientPolygons op(exteriorCW);
+            extHandle->uncachePrepared(g);
             g->apply_rw(&op);
 
             return 0;
@@ -2717,6 +3097,7 @@ extern "C" {
 
             const GeometryFactory* gf = handle->geomFactory;
 
+            handle->uncachePrepared(geoms, ngeoms);
             std::vector<std::unique_ptr<Geometry>> vgeoms(ngeoms);
             for (std::size_t i = 0; i < ngeoms; i++) {
                 vgeoms[i].reset(geoms[i]);
@@ -2772,6 +3153,7 @@ extern "C" {
                 return static_cast<Geometry**>(nullptr);
             }
 
+            handle->uncachePrepared(col);
             std::vector<std::unique_ptr<Geometry>> subgeoms = col->releaseGeometries();
 
             Geometry** subgeomArray = static_cast<Geometry**>(malloc(sizeof(Geometry*) * subgeoms.size()));
@@ -2927,9 +3309,10 @@ extern "C" {
         using geos::geom::util::GeometryFixer;
         using geos::operation::valid::MakeValid;
 
-        return convertCurvesAndExecute(extHandle, input, [params](const Geometry* g) {
+        return convertCurvesAndExecute(extHandle, input, [extHandle, params](const Geometry* g) {
             if (params && params->method == GEOS_MAKE_VALID_LINEWORK) {
                 MakeValid makeValid;
+                makeValid.setTaskPool(extHandle->getTaskPool());
                 return makeValid.build(g);
             }
             if (params && params->method == GEOS_MAKE_VALID_STRUCTURE) {
@@ -3311,6 +3694,26 @@ extern "C" {
         });
     }
 
+    CoordinateSequence*
+    GEOSCoordSeq_borrowFromBuffer_r(GEOSContextHandle_t extHandle, const double* buf, unsigned int size, int hasZ, int hasM)
+    {
+        if (!CoordinateSequence::canBorrow(hasZ, hasM)) {
+            return GEOSCoordSeq_copyFromBuffer_r(extHandle, buf, size, hasZ, hasM);
+        }
+
+        return execute(extHandle, [&]() {
+            return new CoordinateSequence(CoordinateSequence::borrow(buf, size, hasZ, hasM));
+        });
+    }
+
+    char
+    GEOSCoordSeq_isBorrowed_r(GEOSContextHandle_t extHandle, const CoordinateSequence* cs)
+    {
+        return execute(extHandle, 2, [&]() {
+            return cs->isBorrowed();
+        });
+    }
+
     CoordinateSequence*
     GEOSCoordSeq_copyFromArrays_r(GEOSContextHandle_t extHandle, const double* x, const double* y, const double* z, const double* m, unsigned int size)
     {
@@ -3700,6 +4103,9 @@ extern "C" {
             const GeometryFactory* gf = handle->geomFactory;
             bool good_holes = true, good_shell = true;
 
+            handle->uncachePrepared(shell);
+            handle->uncachePrepared(holes, nholes);
+
             // Validate input before taking ownership
             for (std::size_t i = 0; i < nholes; i++) {
                 if ((!holes) || (!dynamic_cast<LinearRing*>(holes[i]))) {
@@ -3782,6 +4188,8 @@ extern "C" {
             GEOSContextHandleInternal_t* handle = reinterpret_cast<GEOSContextHandleInternal_t*>(extHandle);
             const GeometryFactory* gf = handle->geomFactory;
 
+            handle->uncachePrepared(geoms, ngeoms);
+
             bool invalid_input = false;
             std::vector<std::unique_ptr<SimpleCurve>> geom_vec(ngeoms);
             for (std::size_t i = 0; i < ngeoms; i++) {
@@ -3820,6 +4228,9 @@ extern "C" {
             const GeometryFactory* gf = handle->geomFactory;
             bool good_holes = true, good_shell = true;
 
+            handle->uncachePrepared(p_shell);
+            handle->uncachePrepared(p_holes, nholes);
+
             std::unique_ptr<Curve> shell;
             std::vector<std::unique_ptr<Curve>> holes(nholes);
 
@@ -4146,6 +4557,28 @@ extern "C" {
         });
     }
 
+    char*
+    GEOSWKTWriter_writeBatch_r(GEOSContextHandle_t extHandle, WKTWriter* writer,
+                               const Geometry* const* geoms, std::size_t n,
+                               std::size_t* offsets, std::size_t* size)
+    {
+        return execute(extHandle, [&]() {
+            geos::io::Writer out;
+            for (std::size_t i = 0; i < n; i++) {
+                offsets[i] = out.size();
+                writer->write(geoms[i], &out);
+                out.write('\0');
+            }
+
+            char* result = static_cast<char*>(malloc(std::max<std::size_t>(out.size(), 1)));
+            if (result) {
+                std::memcpy(result, out.data(), out.size());
+                *size = out.size();
+            }
+            return result;
+        });
+    }
+
     void
     GEOSWKTWriter_setTrim_r(GEOSContextHandle_t extHandle, WKTWriter* writer, char trim)
     {
@@ -4229,6 +4662,20 @@ extern "C" {
         });
     }
 
+    int
+    GEOSWKBReader_readBatch_r(GEOSContextHandle_t extHandle, WKBReader* reader,
+                              const unsigned char* const* wkbs, const std::size_t* sizes, std::size_t n,
+                              Geometry** results)
+    {
+        return execute(extHandle, 0, [&]() {
+            auto geoms = reader->readBatch(wkbs, sizes, n, extHandle->getTaskPool());
+            for (std::size_t i = 0; i < n; i++) {
+                results[i] = geoms[i].release();
+            }
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSWKBReader_readHEX_r(GEOSContextHandle_t extHandle, WKBReader* reader, const unsigned char* hex, std::size_t size)
     {
@@ -4267,19 +4714,36 @@ extern "C" {
     GEOSWKBWriter_write_r(GEOSContextHandle_t extHandle, WKBWriter* writer, const Geometry* geom, std::size_t* size)
     {
         return execute(extHandle, [&]() {
-            std::ostringstream os(std::ios_base::binary);
-            writer->write(*geom, os);
-
-            const std::string& wkbstring = os.str();
-            const std::size_t len = wkbstring.length();
+            const std::size_t len = writer->getWkbSize(*geom);
 
             unsigned char* result = (unsigned char*) malloc(len);
-            std::memcpy(result, wkbstring.c_str(), len);
-            *size = len;
+            if(result) {
+                writer->write(*geom, result, len);
+                *size = len;
+            }
             return result;
         });
     }
 
+    int
+    GEOSWKBWriter_getWKBSize_r(GEOSContextHandle_t extHandle, WKBWriter* writer, const Geometry* geom, std::size_t* size)
+    {
+        return execute(extHandle, 0, [&]() {
+            *size = writer->getWkbSize(*geom);
+            return 1;
+        });
+    }
+
+    int
+    GEOSWKBWriter_writeToBuffer_r(GEOSContextHandle_t extHandle, WKBWriter* writer, const Geometry* geom,
+                                  unsigned char* buf, std::size_t bufSize, std::size_t* size)
+    {
+        return execute(extHandle, 0, [&]() {
+            *size = writer->write(*geom, buf, bufSize);
+            return 1;
+        });
+    }
+
     /* The caller owns the result */
     unsigned char*
     GEOSWKBWriter_writeHEX_r(GEOSContextHandle_t extHandle, WKBWriter* writer, const Geometry* geom, std::size_t* size)
@@ -4440,6 +4904,80 @@ extern "C" {
         });
     }
 
+    /* GeoJSON Stream Reader */
+    GEOSGeoJSONStreamReader*
+    GEOSGeoJSONStreamReader_create_r(GEOSContextHandle_t extHandle, const char* filename)
+    {
+        using geos::io::GeoJSONStreamReader;
+
+        return execute(extHandle, [&]() {
+            GEOSContextHandleInternal_t *handle = reinterpret_cast<GEOSContextHandleInternal_t *>(extHandle);
+            auto file = std::make_unique<std::ifstream>(filename, std::ios::binary);
+            if (!file->is_open()) {
+                throw geos::util::IllegalArgumentException(std::string("Cannot open file: ") + filename);
+            }
+            return new GeoJSONStreamReader(std::move(file), *(GeometryFactory*)handle->geomFactory);
+        });
+    }
+
+    void
+    GEOSGeoJSONStreamReader_destroy_r(GEOSContextHandle_t extHandle, GEOSGeoJSONStreamReader* reader)
+    {
+        return execute(extHandle, [&]() {
+            delete reader;
+        });
+    }
+
+    char
+    GEOSGeoJSONStreamReader_next_r(GEOSContextHandle_t extHandle, GEOSGeoJSONStreamReader* reader, GEOSGeometry** geom)
+    {
+        return execute(extHandle, 2, [&]() {
+            *geom = reader->nextGeometry().release();
+            return *geom != nullptr;
+        });
+    }
+
+    /* GeoJSON Stream Writer */
+    GEOSGeoJSONStreamWriter*
+    GEOSGeoJSONStreamWriter_create_r(GEOSContextHandle_t extHandle, const char* filename)
+    {
+        using geos::io::GeoJSONStreamWriter;
+
+        return execute(extHandle, [&]() {
+            auto file = std::make_unique<std::ofstream>(filename, std::ios::binary);
+            if (!file->is_open()) {
+                throw geos::util::IllegalArgumentException(std::string("Cannot create file: ") + filename);
+            }
+            return new GeoJSONStreamWriter(std::move(file));
+        });
+    }
+
+    void
+    GEOSGeoJSONStreamWriter_destroy_r(GEOSContextHandle_t extHandle, GEOSGeoJSONStreamWriter* writer)
+    {
+        return execute(extHandle, [&]() {
+            delete writer;
+        });
+    }
+
+    int
+    GEOSGeoJSONStreamWriter_write_r(GEOSContextHandle_t extHandle, GEOSGeoJSONStreamWriter* writer, const GEOSGeometry* g)
+    {
+        return execute(extHandle, 0, [&]() {
+            writer->write(g);
+            return 1;
+        });
+    }
+
+    int
+    GEOSGeoJSONStreamWriter_finish_r(GEOSContextHandle_t extHandle, GEOSGeoJSONStreamWriter* writer)
+    {
+        return execute(extHandle, 0, [&]() {
+            writer->finish();
+            return 1;
+        });
+    }
+
 
 //-----------------------------------------------------------------
 // Prepared Geometry
@@ -4479,6 +5017,43 @@ extern "C" {
         return GEOSPreparedContains_r(extHandle, pg, extHandle->point2d.get());
     }
 
+    int
+    GEOSPreparedContainsXYBatch_r(GEOSContextHandle_t extHandle,
+                                  const PreparedGeometry* pg,
+                                  const double* x, const double* y, std::size_t n,
+                                  unsigned char* result)
+    {
+        return execute(extHandle, 0, [&]() {
+            pg->containsXY(x, y, n, result, extHandle->getTaskPool());
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedContainsBatch_r(GEOSContextHandle_t extHandle,
+                                const PreparedGeometry* pg,
+                                const Geometry* const* geoms, std::size_t n,
+                                unsigned char* result)
+    {
+        return execute(extHandle, 0, [&]() {
+            if (!extHandle->curveToLineParams.has_value()) {
+                pg->containsEach(geoms, n, result, extHandle->getTaskPool());
+                return 1;
+            }
+
+            std::vector<InputGeometry> inputs;
+            std::vector<const Geometry*> linear;
+            inputs.reserve(n);
+            linear.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                inputs.push_back(convertToLineIfNeeded(extHandle, geoms[i]));
+                linear.push_back(inputs.back().get());
+            }
+            pg->containsEach(linear.data(), n, result, extHandle->getTaskPool());
+            return 1;
+        });
+    }
+
     char
     GEOSPreparedContainsProperly_r(GEOSContextHandle_t extHandle,
                                    const PreparedGeometry* pg, const Geometry* g)
@@ -4542,6 +5117,43 @@ extern "C" {
         return GEOSPreparedIntersects_r(extHandle, pg, extHandle->point2d.get());
     }
 
+    int
+    GEOSPreparedIntersectsXYBatch_r(GEOSContextHandle_t extHandle,
+                                    const PreparedGeometry* pg,
+                                    const double* x, const double* y, std::size_t n,
+                                    unsigned char* result)
+    {
+        return execute(extHandle, 0, [&]() {
+            pg->intersectsXY(x, y, n, result, extHandle->getTaskPool());
+            return 1;
+        });
+    }
+
+    int
+    GEOSPreparedIntersectsBatch_r(GEOSContextHandle_t extHandle,
+                                  const PreparedGeometry* pg,
+                                  const Geometry* const* geoms, std::size_t n,
+                                  unsigned char* result)
+    {
+        return execute(extHandle, 0, [&]() {
+            if (!extHandle->curveToLineParams.has_value()) {
+                pg->intersectsEach(geoms, n, result, extHandle->getTaskPool());
+                return 1;
+            }
+
+            std::vector<InputGeometry> inputs;
+            std::vector<const Geometry*> linear;
+            inputs.reserve(n);
+            linear.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                inputs.push_back(convertToLineIfNeeded(extHandle, geoms[i]));
+                linear.push_back(inputs.back().get());
+            }
+            pg->intersectsEach(linear.data(), n, result, extHandle->getTaskPool());
+            return 1;
+        });
+    }
+
     char
     GEOSPreparedOverlaps_r(GEOSContextHandle_t extHandle,
                            const PreparedGeometry* pg, const Geometry* g)
@@ -4647,7 +5259,7 @@ extern "C" {
                         GEOSSTRtree* tree)
     {
         return execute(extHandle, 0, [&]() {
-            tree->build();
+            tree->build(extHandle->getTaskPool());
             return 1;
         });
     }
@@ -4676,6 +5288,42 @@ extern "C" {
         });
     }
 
+    int
+    GEOSSTRtree_queryBatch_r(GEOSContextHandle_t extHandle,
+                             GEOSSTRtree* tree,
+                             const double* xmin, const double* ymin,
+                             const double* xmax, const double* ymax,
+                             std::size_t n,
+                             std::size_t** offsets,
+                             void*** items)
+    {
+        return execute(extHandle, 0, [&]() {
+            std::vector<Envelope> envs;
+            envs.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                envs.emplace_back(xmin[i], xmax[i], ymin[i], ymax[i]);
+            }
+
+            std::vector<std::size_t> found_offsets;
+            std::vector<void*> found_items;
+            tree->queryBatch(envs.data(), n, found_offsets, found_items, extHandle->getTaskPool());
+
+            auto* offsets_buf = static_cast<std::size_t*>(malloc(found_offsets.size() * sizeof(std::size_t)));
+            auto* items_buf = static_cast<void**>(malloc(std::max<std::size_t>(found_items.size(), 1) * sizeof(void*)));
+            if (offsets_buf == nullptr || items_buf == nullptr) {
+                free(offsets_buf);
+                free(items_buf);
+                throw std::bad_alloc();
+            }
+            std::copy(found_offsets.begin(), found_offsets.end(), offsets_buf);
+            std::copy(found_items.begin(), found_items.end(), items_buf);
+
+            *offsets = offsets_buf;
+            *items = items_buf;
+            return 1;
+        });
+    }
+
     const GEOSGeometry*
     GEOSSTRtree_nearest_r(GEOSContextHandle_t extHandle,
                           GEOSSTRtree* tree,
@@ -4759,6 +5407,145 @@ extern "C" {
         });
     }
 
+    GEOSDynamicSTRtree*
+    GEOSDynamicSTRtree_create_r(GEOSContextHandle_t extHandle,
+                                std::size_t nodeCapacity)
+    {
+        return execute(extHandle, [&]() {
+            return new GEOSDynamicSTRtree(nodeCapacity);
+        });
+    }
+
+    void
+    GEOSDynamicSTRtree_insert_r(GEOSContextHandle_t extHandle,
+                                GEOSDynamicSTRtree* tree,
+                                const Geometry* g,
+                                void* item)
+    {
+        execute(extHandle, [&]() {
+            tree->insert(g->getEnvelopeInternal(), item);
+        });
+    }
+
+    void
+    GEOSDynamicSTRtree_query_r(GEOSContextHandle_t extHandle,
+                               GEOSDynamicSTRtree* tree,
+                               const Geometry* g,
+                               GEOSQueryCallback callback,
+                               void* userdata)
+    {
+        execute(extHandle, [&]() {
+            CAPI_ItemVisitor visitor(callback, userdata);
+            tree->query(g->getEnvelopeInternal(), visitor);
+        });
+    }
+
+    void
+    GEOSDynamicSTRtree_iterate_r(GEOSContextHandle_t extHandle,
+                                 GEOSDynamicSTRtree* tree,
+                                 GEOSQueryCallback callback,
+                                 void* userdata)
+    {
+        return execute(extHandle, [&]() {
+            CAPI_ItemVisitor visitor(callback, userdata);
+            tree->iterate(visitor);
+        });
+    }
+
+    char
+    GEOSDynamicSTRtree_remove_r(GEOSContextHandle_t extHandle,
+                                GEOSDynamicSTRtree* tree,
+                                const Geometry* g,
+                                void* item)
+    {
+        return execute(extHandle, 2, [&]() {
+            return tree->remove(g->getEnvelopeInternal(), item);
+        });
+    }
+
+    void
+    GEOSDynamicSTRtree_destroy_r(GEOSContextHandle_t extHandle,
+                                 GEOSDynamicSTRtree* tree)
+    {
+        return execute(extHandle, [&]() {
+            delete tree;
+        });
+    }
+
+    int
+    GEOSSpatialJoin_r(GEOSContextHandle_t extHandle,
+                      const Geometry* const left[], std::size_t nleft,
+                      const Geometry* const right[], std::size_t nright,
+                      int predicate, double distance, const char* pattern,
+                      std::size_t** leftIndices, std::size_t** rightIndices,
+                      std::size_t* npairs)
+    {
+        using geos::operation::join::SpatialJoin;
+
+        return execute(extHandle, 0, [&]() {
+            std::vector<InputGeometry> inputs;
+            auto collect = [&extHandle, &inputs](const Geometry* const geoms[], std::size_t n) {
+                std::vector<const Geometry*> result(n);
+                for (std::size_t i = 0; i < n; i++) {
+                    if (geoms[i] != nullptr && extHandle->curveToLineParams.has_value()) {
+                        inputs.push_back(convertToLineIfNeeded(extHandle, geoms[i]));
+                        result[i] = inputs.back().get();
+                    } else {
+                        result[i] = geoms[i];
+                    }
+                }
+                return result;
+            };
+            std::vector<const Geometry*> leftGeoms = collect(left, nleft);
+            std::vector<const Geometry*> rightGeoms = collect(right, nright);
+
+            SpatialJoin sj(leftGeoms, rightGeoms);
+            sj.setTaskPool(extHandle->getTaskPool());
+
+            std::vector<SpatialJoin::IndexPair> pairs;
+            switch (predicate) {
+                case GEOS_JOIN_INTERSECTS:
+                    pairs = sj.intersects();
+                    break;
+                case GEOS_JOIN_CONTAINS:
+                    pairs = sj.contains();
+                    break;
+                case GEOS_JOIN_WITHIN:
+                    pairs = sj.within();
+                    break;
+                case GEOS_JOIN_DWITHIN:
+                    pairs = sj.isWithinDistance(distance);
+                    break;
+                case GEOS_JOIN_RELATE_PATTERN:
+                    if (pattern == nullptr) {
+                        throw IllegalArgumentException("GEOSSpatialJoin: pattern must not be NULL");
+                    }
+                    pairs = sj.relate(pattern);
+                    break;
+                default:
+                    throw IllegalArgumentException("GEOSSpatialJoin: unknown predicate");
+            }
+
+            std::size_t bufSize = std::max<std::size_t>(pairs.size(), 1) * sizeof(std::size_t);
+            auto* left_buf = static_cast<std::size_t*>(malloc(bufSize));
+            auto* right_buf = static_cast<std::size_t*>(malloc(bufSize));
+            if (left_buf == nullptr || right_buf == nullptr) {
+                free(left_buf);
+                free(right_buf);
+                throw std::bad_alloc();
+            }
+            for (std::size_t i = 0; i < pairs.size(); i++) {
+                left_buf[i] = pairs[i].first;
+                right_buf[i] = pairs[i].second;
+            }
+
+            *leftIndices = left_buf;
+            *rightIndices = right_buf;
+            *npairs = pairs.size();
+            return 1;
+        });
+    }
+
     double
     GEOSProject_r(GEOSContextHandle_t extHandle,
                   const Geometry* g,
@@ -5052,6 +5839,33 @@ extern "C" {
         });
     }
 
+    int
+    GEOSBufferWithParamsBatch_r(GEOSContextHandle_t extHandle,
+                                const Geometry* const* geoms, std::size_t n,
+                                const BufferParameters* bp, double width,
+                                Geometry** results)
+    {
+        using geos::operation::buffer::BufferOp;
+
+        return execute(extHandle, 0, [&]() {
+            std::vector<InputGeometry> inputs;
+            std::vector<const Geometry*> linear;
+            inputs.reserve(n);
+            linear.reserve(n);
+            for (std::size_t i = 0; i < n; i++) {
+                inputs.push_back(convertToLineIfNeeded(extHandle, geoms[i]));
+                linear.push_back(inputs.back().get());
+            }
+
+            auto buffers = BufferOp::bufferBatch(linear.data(), n, width, *bp, extHandle->getTaskPool());
+            for (std::size_t i = 0; i < n; i++) {
+                buffers[i]->setSRID(geoms[i]->getSRID());
+                results[i] = buffers[i].release();
+            }
+            return 1;
+        });
+    }
+
     Geometry*
     GEOSDelaunayTriangulation_r(GEOSContextHandle_t extHandle, const Geometry* g1, double tolerance, int onlyEdges)
     {
@@ -5161,6 +5975,7 @@ extern "C" {
 
             CoverageValidator cov(coverage);
             cov.setGapWidth(gapWidth);
+            cov.setTaskPool(extHandle->getTaskPool());
             std::vector<std::unique_ptr<Geometry>> invalid = cov.validate();
             bool hasInvalid = CoverageValidator::hasInvalidResult(invalid);
 
@@ -5199,6 +6014,7 @@ extern "C" {
                 coverage.push_back(g.get());
             }
             CoverageSimplifier cov(coverage);
+            cov.setTaskPool(extHandle->getTaskPool());
             std::vector<std::unique_ptr<Geometry>> simple;
             if (preserveBoundary == 1) {
                 simple = cov.simplifyInner(tolerance, &extHandle->progressFunction);
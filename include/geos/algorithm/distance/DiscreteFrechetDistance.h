@@ -390,6 +390,32 @@ public:
      */
     static double distance(const geom::Geometry& geom0, const geom::Geometry& geom1, double densityFrac);
 
+    /**
+     * Tests whether the Discrete Fréchet Distance between two Geometrys
+     * is at most a given distance.
+     *
+     * Only the pairs of points within the distance are visited,
+     * and the computation stops as soon as no coupling of the
+     * points can remain within it, so this is much faster than
+     * computing the distance when the geometries are far apart.
+     * Memory use is linear in the number of points.
+     *
+     * @param geom0 the 1st geometry
+     * @param geom1 the 2nd geometry
+     * @param maxDistance the distance to test
+     * @return true if the Discrete Fréchet Distance is at most maxDistance
+     */
+    static bool isWithinDistance(const geom::Geometry& geom0, const geom::Geometry& geom1, double maxDistance);
+
+    /**
+     * Tests whether the Discrete Fréchet Distance between the input geometries
+     * is at most a given distance, using the densify fraction if set.
+     *
+     * @param maxDistance the distance to test
+     * @return true if the Discrete Fréchet Distance is at most maxDistance
+     */
+    bool isWithinDistance(double maxDistance);
+
     /**
      * Gets the pair of {@link geom::Coordinate}s at which the distance is obtained.
      *
@@ -416,6 +442,48 @@ private:
     /* private */
     double distance();
 
+    /*
+     * Number of points of the longer input from which the distance
+     * is computed by computeFrechetBanded rather than with a matrix.
+     */
+    static constexpr std::size_t BANDED_MIN_SIZE = 1024;
+
+    /**
+     * Gets the coordinates of the input geometries, densified if required.
+     */
+    void getInputCoordinates(
+        std::unique_ptr<geom::CoordinateSequence>& coords0,
+        std::unique_ptr<geom::CoordinateSequence>& coords1) const;
+
+    /**
+     * Computes the Fréchet Distance row by row, keeping only two rows
+     * of the distance matrix. Only the cells which are closer than
+     * {@code maxDistance} and reachable from the start are computed,
+     * so the rows are scanned only over the band of reachable cells.
+     *
+     * @param coords0 an array of {@code Coordinate}s.
+     * @param coords1 an array of {@code Coordinate}s.
+     * @param maxDistance an upper bound for the distance
+     * @return the Fréchet Distance, or null if it exceeds maxDistance
+     */
+    static std::unique_ptr<PointPairDistance> computeFrechetBanded(
+        const geom::CoordinateSequence& coords0,
+        const geom::CoordinateSequence& coords1,
+        double maxDistance);
+
+    /**
+     * Computes the maximum point distance of a coupling of the sequences
+     * built by greedily advancing along the closest pair of points.
+     * This is an upper bound for the Fréchet Distance.
+     *
+     * @param coords0 an array of {@code Coordinate}s.
+     * @param coords1 an array of {@code Coordinate}s.
+     * @return an upper bound for the Fréchet Distance
+     */
+    static double greedyCouplingDistance(
+        const geom::CoordinateSequence& coords0,
+        const geom::CoordinateSequence& coords1);
+
     /*
      * Utility method to ape Java behaviour
      */
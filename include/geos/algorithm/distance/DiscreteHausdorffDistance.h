@@ -28,6 +28,7 @@
 #include <geos/geom/CoordinateSequenceFilter.h> // for inheritance
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -39,7 +40,10 @@ namespace geos {
 namespace geom {
 class Geometry;
 class Coordinate;
-//class CoordinateSequence;
+class CoordinateSequence;
+}
+namespace util {
+class TaskPool;
 }
 }
 
@@ -116,6 +120,16 @@ public:
      */
     void setDensifyFraction(double dFrac);
 
+    /**
+     * Sets the pool used to compute the distances of the points
+     * of large inputs in parallel. By default the computation
+     * runs on the calling thread.
+     */
+    void setTaskPool(util::TaskPool* pool)
+    {
+        taskPool = pool;
+    }
+
     double
     distance()
     {
@@ -228,6 +242,23 @@ private:
                                  const geom::Geometry& geom,
                                  PointPairDistance& ptDist);
 
+    /*
+     * Computes the oriented distance using a facet index of geom,
+     * skipping points that lie within the current maximum distance.
+     */
+    void computeOrientedDistanceIndexed(const geom::Geometry& discreteGeom,
+                                        const geom::Geometry& geom,
+                                        PointPairDistance& ptDist);
+
+    std::unique_ptr<geom::CoordinateSequence> getQueryPoints(const geom::Geometry& discreteGeom) const;
+
+    // Number of points of the target geometry above which
+    // distances are computed using a facet index
+    static constexpr std::size_t INDEX_MIN_POINTS = 64;
+
+    // Number of points processed by a parallel task
+    static constexpr std::size_t PARALLEL_GRAIN_SIZE = 1024;
+
     const geom::Geometry& g0;
 
     const geom::Geometry& g1;
@@ -237,6 +268,8 @@ private:
     /// Value of 0.0 indicates that no densification should take place
     double densifyFrac; // = 0.0;
 
+    util::TaskPool* taskPool = nullptr;
+
     // Declare type as noncopyable
     DiscreteHausdorffDistance(const DiscreteHausdorffDistance& other) = delete;
     DiscreteHausdorffDistance& operator=(const DiscreteHausdorffDistance& rhs) = delete;
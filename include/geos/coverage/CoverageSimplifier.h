@@ -31,6 +31,9 @@ class MultiLineString;
 namespace coverage {
 class CoverageEdge;
 }
+namespace util {
+class TaskPool;
+}
 }
 
 namespace geos {
@@ -82,6 +85,19 @@ public:
     */
     CoverageSimplifier(const std::vector<const Geometry*>& coverage);
 
+    /**
+    * Sets a pool of threads used to simplify the edges of large
+    * coverages. Edges which do not interact are simplified
+    * concurrently, in an order which gives the same result as
+    * simplifying on the calling thread.
+    *
+    * @param pool the pool to use, or nullptr to simplify on the calling thread
+    */
+    void setTaskPool(geos::util::TaskPool* pool)
+    {
+        m_taskPool = pool;
+    }
+
     /**
     * Simplifies the boundaries of a set of polygonal geometries forming a coverage,
     * preserving the coverage topology.
@@ -149,6 +165,7 @@ private:
     // Members
     const std::vector<const Geometry*>& m_input;
     const GeometryFactory* m_geomFactory;
+    geos::util::TaskPool* m_taskPool = nullptr;
 
     // Methods
     void simplifyEdges(
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/util/TaskPool.h>
 
 
 // Forward declarations
@@ -66,12 +67,16 @@ class GEOS_DLL CoverageValidator {
 
 private:
 
+    // Number of consecutive polygons validated by a task
+    static constexpr std::size_t VALIDATE_GRAIN_SIZE = 16;
+
     std::vector<const Geometry*>& m_coverage;
     double m_gapWidth = 0.0;
+    util::TaskPool* m_taskPool = nullptr;
 
     std::unique_ptr<Geometry> validate(
         const Geometry* targetGeom,
-        TemplateSTRtree<const Geometry*>& index);
+        TemplateSTRtree<const Geometry*>& index) const;
 
 
 public:
@@ -94,6 +99,17 @@ public:
         m_gapWidth = gapWidth;
     };
 
+    /**
+    * Sets a pool of threads used to validate the polygons
+    * concurrently. Each polygon is checked against its neighbours
+    * independently, so the result does not depend on the pool.
+    *
+    * @param pool the pool to use, or null to validate on the calling thread
+    */
+    void setTaskPool(util::TaskPool* pool) {
+        m_taskPool = pool;
+    };
+
     /**
     * Validates the polygonal coverage.
     * The result is an array of the same size as the input coverage.
@@ -34,6 +34,9 @@ class GeometryFactory;
 class LineString;
 class MultiLineString;
 }
+namespace util {
+class TaskPool;
+}
 }
 
 namespace geos {
@@ -185,6 +188,7 @@ public:
     * @param constraintLines the linear constraints
     * @param distanceTolerance the simplification tolerance
     * @param progressFunction Progress function, or nullptr.
+    * @param taskPool pool used to simplify large inputs in parallel, or nullptr.
     * @return the simplified lines
     */
     static std::unique_ptr<MultiLineString> simplify(
@@ -192,21 +196,42 @@ public:
         std::vector<bool>& freeRings,
         const MultiLineString* constraintLines,
         double distanceTolerance,
-        geos::util::ProgressFunction* progressFunction);
+        geos::util::ProgressFunction* progressFunction,
+        geos::util::TaskPool* taskPool = nullptr);
 
     // Constructor
     TPVWSimplifier(const MultiLineString* lines,
         double distanceTolerance);
 
+    /**
+    * Sets a pool of threads used to simplify large inputs.
+    *
+    * Lines are grouped in levels, each line in the level above those
+    * of the preceding lines whose envelopes intersect its envelope.
+    * The lines of a level do not interact, so they are simplified
+    * in parallel, and simplifying the levels in order gives the
+    * same result as the sequential algorithm.
+    *
+    * @param pool the pool to use, or nullptr to simplify sequentially
+    */
+    void setTaskPool(geos::util::TaskPool* pool);
+
 
 private:
 
+    // Minimum number of lines simplified in parallel
+    static constexpr std::size_t MIN_PARALLEL_EDGES = 1000;
+
+    // Number of consecutive lines handled by a task
+    static constexpr std::size_t PARALLEL_GRAIN_SIZE = 16;
+
     // Members
     const MultiLineString* inputLines;
     std::vector<bool> isFreeRing;
     double areaTolerance;
     const GeometryFactory* geomFactory;
     const MultiLineString* constraintLines;
+    geos::util::TaskPool* taskPool;
 
 
     // Methods
@@ -216,6 +241,11 @@ private:
 
     std::unique_ptr<MultiLineString> simplify(geos::util::ProgressFunction* progressFunction);
 
+    std::vector<std::unique_ptr<CoordinateSequence>> simplifyInLevels(
+        std::vector<Edge>& edges,
+        EdgeIndex& edgeIndex,
+        geos::util::ProgressFunction* progressFunction);
+
     std::vector<Edge> createEdges(
         const MultiLineString* lines,
         std::vector<bool>& freeRing,
@@ -0,0 +1,187 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/io/WKBWriter.h>
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+}
+namespace io {
+class WKBStreamReader;
+}
+}
+
+namespace geos {      // geos
+namespace coverage { // geos::coverage
+
+/**
+ * Unions a polygonal coverage which is too large to be held in memory.
+ *
+ * Polygons are added one at a time, and are assigned to the tiles
+ * of a regular grid over a given extent by the centre of their envelope.
+ * They are held as WKB, including any Z, M and SRID. If a spill stream
+ * has been set, the buffered data is written to it whenever it exceeds
+ * a memory limit. Without a spill stream, all the added polygons are
+ * kept in memory as WKB.
+ *
+ * The union is computed tile by tile, and the tile results are
+ * merged a quadrant at a time. Since the union of a subset of a valid
+ * coverage is formed from segments of the original polygons,
+ * the tile results themselves form a valid coverage, and are merged
+ * with a coverage union. When a spill stream is used, only the input
+ * of a single tile and the partial results of the merge are held as
+ * geometries at any time.
+ *
+ * The extent only determines how polygons are grouped. Polygons
+ * lying outside it are assigned to the nearest tile, so the result
+ * is correct for any extent, but is most efficient when the extent
+ * covers the input and tiles hold a moderate number of polygons.
+ *
+ * The input must be a valid polygonal coverage,
+ * as for CoverageUnion.
+ */
+class GEOS_DLL TiledCoverageUnion {
+    using Envelope = geos::geom::Envelope;
+    using Geometry = geos::geom::Geometry;
+    using GeometryFactory = geos::geom::GeometryFactory;
+
+public:
+
+    static constexpr std::size_t DEFAULT_MEMORY_LIMIT = 256 * 1024 * 1024;
+
+    /**
+    * Creates a tiled union over a grid of gridSize by gridSize tiles.
+    *
+    * @param extent the extent of the coverage
+    * @param gridSize the number of tiles along each side of the grid
+    */
+    TiledCoverageUnion(const Envelope& extent, std::size_t gridSize);
+
+    /**
+    * Sets a stream to which buffered polygons are written when
+    * they exceed the memory limit. The stream must be opened for
+    * binary input and output, and must remain valid until the result
+    * has been computed. If no stream is set all polygons are kept
+    * in memory.
+    *
+    * @param stream the spill stream, or nullptr
+    */
+    void setSpillStream(std::iostream* stream)
+    {
+        spillStream = stream;
+    }
+
+    /**
+    * Sets the number of bytes of polygon data buffered in memory
+    * before it is written to the spill stream.
+    *
+    * @param bytes the memory limit
+    */
+    void setMemoryLimit(std::size_t bytes)
+    {
+        memoryLimit = bytes;
+    }
+
+    /**
+    * Adds a polygon or multipolygon of the coverage.
+    * Empty geometries are ignored.
+    *
+    * @param geom the polygonal geometry to add
+    */
+    void add(const Geometry& geom);
+
+    /**
+    * Adds all geometries read from a stream.
+    *
+    * @param reader the reader to consume
+    * @return the number of geometries read
+    */
+    std::size_t add(io::WKBStreamReader& reader);
+
+    /**
+    * Computes the union of the added polygons.
+    * The buffered polygons are released as the union is computed,
+    * so this can be called only once.
+    *
+    * @return the union of the coverage
+    *
+    * @throws util::TopologyException in some cases if the coverage is invalid
+    */
+    std::unique_ptr<Geometry> getResult();
+
+    /**
+    * Unions the polygonal coverage read from a stream.
+    *
+    * @param reader the reader supplying the polygons
+    * @param extent the extent of the coverage
+    * @param gridSize the number of tiles along each side of the grid
+    * @param spillStream a stream to spill polygons to, or nullptr
+    * @return the union of the coverage
+    */
+    static std::unique_ptr<Geometry> Union(
+        io::WKBStreamReader& reader,
+        const Envelope& extent,
+        std::size_t gridSize,
+        std::iostream* spillStream = nullptr);
+
+private:
+
+    struct Chunk {
+        std::uint64_t offset;
+        std::size_t size;
+    };
+
+    Envelope extent;
+    std::size_t gridSize;
+    std::iostream* spillStream = nullptr;
+    std::size_t memoryLimit = DEFAULT_MEMORY_LIMIT;
+    const GeometryFactory* factory = nullptr;
+    bool isComputed = false;
+
+    io::WKBWriter writer;
+    std::size_t bufferedSize = 0;
+    std::vector<std::vector<unsigned char>> tileData;
+    std::vector<std::vector<Chunk>> tileChunks;
+
+    std::size_t tileIndex(const Envelope& env) const;
+
+    std::size_t gridIndex(double v, double min, double width) const;
+
+    void spill();
+
+    std::unique_ptr<Geometry> unionTile(std::size_t tile);
+
+    std::unique_ptr<Geometry> unionRange(
+        std::size_t x0, std::size_t x1,
+        std::size_t y0, std::size_t y1);
+
+    std::unique_ptr<Geometry> unionParts(
+        std::vector<std::unique_ptr<Geometry>>& parts) const;
+
+};
+
+} // namespace geos::coverage
+} // namespace geos
@@ -0,0 +1,104 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+
+namespace geos {
+namespace geom { // geos::geom
+
+/**
+ * \class CoordinateKernels
+ *
+ * \brief Bulk computations over the interleaved ordinates of a
+ * CoordinateSequence, using SIMD instructions where available.
+ *
+ * Each function takes a pointer to the ordinates of the first
+ * coordinate, the number of coordinates `n` and the number of
+ * ordinates per coordinate `stride` (2, 3 or 4). Only the X and Y
+ * ordinates are read or written.
+ *
+ * The instruction set is selected at runtime: SSE2 or AVX2 on x86-64
+ * (AVX2 requires GCC or Clang), NEON on ARM64, and portable scalar
+ * code otherwise. All instruction sets give bit-identical results.
+ * envelope(), maxRisingY() and affine() give the same results as a
+ * simple loop over the coordinates. signedArea() and length() add
+ * their terms into four interleaved partial sums, which may differ
+ * from a single running sum in the last bits. For this reason
+ * algorithm::Area and algorithm::Length keep their single running sum,
+ * and these two kernels are only used by callers that opt in.
+ */
+class GEOS_DLL CoordinateKernels {
+
+public:
+
+    enum class InstructionSet {
+        SCALAR,
+        SSE2,
+        AVX2,
+        NEON
+    };
+
+    /// Returns the instruction set currently used.
+    static InstructionSet getInstructionSet();
+
+    /// Tests whether an instruction set can be used on this machine.
+    static bool isSupported(InstructionSet is);
+
+    /**
+     * Sets the instruction set to use, for testing and benchmarking.
+     *
+     * @return false if the instruction set is not supported
+     */
+    static bool setInstructionSet(InstructionSet is);
+
+    /**
+     * Computes the X and Y extent of the coordinates. NaN ordinates
+     * are ignored. Extents of an empty or all-NaN input are
+     * infinite with min > max.
+     */
+    static void envelope(const double* v, std::size_t n, std::size_t stride,
+                         double& minx, double& maxx, double& miny, double& maxy);
+
+    /**
+     * Computes the signed area of a closed ring by the Shoelace formula,
+     * positive if the ring is clockwise.
+     */
+    static double signedArea(const double* v, std::size_t n, std::size_t stride);
+
+    /// Computes the length of the line through the coordinates.
+    static double length(const double* v, std::size_t n, std::size_t stride);
+
+    /**
+     * Returns the maximum Y of the coordinates that are higher than
+     * the coordinate before them, or -infinity if there are none.
+     */
+    static double maxRisingY(const double* v, std::size_t n, std::size_t stride);
+
+    /**
+     * Applies the affine transformation
+     * `x' = a * x + b * y + xoff`, `y' = d * x + e * y + yoff`
+     * to the coordinates in place.
+     */
+    static void affine(double* v, std::size_t n, std::size_t stride,
+                       double a, double b, double d, double e,
+                       double xoff, double yoff);
+
+};
+
+} // namespace geos::geom
+} // namespace geos
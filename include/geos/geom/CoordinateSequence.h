@@ -120,6 +120,43 @@ public:
      */
     CoordinateSequence(const std::initializer_list<CoordinateXYZM>&);
 
+    /**
+     * Create a CoordinateSequence that reads its coordinates directly from
+     * a caller-owned buffer of interleaved ordinates, without copying them.
+     *
+     * The buffer is never written to. Any operation that modifies the
+     * sequence first copies the coordinates into storage owned by the
+     * sequence, as does copying or cloning it. The buffer must remain valid
+     * and unchanged for as long as this sequence (or any sequence moved
+     * from it) still borrows it; see isBorrowed().
+     *
+     * Only layouts for which canBorrow() is true may be borrowed. Currently
+     * these are XYZ and XYZM, since XY and XYM sequences are stored padded
+     * with a Z value.
+     *
+     * @param buf buffer of `size * (2 + hasz + hasm)` ordinates
+     * @param size number of coordinates in the buffer
+     * @param hasz true if the buffer contains Z values
+     * @param hasm true if the buffer contains M values
+     * @throws util::IllegalArgumentException if the layout cannot be borrowed
+     */
+    static CoordinateSequence borrow(const double* buf, std::size_t size, bool hasz, bool hasm);
+
+    /**
+     * Returns true if a sequence with the given dimensions stores its
+     * coordinates in the same interleaved layout as a buffer of
+     * `2 + hasz + hasm` ordinates per coordinate, so that it can borrow it.
+     */
+    static bool canBorrow(bool hasz, bool hasm);
+
+    CoordinateSequence(const CoordinateSequence& other);
+
+    CoordinateSequence(CoordinateSequence&& other) noexcept = default;
+
+    CoordinateSequence& operator=(const CoordinateSequence& other);
+
+    CoordinateSequence& operator=(CoordinateSequence&& other) noexcept = default;
+
     /**
      * Create a CoordinateSequence storing XY values only.
      *
@@ -186,15 +223,21 @@ public:
     {
         assert(stride() == 2 || stride() == 3 || stride() == 4);
         switch(stride()) {
-            case 2: return m_vect.size() / 2;
-            case 4: return m_vect.size() / 4;
-            default : return m_vect.size() / 3;
+            case 2: return numOrdinates() / 2;
+            case 4: return numOrdinates() / 4;
+            default : return numOrdinates() / 3;
         }
     }
 
     /// Returns <code>true</code> if list contains no coordinates.
     bool isEmpty() const {
-        return m_vect.empty();
+        return numOrdinates() == 0;
+    }
+
+    /// Returns <code>true</code> if the coordinates are read from a
+    /// caller-owned buffer (see borrow()) rather than owned by the sequence.
+    bool isBorrowed() const {
+        return m_borrowed != nullptr;
     }
 
     /** \brief
@@ -214,7 +257,7 @@ public:
     std::size_t getDimension() const;
 
     bool hasZ() const {
-        return m_hasdim ? m_hasz : (m_vect.empty() || !std::isnan(m_vect[2]));
+        return m_hasdim ? m_hasz : (isEmpty() || !std::isnan(ordinates()[2]));
     }
 
     bool hasM() const {
@@ -256,8 +299,8 @@ public:
     const T& getAt(std::size_t i) const {
         static_assert(std::is_base_of<CoordinateXY, T>::value, "Must be a Coordinate class");
         assert(sizeof(T) <= sizeof(double) * stride());
-        assert(i*stride() < m_vect.size());
-        const T* orig = reinterpret_cast<const T*>(&m_vect[i*stride()]);
+        assert(i*stride() < numOrdinates());
+        const T* orig = reinterpret_cast<const T*>(ordinates() + i*stride());
         return *orig;
     }
 
@@ -268,6 +311,7 @@ public:
     T& getAt(std::size_t i) {
         static_assert(std::is_base_of<CoordinateXY, T>::value, "Must be a Coordinate class");
         assert(sizeof(T) <= sizeof(double) * stride());
+        ensureOwned();
         assert(i*stride() < m_vect.size());
         T* orig = reinterpret_cast<T*>(&m_vect[i*stride()]);
         return *orig;
@@ -330,7 +374,7 @@ public:
      */
     double getX(std::size_t index) const
     {
-        return m_vect[index * stride()];
+        return ordinates()[index * stride()];
     }
 
     /**
@@ -341,7 +385,7 @@ public:
      */
     double getY(std::size_t index) const
     {
-        return m_vect[index * stride() + 1];
+        return ordinates()[index * stride() + 1];
     }
 
     /**
@@ -376,6 +420,7 @@ public:
      */
     void setX(std::size_t index, double x)
     {
+        ensureOwned();
         m_vect[index * stride()] = x;
     }
 
@@ -387,6 +432,7 @@ public:
      */
     void setY(std::size_t index, double y)
     {
+        ensureOwned();
         m_vect[index * stride() + 1] = y;
     }
 
@@ -436,13 +482,14 @@ public:
     template<typename T=Coordinate>
     const T& front() const
     {
-        return *(reinterpret_cast<const T*>(m_vect.data()));
+        return *(reinterpret_cast<const T*>(ordinates()));
     }
 
     /// Return first Coordinate in the sequence
     template<typename T=Coordinate>
     T& front()
     {
+        ensureOwned();
         return *(reinterpret_cast<T*>(m_vect.data()));
     }
 
@@ -531,6 +578,7 @@ public:
 
         // c may be a reference inside m_vect, so we make sure it will not
         // grow before adding it
+        ensureOwned();
         if (m_vect.size() + stride() <= m_vect.capacity()) {
             make_space(pos, 1);
             setAt(c, static_cast<std::size_t>(pos));
@@ -615,14 +663,18 @@ public:
     /// @{
 
     void clear() {
+        m_borrowed = nullptr;
+        m_borrowedSize = 0;
         m_vect.clear();
     }
 
     void reserve(std::size_t capacity) {
+        ensureOwned();
         m_vect.reserve(capacity * stride());
     }
 
     void resize(std::size_t capacity) {
+        ensureOwned();
         m_vect.resize(capacity * stride());
     }
 
@@ -873,16 +925,25 @@ public:
     /// @}
 
     double* data() {
+        ensureOwned();
         return m_vect.data();
     }
 
     const double* data() const {
-        return m_vect.data();
+        return ordinates();
+    }
+
+    /// Returns the number of values stored for each coordinate in data() (2, 3 or 4)
+    std::uint8_t stride() const {
+        return m_stride;
     }
 
 private:
     std::vector<double> m_vect; // Vector to store values
 
+    const double* m_borrowed = nullptr; // Caller-owned values, used instead of m_vect if set
+    std::size_t m_borrowedSize = 0;     // Number of values in m_borrowed
+
     uint8_t m_stride;           // Stride of stored values, corresponding to underlying type
 
     mutable bool m_hasdim;      // Has the dimension of this sequence been determined? Or was it created with no
@@ -893,6 +954,23 @@ private:
 
     void initialize();
 
+    const double* ordinates() const {
+        return m_borrowed ? m_borrowed : m_vect.data();
+    }
+
+    std::size_t numOrdinates() const {
+        return m_borrowed ? m_borrowedSize : m_vect.size();
+    }
+
+    /// Copies borrowed values into m_vect so that they can be modified
+    void ensureOwned() {
+        if (m_borrowed) {
+            m_vect.assign(m_borrowed, m_borrowed + m_borrowedSize);
+            m_borrowed = nullptr;
+            m_borrowedSize = 0;
+        }
+    }
+
     template<typename T1, typename T2>
     void setAtImpl(const T2& c, std::size_t pos) {
         auto& orig = getAt<T1>(pos);
@@ -918,15 +996,12 @@ private:
     }
 
     void make_space(std::size_t pos, std::size_t n) {
+        ensureOwned();
         m_vect.insert(std::next(m_vect.begin(), static_cast<std::ptrdiff_t>(pos * stride())),
                       m_stride * n,
                       DoubleNotANumber);
     }
 
-    std::uint8_t stride() const {
-        return m_stride;
-    }
-
 };
 
 GEOS_DLL std::ostream& operator<< (std::ostream& os, const CoordinateSequence& cs);
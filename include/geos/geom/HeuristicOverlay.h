@@ -33,6 +33,11 @@ namespace geom {
 class Geometry;
 class GeometryFactory;
 }
+namespace operation {
+namespace overlayng {
+class OverlayContext;
+}
+}
 }
 
 
@@ -42,6 +47,15 @@ namespace geom { // geos::geom
 std::unique_ptr<Geometry> GEOS_DLL
 HeuristicOverlay(const Geometry* g0, const Geometry* g1, int opCode);
 
+/**
+ * Computes an overlay as HeuristicOverlay(g0, g1, opCode) does,
+ * reusing the working storage of an OverlayNG context when the
+ * inputs are handled by OverlayNG directly.
+ */
+std::unique_ptr<Geometry> GEOS_DLL
+HeuristicOverlay(const Geometry* g0, const Geometry* g1, int opCode,
+                 operation::overlayng::OverlayContext* context);
+
 class StructuredCollection {
 
 public:
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <vector>
 #include <memory>
 #include <string>
@@ -31,6 +33,9 @@ namespace geos {
         class CoordinateSequence;
         class IntersectionMatrix;
     }
+    namespace util {
+        class TaskPool;
+    }
 }
 
 
@@ -251,6 +256,67 @@ public:
      */
     virtual bool relate(const geom::Geometry* geom, const std::string& pat) const = 0;
 
+    /** \brief
+     * Tests whether the base {@link Geometry} contains each of a set of points.
+     *
+     * If a pool is provided the points are evaluated concurrently.
+     * Indexes that cannot safely be shared between threads are
+     * built separately by each thread.
+     *
+     * @param x array of `n` X values
+     * @param y array of `n` Y values
+     * @param n the number of points
+     * @param result array of `n` values, set to 1 if the base Geometry
+     *               contains the point and 0 otherwise
+     * @param pool pool on which to evaluate the points, or null
+     */
+    virtual void containsXY(const double* x, const double* y, std::size_t n,
+                            unsigned char* result, geos::util::TaskPool* pool) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} intersects each of a set of points.
+     *
+     * @see containsXY
+     */
+    virtual void intersectsXY(const double* x, const double* y, std::size_t n,
+                              unsigned char* result, geos::util::TaskPool* pool) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} contains each of an array
+     * of geometries.
+     *
+     * If a pool is provided the geometries are evaluated concurrently,
+     * each thread using its own prepared copy of the base Geometry.
+     *
+     * @param geoms array of `n` geometries to test
+     * @param n the number of geometries
+     * @param result array of `n` values, set to 1 if the base Geometry
+     *               contains the geometry and 0 otherwise
+     * @param pool pool on which to evaluate the geometries, or null
+     */
+    void containsEach(const geom::Geometry* const* geoms, std::size_t n,
+                      unsigned char* result, geos::util::TaskPool* pool) const;
+
+    /** \brief
+     * Tests whether the base {@link Geometry} intersects each of an array
+     * of geometries.
+     *
+     * @see containsEach
+     */
+    void intersectsEach(const geom::Geometry* const* geoms, std::size_t n,
+                        unsigned char* result, geos::util::TaskPool* pool) const;
+
+protected:
+
+    /**
+     * Calls `f(prep, start, end)` over contiguous ranges covering `[0, n)`.
+     * Without a pool, `prep` is this object and the range is `[0, n)`.
+     * Otherwise, each range is processed by a task of the pool with a
+     * separately prepared copy of the base Geometry.
+     */
+    void forEachRange(std::size_t n, geos::util::TaskPool* pool,
+                      const std::function<void(const PreparedGeometry&, std::size_t, std::size_t)>& f) const;
+
 };
 
 
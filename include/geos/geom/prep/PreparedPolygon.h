@@ -57,6 +57,16 @@ private:
     mutable noding::SegmentString::ConstVect segStrings;
     mutable std::unique_ptr<operation::distance::IndexedFacetDistance> indexedDistance;
 
+    /**
+     * Gets an indexed point locator whose index has been built, so
+     * that it may be used from several threads at once.
+     */
+    algorithm::locate::PointOnGeometryLocator* getIndexedPointLocator() const;
+
+    template<typename F>
+    void locateXY(const double* x, const double* y, std::size_t n,
+                  unsigned char* result, geos::util::TaskPool* pool, F&& locationTest) const;
+
 protected:
 public:
     PreparedPolygon(const geom::Geometry* geom);
@@ -73,6 +83,16 @@ public:
     double distance(const geom::Geometry* g) const override;
     bool isWithinDistance(const geom::Geometry* g, double d) const override;
 
+    /**
+     * Tests points against a single shared point-in-area index, which
+     * is read-only once built and does not need to be copied per thread.
+     */
+    void containsXY(const double* x, const double* y, std::size_t n,
+                    unsigned char* result, geos::util::TaskPool* pool) const override;
+
+    void intersectsXY(const double* x, const double* y, std::size_t n,
+                      unsigned char* result, geos::util::TaskPool* pool) const override;
+
 };
 
 } // namespace geos::geom::prep
@@ -0,0 +1,365 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace index {
+namespace strtree {
+
+/**
+ * \brief
+ * An R-tree which supports inserting and removing items at any time,
+ * built from a set of packed STR trees.
+ *
+ * New items are appended to a small unindexed buffer. When the buffer
+ * is full its items are packed into a TemplateSTRtree. Trees are kept
+ * in levels of roughly doubling size: a new tree is merged with the
+ * trees of the lowest levels until it reaches an empty level, as in a
+ * binary counter. Each item is therefore repacked O(log n) times,
+ * while a query visits the buffer and O(log n) packed trees.
+ *
+ * Removed items are marked as deleted in their tree. A level in which
+ * more than half the items have been removed is repacked, and removed
+ * items are dropped whenever levels are merged.
+ *
+ * The query interface is the same as that of TemplateSTRtree, and the
+ * same BoundsTraits are used. Queries may run concurrently with each
+ * other, but not with insertions or removals.
+ */
+template<typename ItemType, typename BoundsTraits>
+class DynamicSTRtreeImpl {
+public:
+    using Tree = TemplateSTRtreeImpl<ItemType, BoundsTraits>;
+    using Node = typename Tree::Node;
+    using BoundsType = typename BoundsTraits::BoundsType;
+
+    static constexpr std::size_t DEFAULT_BUFFER_CAPACITY = 256;
+
+    /// \defgroup construct Constructors
+    /// @{
+
+    /**
+     * Constructs a tree with the given maximum number of child nodes that
+     * a node may have, and the given number of items held in the
+     * unindexed buffer.
+     */
+    explicit DynamicSTRtreeImpl(std::size_t p_nodeCapacity = 10,
+                                std::size_t p_bufferCapacity = DEFAULT_BUFFER_CAPACITY) :
+        nodeCapacity(p_nodeCapacity),
+        bufferCapacity(std::max<std::size_t>(p_bufferCapacity, 1)),
+        numItems(0)
+    {
+        if (nodeCapacity < 2) {
+            throw util::IllegalArgumentException("STRTree node capacity must be >= 2");
+        }
+        buffer.reserve(bufferCapacity);
+    }
+
+    /// @}
+    /// \defgroup insert Insertion
+    /// @{
+
+    /** Move the given item into the tree */
+    void insert(ItemType&& item) {
+        insert(BoundsTraits::fromItem(item), std::forward<ItemType>(item));
+    }
+
+    /** Insert a copy of the given item into the tree */
+    void insert(const ItemType& item) {
+        insert(BoundsTraits::fromItem(item), item);
+    }
+
+    /** Move the given item into the tree */
+    void insert(const BoundsType& itemEnv, ItemType&& item) {
+        if (!BoundsTraits::isNull(itemEnv)) {
+            buffer.emplace_back(std::forward<ItemType>(item), itemEnv);
+            itemAdded();
+        }
+    }
+
+    /** Insert a copy of the given item into the tree */
+    void insert(const BoundsType& itemEnv, const ItemType& item) {
+        if (!BoundsTraits::isNull(itemEnv)) {
+            buffer.emplace_back(item, itemEnv);
+            itemAdded();
+        }
+    }
+
+    /// @}
+    /// \defgroup query Query
+    /// @{
+
+    // Query the tree using the specified visitor. The visitor must be callable
+    // either with a single argument of `const ItemType&` or with the
+    // arguments `(const BoundsType&, const ItemType&).
+    // The visitor need not return a value, but if it does return a value,
+    // false values will be taken as a signal to stop the query.
+    template<typename Visitor>
+    void query(const BoundsType& queryEnv, Visitor&& visitor) {
+        for (const Node& node : buffer) {
+            if (node.boundsIntersect(queryEnv) && !Tree::visitLeaf(visitor, node)) {
+                return;
+            }
+        }
+
+        for (auto& level : levels) {
+            if (level.tree && !queryTree(*level.tree, queryEnv, visitor)) {
+                return;
+            }
+        }
+    }
+
+    // Query the tree and collect items in the provided vector.
+    void query(const BoundsType& queryEnv, std::vector<ItemType>& results) {
+        query(queryEnv, [&results](const ItemType& x) {
+            results.push_back(x);
+        });
+    }
+
+    /**
+     * Iterate over all items in the tree.
+     */
+    template<typename F>
+    void iterate(F&& func) {
+        for (const Node& node : buffer) {
+            func(node.getItem());
+        }
+        for (auto& level : levels) {
+            if (level.tree) {
+                level.tree->iterate(func);
+            }
+        }
+    }
+
+    /// @}
+    /// \defgroup remove Item removal
+    /// @{
+
+    /**
+     * Removes an item from the tree.
+     *
+     * @param itemEnv the bounds of the item
+     * @param item the item to remove
+     * @return true if the item was found and removed
+     */
+    bool remove(const BoundsType& itemEnv, const ItemType& item) {
+        for (std::size_t i = 0; i < buffer.size(); i++) {
+            if (buffer[i].getItem() == item) {
+                if (i + 1 < buffer.size()) {
+                    buffer[i] = std::move(buffer.back());
+                }
+                buffer.pop_back();
+                numItems--;
+                return true;
+            }
+        }
+
+        for (std::size_t i = 0; i < levels.size(); i++) {
+            Level& level = levels[i];
+            if (level.tree && level.tree->remove(itemEnv, item)) {
+                numItems--;
+                level.numDeleted++;
+                if (2 * level.numDeleted > level.tree->numItems) {
+                    std::vector<Node> leaves;
+                    collectLeaves(level, leaves);
+                    level.tree = createTree(leaves);
+                    level.numDeleted = 0;
+                }
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// @}
+    /// \defgroup introspect Introspection
+    /// @{
+
+    /** Returns the number of items in the tree. */
+    std::size_t size() const {
+        return numItems;
+    }
+
+    /** Returns the number of packed trees currently holding items. */
+    std::size_t getNumTrees() const {
+        std::size_t n = 0;
+        for (const auto& level : levels) {
+            if (level.tree) {
+                n++;
+            }
+        }
+        return n;
+    }
+
+    /// @}
+
+    /**
+     * Packs all items into a single tree, to give the fastest queries
+     * once no more updates are expected.
+     */
+    void compact() {
+        std::vector<Node> leaves(std::make_move_iterator(buffer.begin()),
+                                 std::make_move_iterator(buffer.end()));
+        buffer.clear();
+        for (auto& level : levels) {
+            collectLeaves(level, leaves);
+        }
+        levels.clear();
+
+        if (!leaves.empty()) {
+            std::size_t k = 0;
+            while ((bufferCapacity << k) < leaves.size()) {
+                k++;
+            }
+            levels.resize(k + 1);
+            levels[k].tree = createTree(leaves);
+        }
+    }
+
+private:
+
+    struct Level {
+        std::unique_ptr<Tree> tree;
+        std::size_t numDeleted = 0;
+    };
+
+    std::size_t nodeCapacity;
+    std::size_t bufferCapacity;
+    std::size_t numItems;
+    std::vector<Node> buffer;   //**< items not yet packed into a tree */
+    std::vector<Level> levels;  //**< level k holds about bufferCapacity * 2^k items, or none */
+
+    void itemAdded() {
+        numItems++;
+        if (buffer.size() >= bufferCapacity) {
+            flush();
+        }
+    }
+
+    // Packs the buffer into a tree, merging it with the trees of
+    // the lowest consecutive occupied levels.
+    void flush() {
+        std::vector<Node> leaves(std::make_move_iterator(buffer.begin()),
+                                 std::make_move_iterator(buffer.end()));
+        buffer.clear();
+
+        std::size_t k = 0;
+        while (k < levels.size() && levels[k].tree) {
+            collectLeaves(levels[k], leaves);
+            k++;
+        }
+        if (k == levels.size()) {
+            levels.emplace_back();
+        }
+        if (!leaves.empty()) {
+            levels[k].tree = createTree(leaves);
+        }
+    }
+
+    // Moves the items which have not been removed out of a level.
+    static void collectLeaves(Level& level, std::vector<Node>& leaves) {
+        if (!level.tree) {
+            return;
+        }
+        const Tree& tree = *level.tree;
+        for (std::size_t i = 0; i < tree.numItems; i++) {
+            const Node& node = tree.nodes[i];
+            if (!node.isDeleted()) {
+                leaves.emplace_back(node.getItem(), node.getBounds());
+            }
+        }
+        level.tree.reset();
+        level.numDeleted = 0;
+    }
+
+    std::unique_ptr<Tree> createTree(std::vector<Node>& leaves) const {
+        if (leaves.empty()) {
+            return nullptr;
+        }
+        std::unique_ptr<Tree> tree(new Tree(nodeCapacity, leaves.size()));
+        for (const Node& node : leaves) {
+            tree->insert(node.getBounds(), node.getItem());
+        }
+        leaves.clear();
+        tree->build();
+        return tree;
+    }
+
+    // Queries a single tree, returning false if the visitor ended the query.
+    template<typename Visitor>
+    static bool queryTree(Tree& tree, const BoundsType& queryEnv, Visitor&& visitor) {
+        const Node* root = tree.root;
+        if (root == nullptr || !root->boundsIntersect(queryEnv)) {
+            return true;
+        }
+        if (root->isLeaf()) {
+            return root->isDeleted() || Tree::visitLeaf(visitor, *root);
+        }
+        return tree.query(queryEnv, *root, visitor);
+    }
+};
+
+
+template<typename ItemType, typename BoundsTraits = EnvelopeTraits>
+class DynamicSTRtree : public DynamicSTRtreeImpl<ItemType, BoundsTraits> {
+public:
+    using DynamicSTRtreeImpl<ItemType, BoundsTraits>::DynamicSTRtreeImpl;
+};
+
+// When ItemType is a pointer and our bounds are geom::Envelope, adopt
+// the SpatialIndex interface which requires queries via an envelope
+// and items to be representable as void*.
+template<typename ItemType>
+class DynamicSTRtree<ItemType*, EnvelopeTraits> : public DynamicSTRtreeImpl<ItemType*, EnvelopeTraits>, public SpatialIndex {
+public:
+    using DynamicSTRtreeImpl<ItemType*, EnvelopeTraits>::DynamicSTRtreeImpl;
+    using DynamicSTRtreeImpl<ItemType*, EnvelopeTraits>::insert;
+    using DynamicSTRtreeImpl<ItemType*, EnvelopeTraits>::query;
+    using DynamicSTRtreeImpl<ItemType*, EnvelopeTraits>::remove;
+
+    // The SpatialIndex methods only work when we are storing a pointer type.
+    void query(const geom::Envelope* queryEnv, std::vector<void*>& results) override {
+        query(*queryEnv, [&results](const ItemType* x) {
+            results.push_back(const_cast<void*>(static_cast<const void*>(x)));
+        });
+    }
+
+    void query(const geom::Envelope* queryEnv, ItemVisitor& visitor) override {
+        query(*queryEnv, [&visitor](const ItemType* x) {
+            visitor.visitItem(const_cast<void*>(static_cast<const void*>(x)));
+        });
+    }
+
+    bool remove(const geom::Envelope* itemEnv, void* item) override {
+        return remove(*itemEnv, static_cast<ItemType*>(item));
+    }
+
+    void insert(const geom::Envelope* itemEnv, void* item) override {
+        insert(*itemEnv, std::move(static_cast<ItemType*>(item)));
+    }
+};
+
+
+}
+}
+}
@@ -0,0 +1,153 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Only instruction sets that are part of the baseline of their target
+// are used, so that this inline code is the same in every translation
+// unit whatever its compiler options, such as -mavx or -msse2 on 32-bit x86.
+#if defined(__x86_64__) || defined(_M_X64)
+#define GEOS_FLAT_ENVELOPES_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define GEOS_FLAT_ENVELOPES_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace geos {
+namespace index {
+namespace strtree {
+
+/**
+ * \brief
+ * The envelopes of the nodes of a packed tree, stored so that the
+ * children of a node can be tested against a query envelope with
+ * SIMD instructions.
+ *
+ * The children of a node are a contiguous group of nodes. The
+ * envelopes of a group starting at node `begin` with `n` nodes are
+ * stored at offset `4 * begin` as the `n` min X values, followed by
+ * the `n` min Y, max X and max Y values, so a group occupies a single
+ * contiguous block of memory.
+ *
+ * Two-lane SSE2 instructions are used on x86-64 and NEON on ARM64,
+ * where they are always available, and a scalar loop otherwise.
+ */
+class FlatEnvelopes {
+public:
+
+    /// Maximum number of envelopes tested by a single call to intersects()
+    static constexpr std::size_t MAX_TEST = 64;
+
+    void clear() {
+        std::vector<double>().swap(ordinates);
+    }
+
+    bool empty() const {
+        return ordinates.empty();
+    }
+
+    /// Allocates storage for the envelopes of a tree of `numNodes` nodes
+    void resize(std::size_t numNodes) {
+        ordinates.resize(4 * numNodes);
+    }
+
+    /// Stores the envelope of node `begin + i` of the group of `n` nodes starting at node `begin`
+    void set(std::size_t begin, std::size_t n, std::size_t i, const geom::Envelope& env) {
+        double* block = &ordinates[4 * begin];
+        block[i] = env.getMinX();
+        block[n + i] = env.getMinY();
+        block[2 * n + i] = env.getMaxX();
+        block[3 * n + i] = env.getMaxY();
+    }
+
+    /**
+     * Tests which of the envelopes `first` to `first + count` of the
+     * group of `n` nodes starting at node `begin` intersect an envelope.
+     * Envelopes with NaN ordinates intersect nothing, as for
+     * geom::Envelope::intersects.
+     *
+     * @param begin the first node of the group
+     * @param n the number of nodes in the group
+     * @param first the first envelope of the group to test
+     * @param count the number of envelopes to test, at most MAX_TEST
+     * @param q the query envelope
+     * @return a mask whose bit `i` is set if envelope `first + i` intersects `q`
+     */
+    std::uint64_t intersects(std::size_t begin, std::size_t n,
+                             std::size_t first, std::size_t count,
+                             const geom::Envelope& q) const {
+        const double* block = &ordinates[4 * begin];
+        const double* minX = block + first;
+        const double* minY = block + n + first;
+        const double* maxX = block + 2 * n + first;
+        const double* maxY = block + 3 * n + first;
+
+        const double qMinX = q.getMinX();
+        const double qMinY = q.getMinY();
+        const double qMaxX = q.getMaxX();
+        const double qMaxY = q.getMaxY();
+
+        std::uint64_t mask = 0;
+        std::size_t i = 0;
+
+#if defined(GEOS_FLAT_ENVELOPES_SSE2)
+        const __m128d vMinX = _mm_set1_pd(qMinX);
+        const __m128d vMinY = _mm_set1_pd(qMinY);
+        const __m128d vMaxX = _mm_set1_pd(qMaxX);
+        const __m128d vMaxY = _mm_set1_pd(qMaxY);
+        for (; i + 2 <= count; i += 2) {
+            __m128d hit = _mm_and_pd(
+                _mm_and_pd(_mm_cmple_pd(_mm_loadu_pd(minX + i), vMaxX),
+                           _mm_cmpge_pd(_mm_loadu_pd(maxX + i), vMinX)),
+                _mm_and_pd(_mm_cmple_pd(_mm_loadu_pd(minY + i), vMaxY),
+                           _mm_cmpge_pd(_mm_loadu_pd(maxY + i), vMinY)));
+            mask |= static_cast<std::uint64_t>(_mm_movemask_pd(hit)) << i;
+        }
+#elif defined(GEOS_FLAT_ENVELOPES_NEON)
+        const float64x2_t vMinX = vdupq_n_f64(qMinX);
+        const float64x2_t vMinY = vdupq_n_f64(qMinY);
+        const float64x2_t vMaxX = vdupq_n_f64(qMaxX);
+        const float64x2_t vMaxY = vdupq_n_f64(qMaxY);
+        for (; i + 2 <= count; i += 2) {
+            uint64x2_t hit = vandq_u64(
+                vandq_u64(vcleq_f64(vld1q_f64(minX + i), vMaxX),
+                          vcgeq_f64(vld1q_f64(maxX + i), vMinX)),
+                vandq_u64(vcleq_f64(vld1q_f64(minY + i), vMaxY),
+                          vcgeq_f64(vld1q_f64(maxY + i), vMinY)));
+            mask |= ((vgetq_lane_u64(hit, 0) & 1) | (vgetq_lane_u64(hit, 1) & 2)) << i;
+        }
+#endif
+
+        for (; i < count; i++) {
+            const bool hit = (minX[i] <= qMaxX) & (maxX[i] >= qMinX) &
+                             (minY[i] <= qMaxY) & (maxY[i] >= qMinY);
+            mask |= static_cast<std::uint64_t>(hit) << i;
+        }
+        return mask;
+    }
+
+private:
+    std::vector<double> ordinates;
+};
+
+}
+}
+}
@@ -18,13 +18,18 @@
 #include <geos/index/SpatialIndex.h> // for inheritance
 #include <geos/index/chain/MonotoneChain.h>
 #include <geos/index/ItemVisitor.h>
+#include <geos/index/strtree/FlatEnvelopes.h>
+#include <geos/shape/fractal/HilbertCode.h>
 #include <geos/util.h>
+#include <geos/util/TaskPool.h>
 
 #include <geos/index/strtree/TemplateSTRNode.h>
 #include <geos/index/strtree/TemplateSTRNodePair.h>
 #include <geos/index/strtree/TemplateSTRtreeDistance.h>
 #include <geos/index/strtree/Interval.h>
 
+#include <cstdint>
+#include <limits>
 #include <vector>
 #include <queue>
 #include <mutex>
@@ -156,7 +161,10 @@ public:
     TemplateSTRtreeImpl(const TemplateSTRtreeImpl& other) :
         root(other.root),
         nodeCapacity(other.nodeCapacity),
-        numItems(other.numItems) {
+        numItems(other.numItems),
+        hilbertPacking(other.hilbertPacking),
+        flatBounds(other.flatBounds),
+        flatEnvelopes(other.flatEnvelopes) {
         nodes = other.nodes;
     }
 
@@ -165,10 +173,39 @@ public:
         root = other.root;
         nodeCapacity = other.nodeCapacity;
         numItems = other.numItems;
+        hilbertPacking = other.hilbertPacking;
+        flatBounds = other.flatBounds;
+        flatEnvelopes = other.flatEnvelopes;
         nodes = other.nodes;
         return *this;
     }
 
+    /**
+     * Sets whether the tree is packed by ordering the items along a
+     * Hilbert curve, instead of by sort-tile-recursive slicing.
+     *
+     * The items are sorted only once, by the Hilbert code of the centre of
+     * their bounds, so the tree is faster to build. Queries are often
+     * faster for unevenly distributed items, and sometimes slower for
+     * uniformly distributed ones. This has no effect on one-dimensional
+     * bounds, or once the tree has been built.
+     */
+    void setHilbertPacking(bool p_hilbertPacking) {
+        hilbertPacking = p_hilbertPacking;
+    }
+
+    /**
+     * Sets whether the tree stores a second copy of the node envelopes
+     * in a flat layout when it is built. Queries then test the children
+     * of a node against the query envelope together, using SIMD
+     * instructions, at a cost of four doubles of memory per node.
+     * This has no effect on bounds other than geom::Envelope, or once
+     * the tree has been built.
+     */
+    void setFlatBounds(bool p_flatBounds) {
+        flatBounds = p_flatBounds;
+    }
+
     /// @}
     /// \defgroup insert Insertion
     /// @{
@@ -265,6 +302,38 @@ public:
         return td.isWithinDistance(*root, *other.root, maxDistance);
     }
 
+    /** Determine whether any item of the tree is within `maxDistance` of `item`, using distance metric `itemDist`. */
+    template<typename ItemDistance>
+    bool isWithinDistance(const BoundsType& env, const ItemType& item, double maxDistance, ItemDistance& itemDist) {
+        build();
+
+        if (getRoot() == nullptr) {
+            return false;
+        }
+
+        TemplateSTRNode<ItemType, BoundsTraits> bnd(item, env);
+        TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(itemDist);
+        return td.isWithinDistance(*getRoot(), bnd, maxDistance);
+    }
+
+    /**
+     * Visits the pairs of items of this tree and `other` tree in order of
+     * increasing distance using distance metric `itemDist`, up to `maxDistance`.
+     * The visitor is called with the items and their distance
+     * `(const ItemType&, const ItemType&, double)` and returns
+     * false to end the traversal.
+     */
+    template<typename ItemDistance, typename Visitor>
+    void visitPairsByDistance(TemplateSTRtreeImpl<ItemType, BoundsTraits>& other, ItemDistance& itemDist,
+                              double maxDistance, Visitor&& visitor) {
+        if (!getRoot() || !other.getRoot()) {
+            return;
+        }
+
+        TemplateSTRtreeDistance<ItemType, BoundsTraits, ItemDistance> td(itemDist);
+        td.visitPairsByDistance(*root, *other.root, maxDistance, std::forward<Visitor>(visitor));
+    }
+
     /// @}
     /// \defgroup query Query
     /// @{
@@ -283,6 +352,8 @@ public:
         if (root && root->boundsIntersect(queryEnv)) {
             if (root->isLeaf()) {
                 visitLeaf(visitor, *root);
+            } else if (hasFlatBounds()) {
+                queryFlat(queryEnv, *root, visitor);
             } else {
                 query(queryEnv, *root, visitor);
             }
@@ -317,6 +388,67 @@ public:
         });
     }
 
+    /**
+     * Query the tree with each of an array of bounds, optionally using
+     * the threads of a TaskPool.
+     *
+     * Results are stored in compressed sparse row form: the items whose
+     * bounds intersect `queryEnvs[i]` are stored in `items` at positions
+     * `offsets[i]` (inclusive) to `offsets[i + 1]` (exclusive).
+     *
+     * @param queryEnvs the bounds to query
+     * @param n the number of bounds in `queryEnvs`
+     * @param offsets set to the `n + 1` offsets of each query's results
+     * @param items set to the concatenated results of all queries
+     * @param pool pool on which to run the queries, or null
+     */
+    void queryBatch(const BoundsType* queryEnvs, std::size_t n,
+                    std::vector<std::size_t>& offsets,
+                    std::vector<ItemType>& items,
+                    util::TaskPool* pool = nullptr) {
+        build(pool);
+
+        offsets.assign(n + 1, 0);
+        items.clear();
+        if (n == 0) {
+            return;
+        }
+
+        // Each chunk of queries collects its own results, with offsets
+        // relative to the start of the chunk
+        std::size_t numChunks = 1;
+        if (pool != nullptr && pool->getNumWorkers() > 0) {
+            numChunks = std::min(n, pool->getConcurrency() * 8);
+        }
+        std::vector<std::vector<ItemType>> chunkItems(numChunks);
+
+        util::parallelFor(pool, numChunks, [this, queryEnvs, n, numChunks, &offsets, &chunkItems](std::size_t c) {
+            auto& found = chunkItems[c];
+            for (std::size_t i = n * c / numChunks; i < n * (c + 1) / numChunks; i++) {
+                query(queryEnvs[i], [&found](const ItemType& x) {
+                    found.push_back(x);
+                });
+                offsets[i + 1] = found.size();
+            }
+        });
+
+        std::size_t numFound = 0;
+        for (const auto& found : chunkItems) {
+            numFound += found.size();
+        }
+        items.reserve(numFound);
+
+        for (std::size_t c = 0; c < numChunks; c++) {
+            const std::size_t base = items.size();
+            for (std::size_t i = n * c / numChunks; i < n * (c + 1) / numChunks; i++) {
+                offsets[i + 1] += base;
+            }
+            items.insert(items.end(),
+                         std::make_move_iterator(chunkItems[c].begin()),
+                         std::make_move_iterator(chunkItems[c].end()));
+        }
+    }
+
     /**
      * Returns a depth-first iterator over all items in the tree.
      */
@@ -378,8 +510,13 @@ public:
 
     /// @}
 
-    /** Build the tree if it has not already been built. */
-    void build() {
+    /**
+     * Build the tree if it has not already been built.
+     *
+     * @param pool pool whose threads are used to sort the nodes of
+     *             large trees, or null to build on the calling thread
+     */
+    void build(util::TaskPool* pool = nullptr) {
         std::lock_guard<std::mutex> lock(lock_);
 
         if (built()) {
@@ -397,12 +534,26 @@ public:
         auto finalSize = treeSize(numItems);
         nodes.reserve(finalSize);
 
+        if (pool != nullptr && pool->getNumWorkers() == 0) {
+            pool = nullptr;
+        }
+
+        if (isHilbertPacked()) {
+            sortNodesHilbert(pool);
+        }
+
         // begin and end define a range of nodes needing parents
         auto begin = nodes.begin();
         auto number = static_cast<size_t>(std::distance(begin, nodes.end()));
 
         while (number > 1) {
-            createParentNodes(begin, number);
+            if (isHilbertPacked()) {
+                addParentNodes(begin, nodes.end());
+            } else if (pool != nullptr && number >= PARALLEL_BUILD_MIN_NODES) {
+                createParentNodesParallel(begin, number, pool);
+            } else {
+                createParentNodes(begin, number);
+            }
             std::advance(begin, static_cast<long>(number)); // parents just added become children in the next round
             number = static_cast<size_t>(std::distance(begin, nodes.end()));
         }
@@ -410,14 +561,30 @@ public:
         assert(finalSize == nodes.size());
 
         root = &nodes.back();
+
+        if (flatBounds) {
+            createFlatEnvelopes();
+        }
     }
 
 protected:
+    // DynamicSTRtreeImpl holds its items in a set of built trees
+    template<typename, typename> friend class DynamicSTRtreeImpl;
+
+    // Levels with fewer nodes than this are built on a single thread
+    static constexpr std::size_t PARALLEL_BUILD_MIN_NODES = 16384;
+
+    // Level of the Hilbert curve used to order items for Hilbert packing
+    static constexpr std::uint32_t HILBERT_LEVEL = shape::fractal::HilbertCode::MAX_LEVEL;
+
     std::mutex lock_;
     NodeList nodes;      //**< a list of all leaf and branch nodes in the tree. */
     Node* root;          //**< a pointer to the root node, if the tree has been built. */
     size_t nodeCapacity; //*< maximum number of children of each node */
     size_t numItems;     //*< total number of items in the tree, if it has been built. */
+    bool hilbertPacking = false; //*< whether the tree is packed in Hilbert order */
+    bool flatBounds = false;     //*< whether to create flatEnvelopes when the tree is built */
+    FlatEnvelopes flatEnvelopes; //*< the node envelopes grouped by parent, if flatBounds is set */
 
     // Prevent instantiation of base class.
     // ~TemplateSTRtreeImpl() = default;
@@ -442,7 +609,7 @@ protected:
 
         size_t nodesWithoutParents = numLeafNodes;
         while (nodesWithoutParents > 1) {
-            auto numSlices = sliceCount(nodesWithoutParents);
+            auto numSlices = isHilbertPacked() ? 1 : sliceCount(nodesWithoutParents);
             auto nodesPerSlice = sliceCapacity(nodesWithoutParents, numSlices);
 
             size_t parentNodesAdded = 0;
@@ -494,11 +661,202 @@ protected:
         }
     }
 
+    // Same as createParentNodes, but sorting the nodes using the threads
+    // of a TaskPool. Sorting dominates the cost of building the tree,
+    // while creating the parent nodes is a single linear pass.
+    void createParentNodesParallel(const NodeListIterator& begin, size_t number, util::TaskPool* pool) {
+        auto numSlices = sliceCount(number);
+        std::size_t nodesPerSlice = sliceCapacity(number, numSlices);
+
+        auto sliceStart = [&begin, number, nodesPerSlice](std::size_t j) {
+            return begin + static_cast<long>(std::min(number, j * nodesPerSlice));
+        };
+
+        partitionSlicesX(begin, number, nodesPerSlice, 0, numSlices, pool);
+
+        if (BoundsTraits::TwoDimensional::value) {
+            util::parallelFor(pool, numSlices, [this, &sliceStart](std::size_t j) {
+                sortNodesY(sliceStart(j), sliceStart(j + 1));
+            });
+        }
+
+        for (decltype(numSlices) j = 0; j < numSlices; j++) {
+            addParentNodes(sliceStart(j), sliceStart(j + 1));
+        }
+    }
+
+    // Moves every node to its vertical slice among slices [sliceLo, sliceHi),
+    // splitting the range at the median slice boundary and recursing on both
+    // halves concurrently. Ordering within a slice is left unspecified.
+    void partitionSlicesX(const NodeListIterator& begin, size_t number, size_t nodesPerSlice,
+                          size_t sliceLo, size_t sliceHi, util::TaskPool* pool) {
+        auto lo = begin + static_cast<long>(std::min(number, sliceLo * nodesPerSlice));
+        auto hi = begin + static_cast<long>(std::min(number, sliceHi * nodesPerSlice));
+
+        if (sliceHi - sliceLo < 2 || lo == hi) {
+            return;
+        }
+
+        if (static_cast<size_t>(std::distance(lo, hi)) < PARALLEL_BUILD_MIN_NODES) {
+            sortNodesX(lo, hi);
+            return;
+        }
+
+        auto sliceMid = (sliceLo + sliceHi) / 2;
+        auto mid = begin + static_cast<long>(std::min(number, sliceMid * nodesPerSlice));
+        if (mid != hi) {
+            std::nth_element(lo, mid, hi, [](const Node &a, const Node &b) {
+                return BoundsTraits::getX(a.getBounds()) < BoundsTraits::getX(b.getBounds());
+            });
+        }
+
+        util::TaskGroup tasks(pool);
+        tasks.run([this, &begin, number, nodesPerSlice, sliceMid, sliceHi, pool]() {
+            partitionSlicesX(begin, number, nodesPerSlice, sliceMid, sliceHi, pool);
+        });
+        partitionSlicesX(begin, number, nodesPerSlice, sliceLo, sliceMid, pool);
+        tasks.wait();
+    }
+
+    bool isHilbertPacked() const {
+        return hilbertPacking && BoundsTraits::TwoDimensional::value;
+    }
+
+    // Orders the leaf nodes by the Hilbert code of the centre of their
+    // bounds, using a radix sort of the codes. Parent nodes created
+    // from consecutive runs of the leaves are then in Hilbert order too.
+    void sortNodesHilbert(util::TaskPool* pool) {
+        const std::size_t n = nodes.size();
+
+        double minX = std::numeric_limits<double>::infinity();
+        double minY = minX;
+        double maxX = -minX;
+        double maxY = -minX;
+        for (const Node& node : nodes) {
+            const double x = BoundsTraits::getX(node.getBounds());
+            const double y = BoundsTraits::getY(node.getBounds());
+            minX = std::min(minX, x);
+            maxX = std::max(maxX, x);
+            minY = std::min(minY, y);
+            maxY = std::max(maxY, y);
+        }
+
+        const double side = static_cast<double>((1u << HILBERT_LEVEL) - 1);
+        const double scaleX = maxX > minX ? side / (maxX - minX) : 0;
+        const double scaleY = maxY > minY ? side / (maxY - minY) : 0;
+        auto ordinate = [side](double v, double min, double scale) {
+            const double d = (v - min) * scale;
+            if (!(d > 0)) {
+                return std::uint32_t{0};
+            }
+            return static_cast<std::uint32_t>(std::min(d, side));
+        };
+
+        using Key = std::pair<std::uint32_t, std::size_t>;
+        std::vector<Key> keys(n);
+        util::parallelFor(pool, n, [this, &keys, &ordinate, minX, minY, scaleX, scaleY](std::size_t i) {
+            const BoundsType& b = nodes[i].getBounds();
+            const auto x = ordinate(BoundsTraits::getX(b), minX, scaleX);
+            const auto y = ordinate(BoundsTraits::getY(b), minY, scaleY);
+            keys[i] = { shape::fractal::HilbertCode::encode(HILBERT_LEVEL, x, y), i };
+        }, PARALLEL_BUILD_MIN_NODES);
+
+        // LSD radix sort of the codes, a byte at a time. The sort is
+        // stable, so items with equal codes keep their insertion order.
+        std::vector<Key> sorted(n);
+        for (unsigned shift = 0; shift < 32; shift += 8) {
+            std::size_t counts[257] = {};
+            for (const Key& k : keys) {
+                counts[((k.first >> shift) & 0xff) + 1]++;
+            }
+            if (counts[((keys[0].first >> shift) & 0xff) + 1] == n) {
+                continue; // all codes share this byte
+            }
+            for (std::size_t d = 1; d < 257; d++) {
+                counts[d] += counts[d - 1];
+            }
+            for (const Key& k : keys) {
+                sorted[counts[(k.first >> shift) & 0xff]++] = k;
+            }
+            keys.swap(sorted);
+        }
+
+        NodeList ordered;
+        ordered.reserve(nodes.capacity());
+        for (const Key& k : keys) {
+            ordered.push_back(std::move(nodes[k.second]));
+        }
+        nodes.swap(ordered);
+    }
+
+    static constexpr bool isEnvelopeBounds() {
+        return std::is_same<BoundsType, geom::Envelope>::value;
+    }
+
+    bool hasFlatBounds() const {
+        return isEnvelopeBounds() && !flatEnvelopes.empty();
+    }
+
+    // Copies the envelopes of the children of each branch node into
+    // flatEnvelopes. The children of the branch nodes are consecutive,
+    // non-overlapping groups of nodes.
+    void createFlatEnvelopes() {
+        if constexpr (isEnvelopeBounds()) {
+            flatEnvelopes.resize(nodes.size());
+            for (std::size_t i = numItems; i < nodes.size(); i++) {
+                const Node* begin = nodes[i].beginChildren();
+                const std::size_t first = static_cast<std::size_t>(begin - nodes.data());
+                const std::size_t n = static_cast<std::size_t>(nodes[i].endChildren() - begin);
+                for (std::size_t j = 0; j < n; j++) {
+                    flatEnvelopes.set(first, n, j, begin[j].getBounds());
+                }
+            }
+        }
+    }
+
+    // Same as query(queryEnv, node, visitor), testing the envelopes of
+    // the children of each node using flatEnvelopes.
+    template<typename Visitor>
+    bool queryFlat(const BoundsType& queryEnv,
+                   const Node& node,
+                   Visitor&& visitor) {
+        if constexpr (isEnvelopeBounds()) {
+            const Node* begin = node.beginChildren();
+            const std::size_t first = static_cast<std::size_t>(begin - nodes.data());
+            const std::size_t n = static_cast<std::size_t>(node.endChildren() - begin);
+
+            for (std::size_t j = 0; j < n; j += FlatEnvelopes::MAX_TEST) {
+                const std::size_t count = std::min(n - j, FlatEnvelopes::MAX_TEST);
+                std::uint64_t hits = flatEnvelopes.intersects(first, n, j, count, queryEnv);
+
+                for (const Node* child = begin + j; hits != 0; ++child, hits >>= 1) {
+                    if ((hits & 1) == 0) {
+                        continue;
+                    }
+                    if (child->isLeaf()) {
+                        if (!child->isDeleted() && !visitLeaf(visitor, *child)) {
+                            return false; // abort query
+                        }
+                    } else if (!queryFlat(queryEnv, *child, visitor)) {
+                        return false; // abort query
+                    }
+                }
+            }
+            return true;
+        } else {
+            return query(queryEnv, node, visitor);
+        }
+    }
+
     void addParentNodesFromVerticalSlice(const NodeListIterator& begin, const NodeListIterator& end) {
         if (BoundsTraits::TwoDimensional::value) {
             sortNodesY(begin, end);
         }
 
+        addParentNodes(begin, end);
+    }
+
+    void addParentNodes(const NodeListIterator& begin, const NodeListIterator& end) {
         // Arrange the nodes vertically and full up parent nodes sequentially until they're full.
         // A possible improvement would be to rework this such so that if we have 81 nodes we
         // put 9 into each parent instead of 10 or 1.
@@ -539,7 +897,7 @@ protected:
     // continue.
     template<typename Visitor,
             typename std::enable_if<std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr >
-    bool visitLeaf(Visitor&& visitor, const Node& node)
+    static bool visitLeaf(Visitor&& visitor, const Node& node)
     {
         visitor(node.getItem());
         return true;
@@ -558,7 +916,7 @@ protected:
 #if !defined(_MSC_VER) || _MSC_VER >= 1910
     template<typename Visitor,
              typename std::enable_if<std::is_void<decltype(std::declval<Visitor>()(std::declval<BoundsType>(), std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr >
-    bool visitLeaf(Visitor&& visitor, const Node& node)
+    static bool visitLeaf(Visitor&& visitor, const Node& node)
     {
         visitor(node.getBounds(), node.getItem());
         return true;
@@ -569,7 +927,7 @@ protected:
     // that querying should continue.
     template<typename Visitor,
              typename std::enable_if<!std::is_void<decltype(std::declval<Visitor>()(std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr>
-    bool visitLeaf(Visitor&& visitor, const Node& node)
+    static bool visitLeaf(Visitor&& visitor, const Node& node)
     {
         return visitor(node.getItem());
     }
@@ -586,7 +944,7 @@ protected:
 #if !defined(_MSC_VER) || _MSC_VER >= 1910
     template<typename Visitor,
              typename std::enable_if<!std::is_void<decltype(std::declval<Visitor>()(std::declval<BoundsType>(), std::declval<ItemType>()))>::value, std::nullptr_t>::type = nullptr>
-    bool visitLeaf(Visitor&& visitor, const Node& node)
+    static bool visitLeaf(Visitor&& visitor, const Node& node)
     {
         return visitor(node.getBounds(), node.getItem());
     }
@@ -20,6 +20,7 @@
 #include <geos/util/IllegalArgumentException.h>
 #include <geos/util.h>
 
+#include <cmath>
 #include <queue>
 #include <memory>
 #include <vector>
@@ -59,6 +60,44 @@ public:
         return isWithinDistance(initPair, maxDistance);
     }
 
+    /**
+     * Visits the pairs of items of two trees in order of
+     * increasing distance, up to a maximum distance.
+     * The visitor is called with the items and their distance,
+     * and returns false to end the traversal.
+     */
+    template<typename Visitor>
+    void visitPairsByDistance(const Node& root1, const Node& root2, double maxDistance, Visitor&& visitor) {
+        //-- pairs at exactly maxDistance are also visited
+        double pruneDistance = std::nextafter(maxDistance, DoubleInfinity);
+
+        PairQueue priQ;
+        priQ.push(NodePair(root1, root2, m_id));
+
+        while (!priQ.empty()) {
+            NodePair pair = priQ.top();
+            priQ.pop();
+
+            /*
+             * Pairs are dequeued in order of their distance,
+             * which for composite nodes is a lower bound of the
+             * distance of any of the item pairs they contain.
+             */
+            if (pair.getDistance() > maxDistance) {
+                return;
+            }
+
+            if (pair.isLeaves()) {
+                auto items = pair.getItems();
+                if (!visitor(items.first, items.second, pair.getDistance())) {
+                    return;
+                }
+            } else {
+                expandToQueue(pair, priQ, pruneDistance);
+            }
+        }
+    }
+
 private:
 
     ItemPair nearestNeighbour(NodePair& initPair, double maxDistance) {
@@ -25,6 +25,7 @@
 #include <geos/util/Machine.h> // for getMachineByteOrder
 
 #include <cstdint>
+#include <cstring>
 #include <iosfwd> // ostream, istream (if we remove inlines)
 
 namespace geos {
@@ -108,6 +109,64 @@ public:
         return ret;
     };
 
+    /**
+     * \brief Reads a run of doubles into an array.
+     *
+     * The input is checked for EOF once, and copied without
+     * conversion when its byte order is the machine byte order.
+     */
+    void readDoubles(double* out, size_t n)
+    {
+        if(n > size() / 8) {
+            throw  ParseException("Unexpected EOF parsing WKB");
+        }
+        if(byteOrder == getMachineByteOrder()) {
+            std::memcpy(out, buf, n * 8);
+            buf += n * 8;
+            return;
+        }
+        for(size_t i = 0; i < n; i++) {
+            out[i] = ByteOrderValues::getDouble(buf, byteOrder);
+            buf += 8;
+        }
+    };
+
+    /**
+     * \brief Reads a run of `n` groups of `dim` doubles into an array,
+     * starting each group `stride` doubles after the previous one.
+     *
+     * The ordinates between groups are left unchanged, so a run of XY
+     * coordinates can be read into a sequence padded to stride 3.
+     */
+    void readDoubles(double* out, size_t n, size_t dim, size_t stride)
+    {
+        if(dim == 0 || n > size() / 8 / dim) {
+            throw  ParseException("Unexpected EOF parsing WKB");
+        }
+        const bool native = byteOrder == getMachineByteOrder();
+        for(size_t i = 0; i < n; i++) {
+            double* group = out + i * stride;
+            if(native) {
+                std::memcpy(group, buf, dim * 8);
+                buf += dim * 8;
+                continue;
+            }
+            for(size_t j = 0; j < dim; j++) {
+                group[j] = ByteOrderValues::getDouble(buf, byteOrder);
+                buf += 8;
+            }
+        }
+    };
+
+    /// Skips over `n` bytes.
+    void skip(size_t n)
+    {
+        if(n > size()) {
+            throw  ParseException("Unexpected EOF parsing WKB");
+        }
+        buf += n;
+    };
+
     size_t size() const
     {
         return static_cast<size_t>(end - buf);
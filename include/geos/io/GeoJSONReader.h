@@ -74,6 +74,8 @@ public:
 
 private:
 
+    friend class GeoJSONStreamReader;
+
     const geom::GeometryFactory& geometryFactory;
     mutable int parseDepth_ = 0;
 
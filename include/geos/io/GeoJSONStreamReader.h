@@ -0,0 +1,132 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoJSON.h>
+#include <geos/io/GeoJSONReader.h>
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamReader
+ *
+ * \brief Reads the features of a GeoJSON FeatureCollection from a
+ * stream one at a time.
+ *
+ * Only the text of the current feature is held in memory, so
+ * collections much larger than the available memory can be read.
+ * Members of the FeatureCollection other than `features` are skipped.
+ *
+ * A document that is a single Feature or Geometry is also accepted,
+ * and is returned as a single feature.
+ *
+ * See also GeoJSONStreamWriter.
+ */
+class GEOS_DLL GeoJSONStreamReader {
+
+public:
+
+    explicit GeoJSONStreamReader(std::istream& instr);
+
+    GeoJSONStreamReader(std::istream& instr, const geom::GeometryFactory& gf);
+
+    /// Constructs a reader that takes ownership of the stream.
+    GeoJSONStreamReader(std::unique_ptr<std::istream> instr, const geom::GeometryFactory& gf);
+
+    ~GeoJSONStreamReader();
+
+    GeoJSONStreamReader(const GeoJSONStreamReader&) = delete;
+    GeoJSONStreamReader& operator=(const GeoJSONStreamReader&) = delete;
+
+    /**
+     * Reads the next feature.
+     *
+     * @return the feature, or nullptr if all features have been read
+     * @throws ParseException if the input is not valid GeoJSON
+     */
+    std::unique_ptr<GeoJSONFeature> next();
+
+    /**
+     * Reads the geometry of the next feature, without parsing
+     * its properties.
+     *
+     * @return the geometry, or nullptr if all features have been read
+     * @throws ParseException if the input is not valid GeoJSON
+     */
+    std::unique_ptr<geom::Geometry> nextGeometry();
+
+private:
+
+    enum class State {
+        START,
+        IN_FEATURES,
+        IN_DOCUMENT,
+        END
+    };
+
+    std::unique_ptr<std::istream> ownedStream;
+    std::istream& instr;
+    GeoJSONReader reader;
+    State state;
+    std::size_t numFeaturesRead;
+
+    // Text of a document without a "features" array
+    std::string document;
+    std::vector<GeoJSONFeature> documentFeatures;
+    std::size_t documentFeatureIndex;
+
+    bool readFeatureText(std::string& text);
+
+    void readMembers(bool afterMember);
+
+    int get();
+
+    int peek();
+
+    void skipWhitespace();
+
+    void expect(char c, std::string* out);
+
+    void readString(std::string* out);
+
+    void readValue(std::string* out);
+};
+
+} // namespace io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -0,0 +1,107 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/io/GeoJSON.h>
+#include <geos/io/GeoJSONWriter.h>
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class GeoJSONStreamWriter
+ *
+ * \brief Writes a GeoJSON FeatureCollection to a stream one feature
+ * at a time.
+ *
+ * Each feature is written as soon as it is passed to write(), so the
+ * collection never needs to be held in memory. The collection is
+ * closed by finish(), or by the destructor if finish() has not been
+ * called.
+ *
+ * See also GeoJSONStreamReader.
+ */
+class GEOS_DLL GeoJSONStreamWriter {
+
+public:
+
+    explicit GeoJSONStreamWriter(std::ostream& os);
+
+    /// Constructs a writer that takes ownership of the stream.
+    explicit GeoJSONStreamWriter(std::unique_ptr<std::ostream> os);
+
+    ~GeoJSONStreamWriter();
+
+    GeoJSONStreamWriter(const GeoJSONStreamWriter&) = delete;
+    GeoJSONStreamWriter& operator=(const GeoJSONStreamWriter&) = delete;
+
+    /// Writes a feature to the collection.
+    void write(const GeoJSONFeature& feature);
+
+    /// Writes a feature with the given geometry and no properties.
+    void write(const geom::Geometry* geometry);
+
+    /**
+     * Closes the FeatureCollection. No features may be written
+     * afterwards.
+     */
+    void finish();
+
+    /// \see GeoJSONWriter::setOutputDimension
+    void setOutputDimension(uint8_t newOutputDimension)
+    {
+        writer.setOutputDimension(newOutputDimension);
+    }
+
+    /// \see GeoJSONWriter::setForceCCW
+    void setForceCCW(bool newIsForceCCW)
+    {
+        writer.setForceCCW(newIsForceCCW);
+    }
+
+private:
+
+    std::unique_ptr<std::ostream> ownedStream;
+    std::ostream& os;
+    GeoJSONWriter writer;
+    std::size_t numFeatures;
+    bool isFinished;
+
+    void writeSeparator();
+};
+
+} // namespace io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
@@ -21,6 +21,7 @@
 
 #include <geos/export.h>
 
+#include <cstddef>
 #include <string>
 
 #ifdef _MSC_VER
@@ -31,6 +32,14 @@
 namespace geos {
 namespace io {
 
+/**
+ * \brief Splits a string into the tokens of Well-Known Text.
+ *
+ * Tokens are parentheses, commas, numbers and words, separated by
+ * whitespace. The text is scanned in place, without copying numbers,
+ * and the token found by peekNextToken() is kept so that a following
+ * nextToken() does not scan it again.
+ */
 class GEOS_DLL StringTokenizer {
 public:
     enum {
@@ -41,16 +50,39 @@ public:
     };
     //StringTokenizer();
     explicit StringTokenizer(const std::string& txt);
+
+    /**
+     * \brief Creates a tokenizer starting at an offset in a string.
+     *
+     * @param txt the text, which must outlive the tokenizer
+     * @param start the offset of the first character to read
+     */
+    StringTokenizer(const std::string& txt, std::size_t start);
+
     ~StringTokenizer() {}
     int nextToken();
     int peekNextToken();
     double getNVal() const;
     std::string getSVal() const;
+
+    /// Returns the offset in the text of the character following
+    /// the last token read by nextToken()
+    std::size_t getPosition() const;
+
 private:
-    const std::string& str;
+    const char* begin;
+    const char* end;
+    // start of the next unread token, or of the whitespace before it
+    const char* iter;
     std::string stok;
     double ntok;
-    std::string::const_iterator iter;
+
+    // token found by peekNextToken(), if not yet consumed
+    bool hasPeek;
+    const char* peekTo;
+    int peekType;
+
+    int scanToken(const char*& to);
 
     // Declare type as noncopyable
     StringTokenizer(const StringTokenizer& other) = delete;
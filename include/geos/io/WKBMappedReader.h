@@ -0,0 +1,159 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class GeometryFactory;
+}
+}
+
+namespace geos {
+namespace io {
+
+/**
+ * \class WKBMappedReader
+ *
+ * \brief Provides random access to a sequence of concatenated binary
+ * WKB records.
+ *
+ * The records are read from a memory-mapped file or from a buffer
+ * supplied by the caller. On construction the record headers are
+ * scanned to build an index of their offsets; coordinates are skipped
+ * using the point counts, so the scan does not read them.
+ * The envelopes of all records are computed on the first call to
+ * getEnvelope(), without creating geometries (except for records
+ * containing circular arcs). Geometries are decoded on demand by read().
+ *
+ * Both little- and big-endian records are supported, as are the ISO
+ * and extended (PostGIS) WKB flavors.
+ *
+ * The const methods of this class may be called concurrently.
+ */
+class GEOS_DLL WKBMappedReader {
+
+public:
+
+    /**
+     * Maps a file of concatenated WKB records into memory.
+     *
+     * @param fileName the name of the file to map
+     * @throws util::GEOSException if the file cannot be mapped
+     * @throws ParseException if the file does not contain valid WKB
+     */
+    explicit WKBMappedReader(const std::string& fileName);
+
+    WKBMappedReader(const std::string& fileName, const geom::GeometryFactory& f);
+
+    /**
+     * Reads concatenated WKB records from a buffer. The buffer is not
+     * copied and must outlive the reader.
+     *
+     * @param buf the buffer holding the records
+     * @param size the size of the buffer in bytes
+     * @throws ParseException if the buffer does not contain valid WKB
+     */
+    WKBMappedReader(const unsigned char* buf, std::size_t size);
+
+    WKBMappedReader(const unsigned char* buf, std::size_t size, const geom::GeometryFactory& f);
+
+    ~WKBMappedReader();
+
+    WKBMappedReader(const WKBMappedReader&) = delete;
+    WKBMappedReader& operator=(const WKBMappedReader&) = delete;
+
+    /// Returns the number of records.
+    std::size_t size() const
+    {
+        return offsets.size() - 1;
+    }
+
+    /// Returns the offset in bytes of record i from the start of the data.
+    std::size_t getOffset(std::size_t i) const
+    {
+        return offsets[i];
+    }
+
+    /// Returns a pointer to the WKB of record i.
+    const unsigned char* getRecordData(std::size_t i) const
+    {
+        return data + offsets[i];
+    }
+
+    /// Returns the size in bytes of the WKB of record i.
+    std::size_t getRecordSize(std::size_t i) const
+    {
+        return offsets[i + 1] - offsets[i];
+    }
+
+    /**
+     * Returns the envelope of record i without decoding it.
+     * The envelope of an empty geometry is null.
+     *
+     * The envelopes of all records are computed by the first call.
+     */
+    const geom::Envelope& getEnvelope(std::size_t i) const;
+
+    /**
+     * Decodes record i.
+     *
+     * @param i the index of the record
+     * @return the geometry
+     * @throws ParseException if the record cannot be decoded
+     */
+    std::unique_ptr<geom::Geometry> read(std::size_t i) const;
+
+private:
+
+    class MappedFile;
+
+    const geom::GeometryFactory& factory;
+    std::unique_ptr<MappedFile> file;
+    const unsigned char* data;
+    std::size_t dataSize;
+
+    // Offsets of the records, followed by dataSize
+    std::vector<std::size_t> offsets;
+
+    mutable std::once_flag envelopesComputed;
+    mutable std::vector<geom::Envelope> envelopes;
+
+    void buildIndex();
+
+    void computeEnvelopes() const;
+};
+
+} // namespace io
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
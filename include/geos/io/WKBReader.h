@@ -26,7 +26,7 @@
 
 #include <iosfwd> // ostream, istream
 #include <memory>
-// #include <vector>
+#include <vector>
 #include <array>
 
 #ifdef _MSC_VER
@@ -60,6 +60,9 @@ class CoordinateSequence;
 class SimpleCurve;
 
 } // namespace geom
+namespace util {
+class TaskPool;
+}
 } // namespace geos
 
 
@@ -114,6 +117,24 @@ public:
      */
     std::unique_ptr<geom::Geometry> read(const unsigned char* buf, size_t size);
 
+    /**
+     * \brief Reads an array of Geometries from WKB buffers.
+     *
+     * The results are the same as calling read() for each buffer.
+     * If a TaskPool is provided the buffers are read concurrently,
+     * each thread using its own reader with the settings of this one.
+     *
+     * @param bufs the buffers to read from
+     * @param sizes the size of each buffer in bytes
+     * @param n the number of buffers
+     * @param pool the pool to use, or null to read on the calling thread
+     * @return the Geometries read, in input order
+     * @throws ParseException if any buffer cannot be read
+     */
+    std::vector<std::unique_ptr<geom::Geometry>> readBatch(
+        const unsigned char* const* bufs, const size_t* sizes, size_t n,
+        util::TaskPool* pool = nullptr) const;
+
     /**
      * \brief Reads a Geometry from an istream in hex format.
      *
@@ -187,6 +187,32 @@ public:
     void write(const geom::Geometry& g, std::ostream& os);
     // throws IOException, ParseException
 
+    /**
+     * \brief Returns the exact number of bytes that writing a Geometry
+     * will produce with the current settings of the writer.
+     *
+     * @param g the geometry to measure
+     * @return the size of the WKB representation of `g`, in bytes
+     */
+    std::size_t getWkbSize(const geom::Geometry& g);
+
+    /**
+     * \brief Write a Geometry to a caller-supplied buffer.
+     *
+     * This avoids the overhead of a stream: the encoded size is
+     * computed up front and, when the output byte order matches the
+     * machine byte order, runs of coordinates are copied to the buffer
+     * in bulk.
+     *
+     * @param g the geometry to write
+     * @param buf the output buffer
+     * @param bufSize the size of `buf`, which must be at least
+     *        getWkbSize(g) bytes
+     * @return the number of bytes written
+     * @throws IllegalArgumentException if the buffer is too small
+     */
+    std::size_t write(const geom::Geometry& g, unsigned char* buf, std::size_t bufSize);
+
     /**
      * \brief Write a Geometry to an ostream in binary hex format.
      *
@@ -212,9 +238,11 @@ private:
 
     bool includeSRID;
 
-    std::ostream* outStream;
+    // output buffer, or nullptr when only measuring the output size
+    unsigned char* outBuf;
+    std::size_t outPos;
 
-    unsigned char buf[8];
+    void writeGeometry(const geom::Geometry& g);
 
     void writePoint(const geom::Point& p);
     void writePointEmpty(const geom::Point& p);
@@ -251,6 +279,8 @@ private:
     void writeInt(int intValue);
     // throws IOException
 
+    void writeDouble(double doubleValue);
+
     OrdinateSet getOutputOrdinates(OrdinateSet ordinates);
 
 };
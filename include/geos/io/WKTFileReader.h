@@ -37,9 +37,6 @@ public:
     ~WKTFileReader();
 
     std::vector<std::unique_ptr<geom::Geometry>> read(std::string fname);
-
-private:
-    std::unique_ptr<geos::geom::Geometry> readGeom(std::ifstream& f, geos::io::WKTReader& rdr);
 };
 
 }
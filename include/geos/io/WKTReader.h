@@ -115,6 +115,21 @@ public:
     }
 
     std::unique_ptr<geom::Geometry> read(const std::string& wellKnownText) const;
+
+    /**
+     * \brief Parse the next geometry of a string holding a sequence of
+     * WKT geometries.
+     *
+     * Geometries may be separated by any whitespace, so a whole file
+     * can be parsed from one buffer without splitting it first.
+     *
+     * @param text the text to parse
+     * @param pos the offset in `text` to start from, updated to the
+     *        offset following the geometry read
+     * @return the geometry read, or nullptr if only whitespace remains
+     * @throws ParseException if the text at `pos` is not a valid geometry
+     */
+    std::unique_ptr<geom::Geometry> readNext(const std::string& text, std::size_t& pos) const;
     std::unique_ptr<geom::CoordinateSequence> readCoordinates(const std::string& wellKnownText) const;
 
 protected:
@@ -18,6 +18,9 @@
 #include <geos/io/WKTReader.h>
 #include <geos/export.h>
 
+#include <istream>
+#include <string>
+
 // Forward declarations
 namespace geos {
 namespace geom {
@@ -30,18 +33,49 @@ class PrecisionModel;
 namespace geos {
 namespace io {
 
+/**
+ * \brief Reads a sequence of WKT geometries from a stream.
+ *
+ * Geometries may be separated by any whitespace, including newlines
+ * within or between geometries.
+ *
+ * The stream is read in chunks, and only the text of the geometries
+ * not yet returned is buffered.
+ */
 class GEOS_DLL WKTStreamReader {
 
 public:
-    WKTStreamReader(std::istream& instr);
+    /// Default number of characters read from the stream at a time
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 65536;
+
+    WKTStreamReader(std::istream& instr, std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
     ~WKTStreamReader();
 
+    /**
+     * Reads the next geometry.
+     *
+     * @return the geometry read, or nullptr at the end of the stream
+     * @throws ParseException if the text is not a valid geometry
+     */
     std::unique_ptr<geos::geom::Geometry> next();
 
 private:
 
     std::istream& instr;
     WKTReader rdr;
+    std::size_t chunkSize;
+
+    // text read from the stream and not yet parsed
+    std::string buffer;
+    // offset of the next geometry in buffer
+    std::size_t pos;
+    // offset in buffer of the next character to scan for the end of the geometry
+    std::size_t scanPos;
+    // parenthesis depth at scanPos
+    int depth;
+
+    bool readChunk();
+    std::size_t scanGeometryEnd();
 };
 
 }
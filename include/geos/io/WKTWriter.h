@@ -97,7 +97,13 @@ public:
 
     std::string write(const geom::Geometry& geometry);
 
-    // Send Geometry's WKT to the given Writer
+    /**
+     * \brief Appends the WKT of a Geometry to a Writer.
+     *
+     * A Writer reused for many geometries, emptied with Writer::clear()
+     * when its contents have been consumed, avoids allocating output
+     * storage for each geometry.
+     */
     void write(const geom::Geometry* geometry, Writer* writer);
 
     std::string writeFormatted(const geom::Geometry* geometry);
@@ -272,6 +278,8 @@ protected:
 
     std::string writeNumber(double d) const;
 
+    void appendNumber(double d, Writer& writer) const;
+
     void appendCurveText(
         const geom::Curve& lineString,
         OrdinateSet outputOrdinates,
@@ -21,6 +21,7 @@
 
 #include <geos/export.h>
 
+#include <cstddef>
 #include <string>
 
 #ifdef _MSC_VER
@@ -31,12 +32,36 @@
 namespace geos {
 namespace io {
 
+/**
+ * \brief A growable text buffer that output is appended to.
+ *
+ * A Writer can be reused for many outputs: clear() empties it
+ * but keeps its storage, so that writing a sequence of geometries
+ * does not allocate once the buffer is large enough.
+ */
 class GEOS_DLL Writer {
 public:
     Writer();
     void reserve(std::size_t capacity);
     ~Writer() = default;
     void write(const std::string& txt);
+    void write(const char* txt);
+    void write(const char* txt, std::size_t len);
+    void write(char c);
+
+    /// Removes the contents, keeping the allocated storage
+    void clear();
+
+    std::size_t size() const
+    {
+        return str.size();
+    }
+
+    const char* data() const
+    {
+        return str.data();
+    }
+
     const std::string& toString();
 private:
     std::string str;
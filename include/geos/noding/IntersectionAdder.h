@@ -107,6 +107,24 @@ public:
         numTests(0)
     {}
 
+    /**
+     * Resets the intersection flags and counts,
+     * so the adder can be used for another noding run.
+     */
+    void
+    reset()
+    {
+        hasIntersectionVar = false;
+        hasProper = false;
+        hasProperInterior = false;
+        hasInterior = false;
+        properIntersectionPoint = geom::CoordinateXYZM();
+        numIntersections = 0;
+        numInteriorIntersections = 0;
+        numProperIntersections = 0;
+        numTests = 0;
+    }
+
     algorithm::LineIntersector&
     getLineIntersector()
     {
@@ -26,7 +26,6 @@
 
 #include <geos/operation/buffer/BufferOp.h> // for inlines (BufferOp enums)
 #include <geos/operation/buffer/OffsetCurveBuilder.h> // for inline (OffsetCurveBuilder enums)
-#include <geos/geomgraph/EdgeList.h> // for composition
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -49,14 +48,11 @@ class SegmentString;
 class IntersectionAdder;
 }
 namespace geomgraph {
-class Edge;
 class Label;
-class PlanarGraph;
 }
 namespace operation {
 namespace buffer {
-class BufferSubgraph;
-class PolygonBuilder;
+class BufferGraph;
 }
 
 }
@@ -82,6 +78,9 @@ namespace buffer { // geos.operation.buffer
  * Retrying the computation in a fixed precision
  * can produce more robust results.
  *
+ * A builder can compute several buffers in turn, reusing its
+ * line intersector.
+ *
  */
 class GEOS_DLL BufferBuilder {
 
@@ -103,7 +102,6 @@ public:
         intersectionAdder(nullptr),
         workingNoder(nullptr),
         geomFact(nullptr),
-        edgeList(),
         isInvertOrientation(false)
     {}
 
@@ -197,42 +195,16 @@ private:
 
     const geom::GeometryFactory* geomFact;
 
-    geomgraph::EdgeList edgeList;
-
-    std::vector<geomgraph::Label*> newLabels;
-
     bool isInvertOrientation;
 
-    void computeNodedEdges(std::vector<noding::SegmentString*>& bufSegStr,
-                           const geom::PrecisionModel* precisionModel);
-    // throw(GEOSException);
-
-    /**
-     * Inserted edges are checked to see if an identical edge already
-     * exists.
-     * If so, the edge is not inserted, but its label is merged
-     * with the existing edge.
-     *
-     * The function takes responsibility of releasing the Edge parameter
-     * memory when appropriate.
-     */
-    void insertUniqueEdge(geomgraph::Edge* e);
-
-    void createSubgraphs(geomgraph::PlanarGraph* graph,
-                         std::vector<BufferSubgraph*>& list);
-
     /**
-     * Completes the building of the input subgraphs by
-     * depth-labelling them,
-     * and adds them to the PolygonBuilder.
-     * The subgraph list must be sorted in rightmost-coordinate order.
-     *
-     * @param subgraphList the subgraphs to build
-     * @param polyBuilder the PolygonBuilder which will build
-     *        the final polygons
+     * Nodes the offset curves and adds the noded sections,
+     * with their depth deltas, to the buffer graph.
      */
-    void buildSubgraphs(const std::vector<BufferSubgraph*>& subgraphList,
-                        PolygonBuilder& polyBuilder);
+    void computeNodedEdges(std::vector<noding::SegmentString*>& bufSegStr,
+                           const geom::PrecisionModel* precisionModel,
+                           BufferGraph& graph);
+    // throw(GEOSException);
 
     /// \brief
     /// Return the externally-set noding::Noder OR a newly created
@@ -0,0 +1,162 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Coordinate.h>
+#include <geos/geom/Envelope.h>
+#include <geos/operation/overlayng/Edge.h>
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class CoordinateSequence;
+class GeometryFactory;
+class Surface;
+}
+namespace operation {
+namespace overlayng {
+class OverlayEdge;
+}
+}
+}
+
+namespace geos {
+namespace operation { // geos.operation
+namespace buffer { // geos.operation.buffer
+
+/**
+ * \brief
+ * Computes the polygons of a buffer from its noded offset curves,
+ * using the OverlayNG topology graph.
+ *
+ * Coincident curve sections are merged into a single edge, whose
+ * depth delta is the sum of the depth deltas of the sections.
+ * The graph is split into connected subgraphs, which are labelled in
+ * order of decreasing rightmost X. The depth outside a subgraph is found
+ * by stabbing the subgraphs already labelled with a ray to the right
+ * of its rightmost coordinate, and is propagated node by node through
+ * the subgraph. Edges with depth >= 1 on their right side and <= 0 on
+ * their left side form the boundary of the buffer.
+ *
+ * The depths are kept by the BufferGraph rather than in the OverlayEdges,
+ * which are shared with the overlay operations.
+ */
+class GEOS_DLL BufferGraph {
+
+public:
+
+    BufferGraph() = default;
+
+    BufferGraph(const BufferGraph&) = delete;
+    BufferGraph& operator=(const BufferGraph&) = delete;
+
+    /**
+     * Adds a section of a noded offset curve.
+     *
+     * @param pts the section coordinates, with no repeated points
+     * @param depthDelta the change in depth as the section is crossed
+     *                   from right to left
+     */
+    void addEdge(const std::shared_ptr<const geom::CoordinateSequence>& pts, int depthDelta);
+
+    /// Tests whether any edges have been added.
+    bool isEmpty() const
+    {
+        return edgeQue.empty();
+    }
+
+    /**
+     * Builds the graph, labels it with depths and computes the
+     * polygons of the buffer area.
+     *
+     * @param geomFact the factory for the polygons
+     * @return the buffer polygons
+     * @throws util::TopologyException if the depths are inconsistent
+     */
+    std::vector<std::unique_ptr<geom::Surface>> getPolygons(const geom::GeometryFactory* geomFact);
+
+private:
+
+    /// Value of EdgeDepth::depth before a depth is assigned
+    static constexpr int NO_DEPTH = -999;
+
+    /**
+     * The depth labelling of a half-edge.
+     */
+    struct EdgeDepth {
+        /// change in depth as the edge is crossed from right to left
+        int depthDelta = 0;
+        /// depth of the area to the right of the edge
+        int depth = NO_DEPTH;
+        /// whether the depths around the origin node have been computed
+        bool isVisited = false;
+    };
+
+    /**
+     * A connected component of the graph, with its forward edges
+     * and their envelopes.
+     */
+    struct Subgraph {
+        std::vector<overlayng::OverlayEdge*> edges;
+        std::vector<geom::Envelope> edgeEnvs;
+        geom::Envelope env;
+        overlayng::OverlayEdge* rightmostEdge = nullptr;
+        geom::CoordinateXY rightmostCoord;
+    };
+
+    std::deque<overlayng::Edge> edgeQue;
+
+    std::unordered_map<const overlayng::OverlayEdge*, EdgeDepth> edgeDepths;
+
+    EdgeDepth& getEdgeDepth(const overlayng::OverlayEdge* e);
+
+    int getDepth(const overlayng::OverlayEdge* e)
+    {
+        return getEdgeDepth(e).depth;
+    }
+
+    static std::vector<Subgraph> createSubgraphs(const std::vector<overlayng::OverlayEdge*>& graphEdges);
+
+    static void findRightmostEdge(Subgraph& subgraph);
+
+    int getOutsideDepth(const geom::CoordinateXY& p,
+                        const std::vector<const Subgraph*>& processed);
+
+    void computeDepths(overlayng::OverlayEdge* startEdge, int outsideDepth);
+
+    void computeNodeDepth(overlayng::OverlayEdge* nodeEdge);
+
+    /**
+     * Sets the depth to the right of an edge,
+     * and the depth to its left from its depth delta.
+     */
+    void setEdgeDepths(overlayng::OverlayEdge* e, int depth);
+
+    void setDepth(const overlayng::OverlayEdge* e, int depth);
+
+    void markResultAreaEdges(const Subgraph& subgraph,
+                             std::vector<overlayng::OverlayEdge*>& resultAreaEdges);
+
+};
+
+} // namespace geos::operation::buffer
+} // namespace geos::operation
+} // namespace geos
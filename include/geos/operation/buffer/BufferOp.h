@@ -40,6 +40,14 @@ namespace geom {
 class PrecisionModel;
 class Geometry;
 }
+namespace util {
+class TaskPool;
+}
+namespace operation {
+namespace buffer {
+class BufferBuilder;
+}
+}
 }
 
 namespace geos {
@@ -103,6 +111,9 @@ private:
 
     bool isInvertOrientation = false;
 
+    // builder used for the original precision attempt, if not owned
+    BufferBuilder* reusableBuilder = nullptr;
+
     /**
      * Compute a reasonable scale factor to limit the precision of
      * a given combination of Geometry and buffer distance.
@@ -176,6 +187,29 @@ public:
         double distance,
         BufferParameters& bufParms);
 
+    /** \brief
+     * Computes the buffers of an array of geometries, using the same
+     * distance and parameters for all of them.
+     *
+     * The results are the same as computing each buffer with
+     * bufferOp(), but builder state is reused across inputs.
+     * Each run of 16 consecutive inputs is buffered with one builder.
+     * If a TaskPool is provided the runs are buffered concurrently.
+     *
+     * @param geoms the geometries to buffer
+     * @param n the number of geometries
+     * @param distance the buffer distance
+     * @param bufParms the buffer parameters
+     * @param pool the pool to use, or null to buffer on the calling thread
+     * @return the buffers of the input geometries, in input order
+     */
+    static std::vector<std::unique_ptr<geom::Geometry>> bufferBatch(
+        const geom::Geometry* const* geoms,
+        std::size_t n,
+        double distance,
+        const BufferParameters& bufParms,
+        util::TaskPool* pool = nullptr);
+
     /** \brief
      * Initializes a buffer computation for the given geometry.
      *
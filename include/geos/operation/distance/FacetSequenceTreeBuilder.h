@@ -35,13 +35,15 @@ namespace distance {
 
 class GEOS_DLL FacetSequenceTreeBuilder {
 
+    friend class MultiIndexedFacetDistance;
+
 private:
 
     // 6 seems to be a good facet sequence size
-    static const std::size_t FACET_SEQUENCE_SIZE = 6;
+    static constexpr std::size_t FACET_SEQUENCE_SIZE = 6;
 
     // Seems to be better to use a minimum node capacity
-    static const std::size_t STR_TREE_NODE_CAPACITY = 4;
+    static constexpr std::size_t STR_TREE_NODE_CAPACITY = 4;
 
     static void addFacetSequences(const geom::CoordinateSequence* pts,
                                   std::vector<FacetSequence> & sections);
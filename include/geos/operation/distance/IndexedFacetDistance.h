@@ -102,6 +102,28 @@ public:
     /// \return the nearest points
     std::unique_ptr<geom::CoordinateSequence> nearestPoints(const geom::Geometry* g) const;
 
+    /// \brief Computes the distance from the base geometry to a point.
+    ///
+    /// This avoids building an index for the point, so is faster than
+    /// distance(const geom::Geometry*) when querying many points.
+    ///
+    /// \param pt the point to compute the distance to
+    /// \return the computed distance
+    double distance(const geom::CoordinateXY& pt) const;
+
+    /// \brief Tests whether the base geometry lies within a specified distance of a point.
+    ///
+    /// \param pt the point to test
+    /// \param maxDistance the maximum distance to test
+    /// \return true if the geometry lies within the specified distance
+    bool isWithinDistance(const geom::CoordinateXY& pt, double maxDistance) const;
+
+    /// \brief Computes the nearest location on the base geometry to a point.
+    ///
+    /// \param pt the point to compute the nearest location to
+    /// \return the nearest location on the base geometry
+    geom::CoordinateXY nearestPoint(const geom::CoordinateXY& pt) const;
+
 
 private:
     struct FacetDistance {
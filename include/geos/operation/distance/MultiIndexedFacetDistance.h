@@ -0,0 +1,108 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/distance/FacetSequence.h>
+
+#include <memory>
+#include <vector>
+
+namespace geos {
+namespace geom {
+class Geometry;
+}
+}
+
+namespace geos {
+namespace operation {
+namespace distance {
+
+/// \brief Finds the [Geometrys](\ref geom::Geometry) of a set which
+/// are nearest to a query geometry, using the distance between their facets.
+///
+/// The facets (segments and vertices) of all geometries in the set
+/// are stored in a single R-tree. A query traverses this tree together
+/// with a tree of the facets of the query geometry using a
+/// Branch-and-Bound algorithm, visiting pairs of facets in order of
+/// increasing distance. The first facet pair found for a geometry
+/// therefore gives its exact distance to the query, and both
+/// k-nearest and within-distance queries complete in a single traversal
+/// without refining candidates separately.
+///
+/// As with IndexedFacetDistance, the distance of polygonal
+/// geometries is the distance to their boundaries.
+///
+/// The geometries must remain alive and unchanged for the lifetime
+/// of the index.
+class GEOS_DLL MultiIndexedFacetDistance {
+public:
+
+    /// A geometry of the set and its distance to a query geometry
+    struct Neighbour {
+        /// Index of the geometry in the set
+        std::size_t index;
+        /// Distance between the facets of the geometry and the query
+        double distance;
+    };
+
+    /// \brief Creates an index over the facets of a set of geometries.
+    ///
+    /// \param geoms the geometries, which may be of any linear type.
+    ///        Empty geometries are never returned by queries.
+    MultiIndexedFacetDistance(const std::vector<const geom::Geometry*>& geoms);
+
+    /// \brief Finds the geometries nearest to a query geometry.
+    ///
+    /// \param g the query geometry
+    /// \param k the maximum number of geometries to find
+    /// \return up to `k` geometries in order of increasing distance
+    std::vector<Neighbour> nearest(const geom::Geometry* g, std::size_t k) const;
+
+    /// \brief Finds the geometries within a distance of a query geometry.
+    ///
+    /// \param g the query geometry
+    /// \param maxDistance the maximum distance
+    /// \return the geometries at a distance of at most `maxDistance`,
+    ///         in order of increasing distance
+    std::vector<Neighbour> withinDistance(const geom::Geometry* g, double maxDistance) const;
+
+    /// Number of geometries in the set
+    std::size_t size() const
+    {
+        return numGeoms;
+    }
+
+private:
+    struct FacetDistance {
+        double operator()(const FacetSequence* a, const FacetSequence* b) const
+        {
+            return a->distance(*b);
+        }
+    };
+
+    std::vector<Neighbour> query(const geom::Geometry* g, std::size_t k, double maxDistance) const;
+
+    std::size_t numGeoms;
+    std::vector<FacetSequence> facets;
+    // index of the geometry containing each facet
+    std::vector<std::size_t> facetGeom;
+    std::unique_ptr<geos::index::strtree::TemplateSTRtree<const FacetSequence*>> tree;
+
+};
+}
+}
+}
+
@@ -0,0 +1,133 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+}
+namespace util {
+class TaskPool;
+}
+}
+
+namespace geos {
+namespace operation { // geos::operation
+namespace join {      // geos::operation::join
+
+/**
+ * \brief
+ * Finds the pairs of geometries from two collections that satisfy
+ * a spatial predicate.
+ *
+ * The join is an index-nested-loop join. An STRtree is built over the
+ * envelopes of the right-hand geometries and queried with the envelope
+ * of each left-hand geometry. Each candidate pair is then refined using
+ * the predicate. A left-hand geometry with several candidates is
+ * prepared once and the PreparedGeometry is reused for all of them.
+ *
+ * Predicates are evaluated with the left-hand geometry as the first
+ * argument, so `contains()` returns pairs where the left geometry
+ * contains the right geometry.
+ *
+ * Matches are returned as pairs of (left index, right index), sorted
+ * by left index and then by right index.
+ *
+ * The input geometries must not be modified while the join runs.
+ */
+class GEOS_DLL SpatialJoin {
+
+public:
+
+    using IndexPair = std::pair<std::size_t, std::size_t>;
+
+    /**
+     * Creates a join of two collections of geometries. Null or empty
+     * geometries never match.
+     *
+     * @param left the left-hand geometries
+     * @param right the right-hand geometries
+     */
+    SpatialJoin(const std::vector<const geom::Geometry*>& left,
+                const std::vector<const geom::Geometry*>& right);
+
+    /**
+     * Sets a pool of threads used to refine candidate pairs
+     * concurrently.
+     *
+     * @param pool the pool to use, or null to join on the calling thread
+     */
+    void setTaskPool(util::TaskPool* pool)
+    {
+        taskPool = pool;
+    }
+
+    /// Finds the pairs where the left geometry intersects the right geometry.
+    std::vector<IndexPair> intersects() const;
+
+    /// Finds the pairs where the left geometry contains the right geometry.
+    std::vector<IndexPair> contains() const;
+
+    /// Finds the pairs where the left geometry is within the right geometry.
+    std::vector<IndexPair> within() const;
+
+    /**
+     * Finds the pairs of geometries whose distance is less than or equal
+     * to the given distance.
+     *
+     * @param distance the maximum distance, which must be non-negative
+     */
+    std::vector<IndexPair> isWithinDistance(double distance) const;
+
+    /**
+     * Finds the pairs whose DE-9IM intersection matrix matches a pattern.
+     *
+     * Only pairs with intersecting envelopes are tested, so the pattern
+     * must require the geometries to intersect: at least one of the
+     * II, IB, BI or BB entries must be T, 0, 1 or 2.
+     *
+     * @param pattern a DE-9IM pattern
+     * @throws util::IllegalArgumentException if the pattern does not
+     *         require the geometries to intersect
+     */
+    std::vector<IndexPair> relate(const std::string& pattern) const;
+
+    /// Convenience method for intersects()
+    static std::vector<IndexPair> intersects(const std::vector<const geom::Geometry*>& left,
+                                             const std::vector<const geom::Geometry*>& right,
+                                             util::TaskPool* pool = nullptr);
+
+private:
+
+    const std::vector<const geom::Geometry*>& leftGeoms;
+    const std::vector<const geom::Geometry*>& rightGeoms;
+    util::TaskPool* taskPool;
+
+    template<typename Predicate>
+    std::vector<IndexPair> join(double distance, Predicate&& predicate) const;
+};
+
+
+} // namespace geos::operation::join
+} // namespace geos::operation
+} // namespace geos
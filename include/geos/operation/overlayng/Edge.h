@@ -194,6 +194,15 @@ public:
         return ptsCurved;
     }
 
+    /**
+    * Gets the depth delta of the edge for an input geometry,
+    * summed over the merged edges.
+    */
+    int getDepthDelta(uint8_t geomIndex) const
+    {
+        return geomIndex == 0 ? aDepthDelta : bDepthDelta;
+    }
+
     // return a clone of the underlying points
     std::unique_ptr<geom::CoordinateSequence> getCoordinates() const
     {
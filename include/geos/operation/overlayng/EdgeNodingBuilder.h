@@ -31,6 +31,8 @@
 #include <geos/geom/SimpleCurve.h>
 #include <geos/noding/ArcIntersectionAdder.h>
 #include <geos/noding/IntersectionAdder.h>
+#include <geos/noding/NodableArcString.h>
+#include <geos/noding/NodedSegmentString.h>
 #include <geos/noding/Noder.h>
 #include <geos/noding/SegmentString.h>
 #include <geos/operation/overlayng/Edge.h>
@@ -102,9 +104,12 @@ private:
     noding::ArcIntersectionAdder arcIntAdder;
     std::unique_ptr<noding::Noder> internalNoder;
     std::unique_ptr<noding::Noder> spareInternalNoder;
-    // EdgeSourceInfo*, Edge* owned by EdgeNodingBuilder, stored in deque
+    // EdgeSourceInfo*, Edge* and input PathString* owned by
+    // EdgeNodingBuilder, stored in deque
     std::deque<EdgeSourceInfo> edgeSourceInfoQue;
     std::deque<Edge> edgeQue;
+    std::deque<noding::NodedSegmentString> inputSegStringQue;
+    std::deque<noding::NodableArcString> inputArcStringQue;
     bool inputHasZ;
     bool inputHasM;
     bool inputHasCurves;
@@ -220,6 +225,14 @@ public:
 
     ~EdgeNodingBuilder();
 
+    /**
+    * Prepares the builder for noding another pair of geometries,
+    * with a new precision model and optional custom noder.
+    * The edges built by the previous call to build() are released,
+    * but the capacity of the input edge list is kept.
+    */
+    void reset(const PrecisionModel* p_pm, noding::Noder* p_customNoder);
+
     void setClipEnvelope(const Envelope* clipEnv);
 
     /**
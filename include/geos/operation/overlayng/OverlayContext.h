@@ -0,0 +1,118 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/CircularString.h>
+#include <geos/geom/CompoundCurve.h>
+#include <geos/operation/overlayng/EdgeNodingBuilder.h>
+#include <geos/operation/overlayng/OverlayGraph.h>
+
+#include <memory>
+
+// Forward declarations
+namespace geos {
+namespace geom {
+class Geometry;
+class PrecisionModel;
+}
+namespace noding {
+class Noder;
+}
+}
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+/**
+ * \brief
+ * Working storage which can be reused by a sequence of
+ * {@link OverlayNG} operations.
+ *
+ * An overlay normally creates its noding builder and topology graph
+ * from scratch, and releases them when it completes.
+ * When many small overlays are computed in turn (e.g. clipping
+ * features to tiles) the setup and teardown can cost more than the
+ * overlay itself. A context keeps the edge lists and the node map
+ * of the graph between operations, so that they are only grown
+ * by the largest operation.
+ * The edges of an operation are released when the next
+ * operation starts, or when the context is destroyed.
+ *
+ * A context must only be used by one operation at a time,
+ * so each thread should have its own.
+ *
+ * @see OverlayNG::setContext
+ */
+class GEOS_DLL OverlayContext {
+    using Geometry = geos::geom::Geometry;
+    using PrecisionModel = geos::geom::PrecisionModel;
+
+public:
+
+    OverlayContext();
+
+    OverlayContext(const OverlayContext&) = delete;
+    OverlayContext& operator=(const OverlayContext&) = delete;
+
+    /**
+    * Computes an overlay operation with the noding
+    * strategy determined by the precision model,
+    * as OverlayNG::overlay does.
+    *
+    * @param geom0 the first geometry argument
+    * @param geom1 the second geometry argument
+    * @param opCode the code for the desired overlay operation
+    * @param pm the precision model to use
+    * @return the result of the overlay operation
+    */
+    std::unique_ptr<Geometry> overlay(const Geometry* geom0, const Geometry* geom1,
+                                      int opCode, const PrecisionModel* pm);
+
+    /**
+    * Computes an overlay operation using the
+    * strategies of OverlayNGRobust::Overlay.
+    *
+    * @param geom0 the first geometry argument
+    * @param geom1 the second geometry argument
+    * @param opCode the code for the desired overlay operation
+    * @return the result of the overlay operation
+    */
+    std::unique_ptr<Geometry> overlayRobust(const Geometry* geom0, const Geometry* geom1,
+                                            int opCode);
+
+    /**
+    * Gets the noding builder, reset for a new operation.
+    */
+    EdgeNodingBuilder& getNodingBuilder(const PrecisionModel* pm, noding::Noder* noder);
+
+    /**
+    * Gets the topology graph, emptied and with storage
+    * reserved for the given number of edges.
+    */
+    OverlayGraph& getGraph(std::size_t numEdges);
+
+private:
+
+    EdgeNodingBuilder nodingBuilder;
+    OverlayGraph graph;
+
+};
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
@@ -89,9 +89,22 @@ public:
     */
     OverlayGraph();
 
+    /**
+    * Creates a new graph with storage reserved for the
+    * given number of {@link Edge}s.
+    */
+    explicit OverlayGraph(std::size_t numEdges);
+
     OverlayGraph(const OverlayGraph& g) = delete;
     OverlayGraph& operator=(const OverlayGraph& g) = delete;
 
+    /**
+    * Removes all edges and nodes from the graph,
+    * keeping the capacity of the edge list and node map,
+    * and reserves storage for the given number of {@link Edge}s.
+    */
+    void reset(std::size_t numEdges);
+
     /**
     * Adds an edge between the coordinates orig and dest
     * to this graph.
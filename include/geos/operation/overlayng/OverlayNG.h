@@ -37,6 +37,7 @@ class Noder;
 }
 namespace operation {
 namespace overlayng {
+class OverlayContext;
 }
 }
 }
@@ -130,6 +131,7 @@ private:
     const geom::GeometryFactory* geomFact;
     int opCode;
     noding::Noder* noder;
+    OverlayContext* context;
     bool isStrictMode;
     bool isOptimized;
     bool isAreaResultOnly;
@@ -188,6 +190,7 @@ public:
         , geomFact(p_geomFact)
         , opCode(p_opCode)
         , noder(nullptr)
+        , context(nullptr)
         , isStrictMode(STRICT_MODE_DEFAULT)
         , isOptimized(true)
         , isAreaResultOnly(false)
@@ -207,6 +210,7 @@ public:
         , geomFact(geom0->getFactory())
         , opCode(p_opCode)
         , noder(nullptr)
+        , context(nullptr)
         , isStrictMode(STRICT_MODE_DEFAULT)
         , isOptimized(true)
         , isAreaResultOnly(false)
@@ -251,6 +255,14 @@ public:
     void setOutputResultEdges(bool p_isOutputResultEdges) { isOutputResultEdges = p_isOutputResultEdges; }
     void setNoder(noding::Noder* p_noder) { noder = p_noder; }
 
+    /**
+    * Sets a context whose working storage is reused
+    * by the operation, instead of allocating its own.
+    *
+    * @param p_context the context to use, or nullptr
+    */
+    void setContext(OverlayContext* p_context) { context = p_context; }
+
     void setOutputNodedEdges(bool p_isOutputNodedEdges)
     {
         isOutputEdges = true;
@@ -29,6 +29,11 @@ namespace geos {
 namespace geom {
 class Geometry;
 }
+namespace operation {
+namespace overlayng {
+class OverlayContext;
+}
+}
 }
 
 namespace geos {      // geos.
@@ -154,6 +159,17 @@ public:
     static std::unique_ptr<Geometry> Overlay(
         const Geometry* geom0, const Geometry* geom1, int opCode);
 
+    /**
+    * Computes an overlay operation, reusing the working storage
+    * of a context for the fixed and floating precision attempts.
+    * The snapping fallbacks allocate their own storage.
+    *
+    * @param context the context to use, or nullptr
+    */
+    static std::unique_ptr<Geometry> Overlay(
+        const Geometry* geom0, const Geometry* geom1, int opCode,
+        OverlayContext* context);
+
     static std::unique_ptr<Geometry> overlaySnapTries(
         const Geometry* geom0, const Geometry* geom1, int opCode);
 
@@ -21,6 +21,7 @@
 #include <geos/operation/overlayng/OverlayEdgeRing.h>
 #include <geos/operation/overlayng/MaximalEdgeRing.h>
 
+#include <deque>
 #include <vector>
 
 
@@ -53,7 +54,11 @@ private:
     bool isEnforcePolygonal;
 
     // Storage
-    std::vector<std::unique_ptr<OverlayEdgeRing>> vecOER;
+    // The lifespan of the rings is tied to the lifespan of the
+    // PolygonBuilder, so we hold them in std::deque storage
+    // and use bare pointers for managing the relationships
+    std::deque<MaximalEdgeRing> maxRingQue;
+    std::deque<OverlayEdgeRing> minRingQue;
 
     std::vector<std::unique_ptr<geom::Surface>> computePolygons(const std::vector<OverlayEdgeRing*>& shellList) const;
 
@@ -64,17 +69,9 @@ private:
     /**
     * For all OverlayEdge*s in result, form them into MaximalEdgeRings
     */
-    static std::vector<std::unique_ptr<MaximalEdgeRing>>
-        buildMaximalRings(const std::vector<OverlayEdge *> &edges);
+    std::vector<MaximalEdgeRing*> buildMaximalRings(const std::vector<OverlayEdge *> &edges);
 
-    /**
-    * The lifespan of the OverlayEdgeRings is tieds to the lifespan
-    * of the PolygonBuilder, so we hold them on the PolygonBuilder
-    * and use bare pointers for managing the relationships
-    */
-    std::vector<OverlayEdgeRing*> storeMinimalRings(std::vector<std::unique_ptr<OverlayEdgeRing>>& minRings);
-
-    void buildMinimalRings(const std::vector<std::unique_ptr<MaximalEdgeRing>>& maxRings);
+    void buildMinimalRings(const std::vector<MaximalEdgeRing*>& maxRings);
 
     void assignShellsAndHoles(const std::vector<OverlayEdgeRing *> &minRings);
 
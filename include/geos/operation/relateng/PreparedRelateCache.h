@@ -0,0 +1,165 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/operation/relateng/RelateNG.h>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace geos {      // geos.
+namespace operation { // geos.operation
+namespace relateng { // geos.operation.relateng
+
+/**
+ * A least-recently-used cache of prepared RelateNG instances
+ * for the geometries which have been added to it explicitly.
+ *
+ * Callers which evaluate predicates for the same A geometry
+ * against many B geometries add() it to the cache, and ask the cache
+ * for a prepared instance on each call. An added geometry is prepared
+ * by the first get() call for it. Prepared instances are evicted in
+ * least-recently-used order to stay within a memory budget, and an
+ * evicted geometry is prepared again when it is next used.
+ * Geometries which have not been added are ignored.
+ *
+ * Geometries are identified by address, so callers must remove()
+ * a geometry before destroying or modifying it. As a safeguard
+ * the type, number of points and envelope of a prepared geometry
+ * are checked on every lookup, and it is prepared again if they
+ * have changed.
+ *
+ * The cache is not thread-safe.
+ */
+class GEOS_DLL PreparedRelateCache {
+    using Envelope = geos::geom::Envelope;
+    using Geometry = geos::geom::Geometry;
+
+public:
+
+    /**
+     * Creates a cache.
+     *
+     * @param maxMemory the budget for the estimated memory of the prepared instances, in bytes
+     */
+    explicit PreparedRelateCache(std::size_t maxMemory);
+
+    PreparedRelateCache(const PreparedRelateCache&) = delete;
+    PreparedRelateCache& operator=(const PreparedRelateCache&) = delete;
+
+    /**
+     * Adds a geometry to the cache, so that get() can prepare it.
+     * The geometry must be removed before it is destroyed or modified.
+     */
+    void add(const Geometry* geom);
+
+    /**
+     * Gets the prepared instance for a geometry,
+     * preparing it if it is not in the cache.
+     *
+     * @param geom the geometry
+     * @return the prepared instance, or nullptr if the geometry has not
+     *         been added or is larger than the memory budget
+     */
+    RelateNG* get(const Geometry* geom);
+
+    /**
+     * Removes a geometry from the cache.
+     */
+    void remove(const Geometry* geom);
+
+    /**
+     * Removes all geometries from the cache.
+     * The hit and miss counts are not reset.
+     */
+    void clear();
+
+    /// Tests whether no geometries have been added
+    bool isEmpty() const { return added.empty(); }
+
+    /// Tests whether a geometry has been added
+    bool contains(const Geometry* geom) const { return added.count(geom) > 0; }
+
+    /// Number of lookups of added geometries which found a prepared instance
+    std::size_t getHits() const { return hits; }
+
+    /// Number of lookups of added geometries which did not find a prepared instance
+    std::size_t getMisses() const { return misses; }
+
+    /// Estimated memory of the prepared instances, in bytes
+    std::size_t getMemoryUsed() const { return memoryUsed; }
+
+    /// Number of prepared instances in the cache
+    std::size_t size() const { return entries.size(); }
+
+    /**
+     * Estimates the memory used by a prepared instance for a geometry.
+     */
+    static std::size_t estimateMemory(const Geometry* geom);
+
+private:
+
+    /*
+     * Properties of a geometry which are checked
+     * to detect reuse of its address.
+     */
+    struct Fingerprint {
+        geom::GeometryTypeId typeId;
+        std::size_t numPoints;
+        Envelope env;
+
+        explicit Fingerprint(const Geometry* geom);
+
+        bool operator==(const Fingerprint& other) const
+        {
+            return typeId == other.typeId
+                && numPoints == other.numPoints
+                && env == other.env;
+        }
+    };
+
+    struct Entry {
+        const Geometry* geom;
+        Fingerprint fingerprint;
+        std::unique_ptr<RelateNG> prepared;
+        std::size_t memory;
+    };
+
+    std::size_t maxMemory;
+    std::size_t memoryUsed = 0;
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+
+    // most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<const Geometry*, std::list<Entry>::iterator> entryMap;
+    std::unordered_set<const Geometry*> added;
+
+    RelateNG* insert(const Geometry* geom, const Fingerprint& fingerprint);
+
+    void evict(std::list<Entry>::iterator it);
+
+};
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
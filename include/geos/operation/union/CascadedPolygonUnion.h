@@ -36,6 +36,9 @@ class Surface;
 class MultiPolygon;
 class Envelope;
 }
+namespace util {
+class TaskPool;
+}
 }
 
 namespace geos {
@@ -105,6 +108,7 @@ class GEOS_DLL CascadedPolygonUnion {
 private:
     const std::vector<const geom::Surface*>& inputPolys;
     geom::GeometryFactory const* geomFactory;
+    geos::util::TaskPool* taskPool;
 
     /**
      * The effectiveness of the index is somewhat sensitive
@@ -141,7 +145,7 @@ public:
      *              ownership of elements *and* vector are left to caller.
      */
     static std::unique_ptr<geom::Geometry> Union(const std::vector<const geom::Surface*>& polys);
-    static std::unique_ptr<geom::Geometry> Union(const std::vector<const geom::Surface*>& polys, UnionStrategy* unionFun, geos::util::ProgressFunction* progressFunction);
+    static std::unique_ptr<geom::Geometry> Union(const std::vector<const geom::Surface*>& polys, UnionStrategy* unionFun, geos::util::ProgressFunction* progressFunction, geos::util::TaskPool* taskPool = nullptr);
 
     /** \brief
      * Computes the union of a set of surface [Geometrys](@ref geom::Geometry).
@@ -151,17 +155,18 @@ public:
      * @param end end iterator
      * @param unionStrategy strategy to apply
      * @param progressFunction progress function
+     * @param taskPool pool on which to union independent subtrees, or null
      */
     template <class T>
     static std::unique_ptr<geom::Geometry>
-    Union(T start, T end, UnionStrategy *unionStrategy, geos::util::ProgressFunction* progressFunction)
+    Union(T start, T end, UnionStrategy *unionStrategy, geos::util::ProgressFunction* progressFunction, geos::util::TaskPool* taskPool = nullptr)
     {
         std::vector<const geom::Surface*> polys;
         for(T i = start; i != end; ++i) {
             const auto* p = dynamic_cast<const geom::Surface*>(*i);
             polys.push_back(p);
         }
-        return Union(polys, unionStrategy, progressFunction);
+        return Union(polys, unionStrategy, progressFunction, taskPool);
     }
 
     /** \brief
@@ -183,15 +188,32 @@ public:
     explicit CascadedPolygonUnion(const std::vector<const geom::Surface*>& polys)
         : inputPolys(polys)
         , geomFactory(nullptr)
+        , taskPool(nullptr)
         , unionFunction(&defaultUnionFunction)
     {}
 
     CascadedPolygonUnion(const std::vector<const geom::Surface*>& polys, UnionStrategy* unionFun)
         : inputPolys(polys)
         , geomFactory(nullptr)
+        , taskPool(nullptr)
         , unionFunction(unionFun)
     {}
 
+    /** \brief
+     * Sets a pool of threads used to union independent subtrees
+     * of the input concurrently.
+     *
+     * The union strategy must be safe to call from several threads
+     * at once, and the progress function may be invoked from any
+     * thread of the pool (though never concurrently).
+     *
+     * @param pool the pool to use, or null to union sequentially
+     */
+    void setTaskPool(geos::util::TaskPool* pool)
+    {
+        taskPool = pool;
+    }
+
     /** \brief
      * Computes the union of the input geometries.
      *
@@ -43,6 +43,9 @@ namespace geom {
 class GeometryFactory;
 class Geometry;
 }
+namespace util {
+class TaskPool;
+}
 }
 
 namespace geos {
@@ -109,9 +112,11 @@ public:
     }
 
     static std::unique_ptr<geom::Geometry>
-    Union(const geom::Geometry& geom, geos::util::ProgressFunction* progressFunction)
+    Union(const geom::Geometry& geom, geos::util::ProgressFunction* progressFunction,
+          geos::util::TaskPool* taskPool = nullptr)
     {
         UnaryUnionOp op(geom);
+        op.setTaskPool(taskPool);
         return op.Union(progressFunction);
     }
 
@@ -119,6 +124,7 @@ public:
     UnaryUnionOp(const T& geoms, geom::GeometryFactory& geomFactIn)
         : geomFact(&geomFactIn)
         , unionFunction(&defaultUnionFunction)
+        , taskPool(nullptr)
     {
         extractGeoms(geoms);
     }
@@ -127,6 +133,7 @@ public:
     UnaryUnionOp(const T& geoms)
         : geomFact(nullptr)
         , unionFunction(&defaultUnionFunction)
+        , taskPool(nullptr)
     {
         extractGeoms(geoms);
     }
@@ -134,6 +141,7 @@ public:
     UnaryUnionOp(const geom::Geometry& geom)
         : geomFact(geom.getFactory())
         , unionFunction(&defaultUnionFunction)
+        , taskPool(nullptr)
     {
         extract(geom);
     }
@@ -143,6 +151,17 @@ public:
         unionFunction = unionFun;
     }
 
+    /**
+     * Sets a pool of threads used to union polygonal components
+     * concurrently. See CascadedPolygonUnion::setTaskPool.
+     *
+     * @param pool the pool to use, or null to union sequentially
+     */
+    void setTaskPool(geos::util::TaskPool* pool)
+    {
+        taskPool = pool;
+    }
+
     /**
      * \brief
      * Gets the union of the input geometries.
@@ -219,6 +238,8 @@ private:
     UnionStrategy* unionFunction;
     ClassicUnionStrategy defaultUnionFunction;
 
+    geos::util::TaskPool* taskPool;
+
 };
 
 
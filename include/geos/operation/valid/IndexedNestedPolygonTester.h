@@ -30,6 +30,9 @@ class Polygon;
 class LinearRing;
 class MultiPolygon;
 }
+namespace util {
+class TaskPool;
+}
 }
 
 
@@ -45,18 +48,34 @@ class GEOS_DLL IndexedNestedPolygonTester {
     using IndexedPointInAreaLocator = algorithm::locate::IndexedPointInAreaLocator;
     template<typename ItemType>
     using TemplateSTRtree = index::strtree::TemplateSTRtree<ItemType>;
+    using LocatorMap = std::map<const Polygon*, IndexedPointInAreaLocator>;
 
 private:
 
     const MultiPolygon* multiPoly;
     TemplateSTRtree<const Polygon*> index;
     // std::vector<IndexedPointInAreaLocator> locators;
-    std::map<const Polygon*, IndexedPointInAreaLocator> locators;
+    LocatorMap locators;
     CoordinateXY nestedPt;
 
     void loadIndex();
 
-    IndexedPointInAreaLocator& getLocator(const Polygon* poly);
+    static IndexedPointInAreaLocator& getLocator(LocatorMap& locatorMap, const Polygon* poly);
+
+    /**
+    * Finds a point of a polygon shell which lies in the interior
+    * of another polygon, if any.
+    *
+    * @param poly the polygon to test
+    * @param locatorMap the locators of the polygons tested against
+    * @param coordNested return parameter for found coordinate
+    * @return true if the polygon is nested
+    */
+    bool findNestedPoint(const Polygon* poly,
+        LocatorMap& locatorMap,
+        CoordinateXY& coordNested);
+
+    bool isNestedParallel(util::TaskPool* pool);
 
     bool findNestedPoint(const LinearRing* shell,
         const Polygon* possibleOuterPoly,
@@ -101,6 +120,16 @@ public:
     */
     bool isNested();
 
+    /**
+    * Tests if any polygon is nested within another polygon,
+    * testing the polygons concurrently.
+    * The nested point is the same as found by isNested().
+    *
+    * @param pool the pool to use, or null to test on the calling thread
+    * @return true if some polygon is nested
+    */
+    bool isNested(util::TaskPool* pool);
+
 
 };
 
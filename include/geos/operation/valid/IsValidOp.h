@@ -40,6 +40,9 @@ namespace locate {
 class IndexedPointInAreaLocator;
 }
 }
+namespace util {
+class TaskPool;
+}
 }
 
 
@@ -62,6 +65,9 @@ private:
     static constexpr int MIN_SIZE_LINESTRING = 2;
     static constexpr int MIN_SIZE_RING = 4;
 
+    // Number of consecutive polygons checked by a task
+    static constexpr std::size_t POLYGON_GRAIN_SIZE = 16;
+
     /**
     * The geometry being validated
     */
@@ -71,6 +77,7 @@ private:
     * inverted shells and exverted holes (the ESRI SDE model)
     */
     bool isInvertedRingValid = false;
+    util::TaskPool* taskPool = nullptr;
     std::unique_ptr<TopologyValidationError> validErr;
 
     bool hasInvalidError()
@@ -125,11 +132,21 @@ private:
      */
     bool isValid(const geom::GeometryCollection* gc);
 
+    /**
+     * Applies a check to each element polygon, stopping at the first
+     * invalid one. If a TaskPool is set the polygons are checked
+     * concurrently, and the error of the lowest-indexed invalid
+     * polygon is reported.
+     */
+    void checkPolygons(const geom::MultiPolygon* mp,
+                       void (IsValidOp::*check)(const geom::Polygon*));
+
     void checkCoordinatesValid(const geom::CoordinateSequence* coords);
     void checkCoordinatesValid(const geom::Polygon* poly);
     void checkRingClosed(const geom::LinearRing* ring);
     void checkRingsClosed(const geom::Polygon* poly);
     void checkRingsPointSize(const geom::Polygon* poly);
+    void checkRingsValid(const geom::Polygon* poly);
     void checkRingPointSize(const geom::LinearRing* ring);
 
     /**
@@ -256,6 +273,20 @@ public:
         isInvertedRingValid = p_isValid;
     };
 
+    /**
+     * Sets a pool of threads used to validate the elements of
+     * collections concurrently. The per-polygon checks of a
+     * MultiPolygon and the test for nested shells are also run
+     * concurrently. The reported error is the same as when
+     * validating on a single thread.
+     *
+     * @param pool the pool to use, or null to validate on the calling thread
+     */
+    void setTaskPool(util::TaskPool* pool)
+    {
+        taskPool = pool;
+    }
+
     /**
      * Tests whether a Geometry is valid.
      * @param geom the Geometry to test
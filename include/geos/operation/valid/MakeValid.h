@@ -35,6 +35,9 @@ namespace geos {
 namespace geom {
 class Geometry;
 }
+namespace util {
+class TaskPool;
+}
 }
 
 namespace geos {
@@ -63,8 +66,23 @@ public:
 
     ~MakeValid() = default;
 
+    /** \brief
+     * Sets a pool of threads used to validate the input and to
+     * repair the elements of a GeometryCollection concurrently.
+     *
+     * @param pool the pool to use, or null to repair on the calling thread
+     */
+    void setTaskPool(util::TaskPool* pool)
+    {
+        taskPool = pool;
+    }
+
     /** \brief Return a valid version of the input geometry. */
     std::unique_ptr<geom::Geometry> build(const geom::Geometry* geom);
+
+private:
+
+    util::TaskPool* taskPool = nullptr;
 };
 
 } // namespace geos::operation::valid
@@ -76,6 +76,14 @@ public:
      */
     static ThreadCallback* registerCallback(ThreadCallback* cb, void* data);
 
+    /** \brief
+     * Get the callback registered for the current thread, if any.
+     *
+     * @param data if not null, receives the user data registered
+     *             with the callback
+     */
+    static ThreadCallback* getCallback(void** data);
+
     static void process();
 
     static void interrupt();
@@ -0,0 +1,268 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#pragma once
+
+#include <geos/export.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable: 4251) // warning C4251: needs to have dll-interface to be used by clients of class
+#endif
+
+namespace geos {
+namespace util { // geos::util
+
+class TaskGroup;
+
+/** \brief
+ * A fixed-size pool of worker threads executing fork-join tasks.
+ *
+ * Each worker owns a double-ended queue of tasks. Tasks submitted
+ * from a worker are pushed onto its own queue and popped in LIFO
+ * order, while idle workers steal the oldest task from other queues.
+ * Tasks submitted from outside the pool go to a shared queue.
+ *
+ * Tasks are submitted and awaited through a TaskGroup. A thread
+ * waiting on a TaskGroup executes pending tasks itself rather than
+ * blocking, so a pool with N workers provides up to N+1-way
+ * parallelism and nested groups cannot deadlock.
+ *
+ * A TaskPool is thread-safe, and may be shared by operations running
+ * concurrently on different threads.
+ */
+class GEOS_DLL TaskPool {
+
+public:
+
+    /** \brief
+     * Creates a pool with the given number of worker threads.
+     *
+     * @param numWorkers the number of worker threads to start.
+     *                   A pool with no workers runs every task
+     *                   on the thread waiting for it.
+     */
+    explicit TaskPool(std::size_t numWorkers);
+
+    ~TaskPool();
+
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+
+    /**
+     * Gets the number of worker threads in the pool.
+     */
+    std::size_t getNumWorkers() const
+    {
+        return workers.size();
+    }
+
+    /**
+     * Gets the number of threads able to run tasks of this pool
+     * concurrently, including the thread waiting on a TaskGroup.
+     */
+    std::size_t getConcurrency() const
+    {
+        return workers.size() + 1;
+    }
+
+    /**
+     * Gets the number of hardware threads available, or 1 if
+     * this cannot be determined.
+     */
+    static std::size_t hardwareConcurrency();
+
+private:
+
+    friend class TaskGroup;
+
+    struct Task {
+        std::function<void()> fn;
+        TaskGroup* group;
+    };
+
+    struct WorkQueue {
+        std::mutex mtx;
+        std::deque<Task> tasks;
+    };
+
+    void submit(Task&& task);
+
+    /**
+     * Runs a single pending task, if one is available.
+     *
+     * @return true if a task was executed
+     */
+    bool runPendingTask();
+
+    bool popTask(Task& task);
+
+    void workerLoop(std::size_t index);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues; // one per worker, followed by the shared queue
+    std::vector<std::thread> workers;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCond;
+    std::atomic<std::size_t> numPending;
+    bool stopping;
+};
+
+
+/** \brief
+ * A set of tasks run on a TaskPool, which can be awaited together.
+ *
+ * If any task throws an exception, tasks of the group that have not
+ * started yet are skipped, and the first exception is rethrown by
+ * wait().
+ *
+ * The interrupt callback registered with
+ * geos::util::CurrentThreadInterrupt on the thread creating the group
+ * is invoked (serialized) by every thread running tasks of the group,
+ * so that an interruption request cancels all of them.
+ *
+ * If no pool is provided, tasks are executed immediately by run().
+ */
+class GEOS_DLL TaskGroup {
+
+public:
+
+    explicit TaskGroup(TaskPool* pool);
+
+    /**
+     * Waits for outstanding tasks. Exceptions thrown by tasks
+     * are discarded; call wait() to observe them.
+     */
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * Submits a task to the group.
+     */
+    void run(std::function<void()> fn);
+
+    /** \brief
+     * Waits for all tasks submitted to the group to complete,
+     * running pending tasks on the calling thread meanwhile.
+     *
+     * Rethrows the first exception thrown by a task.
+     */
+    void wait();
+
+    /**
+     * Tests whether a task of the group has failed, in which case
+     * long-running tasks may choose to return early.
+     */
+    bool isCancelled() const
+    {
+        return cancelled.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    friend class TaskPool;
+
+    void execute(std::function<void()>& fn);
+
+    void waitAll() noexcept;
+
+    static int checkInterrupt(void* data);
+
+    TaskPool* pool;
+    std::atomic<std::size_t> numOutstanding;
+    std::atomic<bool> cancelled;
+    std::mutex stateMutex;
+    std::condition_variable doneCond;
+    std::exception_ptr error;
+
+    std::mutex interruptMutex;
+    int (*interruptCallback)(void*);
+    void* interruptData;
+};
+
+
+/** \brief
+ * Invokes `fn(i)` for every `i` in `[0, n)`, distributing the indices
+ * over the threads of a TaskPool in chunks of `grainSize`.
+ *
+ * If `pool` is null the indices are processed in order on the
+ * calling thread.
+ *
+ * @param pool the pool to use, or null
+ * @param n the number of indices
+ * @param fn the function to invoke for each index
+ * @param grainSize the number of consecutive indices handled by a task
+ */
+template<typename F>
+void parallelFor(TaskPool* pool, std::size_t n, F&& fn, std::size_t grainSize = 1)
+{
+    if (grainSize == 0) {
+        grainSize = 1;
+    }
+
+    if (pool == nullptr || n <= grainSize || pool->getNumWorkers() == 0) {
+        for (std::size_t i = 0; i < n; i++) {
+            fn(i);
+        }
+        return;
+    }
+
+    TaskGroup group(pool);
+    std::atomic<std::size_t> next{0};
+
+    auto worker = [&group, &next, &fn, n, grainSize]() {
+        for (;;) {
+            if (group.isCancelled()) {
+                return;
+            }
+            std::size_t start = next.fetch_add(grainSize);
+            if (start >= n) {
+                return;
+            }
+            std::size_t end = std::min(n, start + grainSize);
+            for (std::size_t i = start; i < end; i++) {
+                fn(i);
+            }
+        }
+    };
+
+    std::size_t numChunks = (n + grainSize - 1) / grainSize;
+    std::size_t numTasks = std::min(pool->getConcurrency(), numChunks);
+    for (std::size_t i = 0; i < numTasks; i++) {
+        group.run(worker);
+    }
+    group.wait();
+}
+
+
+} // namespace geos::util
+} // namespace geos
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
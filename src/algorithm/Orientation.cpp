@@ -23,6 +23,7 @@
 #include <geos/algorithm/Area.h>
 #include <geos/algorithm/Orientation.h>
 #include <geos/algorithm/CGAlgorithmsDD.h>
+#include <geos/geom/CoordinateKernels.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/util/IllegalArgumentException.h>
@@ -64,19 +65,24 @@ Orientation::isCCW(const geom::CoordinateSequence* ring)
     const CoordinateXY* upHiPt = &ring->getAt<CoordinateXY>(0);
     const CoordinateXY* upLowPt = &CoordinateXY::getNull();
 
-    double prevY = upHiPt->y;
+    /**
+     * The highest rising segment endpoint is found with a vector scan,
+     * then the last endpoint at that height is located.
+     * This is the last upwards segment whose endpoint is at least as
+     * high as all earlier ones (and the start point).
+     */
     uint32_t iUpHi = 0;
-    for (uint32_t i = 1; i <= nPts; i++) {
-        double py = ring->getY(i);
-        /**
-        * If segment is upwards and endpoint is higher, record it
-        */
-        if (py > prevY && py >= upHiPt->y) {
-            iUpHi = i;
-            upHiPt = &ring->getAt<CoordinateXY>(i);
-            upLowPt = &ring->getAt<CoordinateXY>(i-1);
+    double maxRisingY = geom::CoordinateKernels::maxRisingY(ring->data(), nPts + 1, ring->stride());
+    if (maxRisingY >= upHiPt->y) {
+        for (uint32_t i = nPts; i > 0; i--) {
+            double py = ring->getY(i);
+            if (py == maxRisingY && py > ring->getY(i - 1)) {
+                iUpHi = i;
+                upHiPt = &ring->getAt<CoordinateXY>(i);
+                upLowPt = &ring->getAt<CoordinateXY>(i-1);
+                break;
+            }
         }
-        prevY = py;
     }
     /**
      * Check if ring is flat and return default value if so
@@ -23,6 +23,8 @@
 #include <geos/util/math.h>
 #include <geos/util/Interrupt.h>
 
+#include <algorithm>
+#include <limits>
 #include <unordered_map>
 
 using geos::geom::Geometry;
@@ -67,13 +69,20 @@ DiscreteFrechetDistance::distance()
 
     std::unique_ptr<CoordinateSequence> coords0;
     std::unique_ptr<CoordinateSequence> coords1;
-    if (densifyFraction < 0) {
-        coords0 = g0.getCoordinates();
-        coords1 = g1.getCoordinates();
-    }
-    else {
-        coords0 = getDensifiedCoordinates(g0, densifyFraction);
-        coords1 = getDensifiedCoordinates(g1, densifyFraction);
+    getInputCoordinates(coords0, coords1);
+
+    /*
+     * The distance matrix of long inputs is too large to store,
+     * so compute the distance over the band of the matrix
+     * within the distance of a known coupling.
+     */
+    if (std::max(coords0->size(), coords1->size()) >= BANDED_MIN_SIZE) {
+        double maxDistance = greedyCouplingDistance(*coords0, *coords1);
+        ptDist = computeFrechetBanded(*coords0, *coords1, maxDistance);
+        if (ptDist == nullptr) {
+            throw geos::util::IllegalStateException("No coupling found within the distance of a known coupling");
+        }
+        return ptDist->getDistance();
     }
 
     std::unique_ptr<MatrixStorage> distances = createMatrixStorage(coords0->size(), coords1->size());
@@ -85,6 +94,52 @@ DiscreteFrechetDistance::distance()
     return ptDist->getDistance();
 }
 
+/* public static */
+bool
+DiscreteFrechetDistance::isWithinDistance(const Geometry& geom0, const Geometry& geom1, double maxDistance)
+{
+    DiscreteFrechetDistance dist(geom0, geom1);
+    return dist.isWithinDistance(maxDistance);
+}
+
+
+/* public */
+bool
+DiscreteFrechetDistance::isWithinDistance(double maxDistance)
+{
+    if (g0.isEmpty() || g1.isEmpty()) {
+        throw util::IllegalArgumentException(
+            "DiscreteFrechetDistance called with empty inputs.");
+    }
+
+    util::ensureNoCurvedComponents(g0);
+    util::ensureNoCurvedComponents(g1);
+
+    std::unique_ptr<CoordinateSequence> coords0;
+    std::unique_ptr<CoordinateSequence> coords1;
+    getInputCoordinates(coords0, coords1);
+
+    return computeFrechetBanded(*coords0, *coords1, maxDistance) != nullptr;
+}
+
+
+/* private */
+void
+DiscreteFrechetDistance::getInputCoordinates(
+    std::unique_ptr<CoordinateSequence>& coords0,
+    std::unique_ptr<CoordinateSequence>& coords1) const
+{
+    if (densifyFraction < 0) {
+        coords0 = g0.getCoordinates();
+        coords1 = g1.getCoordinates();
+    }
+    else {
+        coords0 = getDensifiedCoordinates(g0, densifyFraction);
+        coords1 = getDensifiedCoordinates(g1, densifyFraction);
+    }
+}
+
+
 /* public */
 void
 DiscreteFrechetDistance::setDensifyFraction(double dFrac)
@@ -186,6 +241,166 @@ DiscreteFrechetDistance::computeFrechet(
 }
 
 
+/* private static */
+std::unique_ptr<PointPairDistance>
+DiscreteFrechetDistance::computeFrechetBanded(
+    const CoordinateSequence& coords0, const CoordinateSequence& coords1,
+    double maxDistance)
+{
+    // Store rows along the shorter sequence
+    bool isFlipped = coords1.size() > coords0.size();
+    const CoordinateSequence& rowCoords = isFlipped ? coords1 : coords0;
+    const CoordinateSequence& colCoords = isFlipped ? coords0 : coords1;
+    std::size_t numRows = rowCoords.size();
+    std::size_t numCols = colCoords.size();
+
+    /*
+     * A cell holds the smallest maximum point distance of the
+     * couplings ending at it, and the pair of points at that distance.
+     * Cells further than maxDistance, or which cannot be reached
+     * from the start through such cells, are unreachable.
+     */
+    struct Cell {
+        double dist;
+        std::size_t i;
+        std::size_t j;
+    };
+    static constexpr double UNREACHABLE = std::numeric_limits<double>::infinity();
+
+    auto pointDistance = [&](std::size_t i, std::size_t j) {
+        return rowCoords.getAt<CoordinateXY>(i).distance(colCoords.getAt<CoordinateXY>(j));
+    };
+
+    std::vector<Cell> prev(numCols);
+    std::vector<Cell> cur(numCols);
+    // range of the previous row holding reachable cells
+    std::size_t prevLo = 0;
+    std::size_t prevHi = 0;
+
+    for (std::size_t i = 0; i < numRows; i++) {
+        GEOS_CHECK_FOR_INTERRUPTS();
+
+        bool hasReachable = false;
+        std::size_t lo = 0;
+        std::size_t hi = 0;
+
+        // cells left of the previous row's range cannot be reached
+        std::size_t jStart = i == 0 ? 0 : prevLo;
+        for (std::size_t j = jStart; j < numCols; j++) {
+            const Cell* best = nullptr;
+            auto consider = [&best](const Cell& c) {
+                if (c.dist != UNREACHABLE && (best == nullptr || c.dist < best->dist)) {
+                    best = &c;
+                }
+            };
+            if (j > jStart) {
+                consider(cur[j - 1]);
+            }
+            if (i > 0) {
+                if (j >= prevLo && j <= prevHi) {
+                    consider(prev[j]);
+                }
+                if (j > prevLo && j - 1 <= prevHi) {
+                    consider(prev[j - 1]);
+                }
+            }
+
+            bool isStart = i == 0 && j == 0;
+            if (best == nullptr && !isStart) {
+                // nothing further right in this row can be reached
+                if (i == 0 || j > prevHi) {
+                    break;
+                }
+                cur[j] = { UNREACHABLE, 0, 0 };
+                continue;
+            }
+
+            double dist = pointDistance(i, j);
+            if (dist > maxDistance) {
+                cur[j] = { UNREACHABLE, 0, 0 };
+                continue;
+            }
+
+            if (isStart || dist >= best->dist) {
+                cur[j] = { dist, i, j };
+            }
+            else {
+                cur[j] = *best;
+            }
+
+            if (!hasReachable) {
+                lo = j;
+                hasReachable = true;
+            }
+            hi = j;
+        }
+
+        // no coupling can stay within maxDistance
+        if (!hasReachable) {
+            return nullptr;
+        }
+
+        std::swap(prev, cur);
+        prevLo = lo;
+        prevHi = hi;
+    }
+
+    if (prevHi != numCols - 1) {
+        return nullptr;
+    }
+
+    const Cell& end = prev[numCols - 1];
+    std::size_t index0 = isFlipped ? end.j : end.i;
+    std::size_t index1 = isFlipped ? end.i : end.j;
+    auto result = std::make_unique<PointPairDistance>();
+    result->initialize(coords0.getAt<CoordinateXY>(index0), coords1.getAt<CoordinateXY>(index1), end.dist * end.dist);
+    return result;
+}
+
+
+/* private static */
+double
+DiscreteFrechetDistance::greedyCouplingDistance(
+    const CoordinateSequence& coords0, const CoordinateSequence& coords1)
+{
+    std::size_t n0 = coords0.size();
+    std::size_t n1 = coords1.size();
+    std::size_t i = 0;
+    std::size_t j = 0;
+
+    auto pointDistance = [&](std::size_t i0, std::size_t j0) {
+        return coords0.getAt<CoordinateXY>(i0).distance(coords1.getAt<CoordinateXY>(j0));
+    };
+
+    double maxDist = pointDistance(0, 0);
+    while (i < n0 - 1 || j < n1 - 1) {
+        if (i == n0 - 1) {
+            j++;
+        }
+        else if (j == n1 - 1) {
+            i++;
+        }
+        else {
+            double dDiag = pointDistance(i + 1, j + 1);
+            double d0 = pointDistance(i + 1, j);
+            double d1 = pointDistance(i, j + 1);
+            if (dDiag <= d0 && dDiag <= d1) {
+                i++;
+                j++;
+            }
+            else if (d0 <= d1) {
+                i++;
+            }
+            else {
+                j++;
+            }
+        }
+        maxDist = std::max(maxDist, pointDistance(i, j));
+    }
+    return maxDist;
+}
+
+
 /* private static */
 double
 DiscreteFrechetDistance::getMinDistanceAtCorner(MatrixStorage& matrix, std::size_t i, std::size_t j)
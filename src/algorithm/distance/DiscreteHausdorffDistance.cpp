@@ -18,6 +18,8 @@
 
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/operation/distance/IndexedFacetDistance.h>
+#include <geos/util/TaskPool.h>
 
 #include <typeinfo>
 #include <cassert>
@@ -109,6 +111,11 @@ DiscreteHausdorffDistance::computeOrientedDistance(
     // can't calculate distance with empty
     if (discreteGeom.isEmpty() || geom.isEmpty()) return;
 
+    if (geom.getNumPoints() >= INDEX_MIN_POINTS) {
+        computeOrientedDistanceIndexed(discreteGeom, geom, p_ptDist);
+        return;
+    }
+
     MaxPointDistanceFilter distFilter(geom);
     discreteGeom.apply_ro(&distFilter);
     p_ptDist.setMaximum(distFilter.getMaxPointDistance());
@@ -121,6 +128,88 @@ DiscreteHausdorffDistance::computeOrientedDistance(
     }
 }
 
+/* private */
+void
+DiscreteHausdorffDistance::computeOrientedDistanceIndexed(
+    const geom::Geometry& discreteGeom,
+    const geom::Geometry& geom,
+    PointPairDistance& p_ptDist)
+{
+    operation::distance::IndexedFacetDistance facetDist(&geom);
+    auto pts = getQueryPoints(discreteGeom);
+
+    std::size_t n = pts->size();
+    std::size_t grainSize = taskPool ? PARALLEL_GRAIN_SIZE : n;
+    std::size_t numChunks = (n + grainSize - 1) / grainSize;
+    std::vector<PointPairDistance> chunkMax(numChunks);
+
+    util::parallelFor(taskPool, numChunks, [&](std::size_t chunk) {
+        PointPairDistance& maxDist = chunkMax[chunk];
+        std::size_t end = std::min(n, (chunk + 1) * grainSize);
+        for (std::size_t i = chunk * grainSize; i < end; i++) {
+            const CoordinateXY& pt = pts->getAt<CoordinateXY>(i);
+            /*
+             * A point within the current maximum distance of geom
+             * cannot increase it, so its nearest point is not needed.
+             */
+            if (!maxDist.getIsNull() && facetDist.isWithinDistance(pt, maxDist.getDistance())) {
+                continue;
+            }
+            maxDist.setMaximum(facetDist.nearestPoint(pt), pt);
+        }
+    });
+
+    for (auto& maxDist : chunkMax) {
+        if (!maxDist.getIsNull()) {
+            p_ptDist.setMaximum(maxDist);
+        }
+    }
+}
+
+/* private */
+std::unique_ptr<CoordinateSequence>
+DiscreteHausdorffDistance::getQueryPoints(const geom::Geometry& discreteGeom) const
+{
+    auto pts = discreteGeom.getCoordinates();
+    if (densifyFrac <= 0) {
+        return pts;
+    }
+
+    class DensifiedPointsFilter : public CoordinateSequenceFilter {
+    public:
+        DensifiedPointsFilter(CoordinateSequence& p_pts, std::size_t p_numSubSegs)
+            : densePts(p_pts), numSubSegs(p_numSubSegs) {}
+
+        void filter_ro(const CoordinateSequence& seq, std::size_t index) override
+        {
+            if (index == 0) {
+                return;
+            }
+            const CoordinateXY& p0 = seq.getAt<CoordinateXY>(index - 1);
+            const CoordinateXY& p1 = seq.getAt<CoordinateXY>(index);
+            double delx = (p1.x - p0.x) / static_cast<double>(numSubSegs);
+            double dely = (p1.y - p0.y) / static_cast<double>(numSubSegs);
+            for (std::size_t i = 1; i < numSubSegs; ++i) {
+                double x = p0.x + static_cast<double>(i) * delx;
+                double y = p0.y + static_cast<double>(i) * dely;
+                densePts.add(CoordinateXY(x, y));
+            }
+        }
+
+        bool isGeometryChanged() const override { return false; }
+
+        bool isDone() const override { return false; }
+
+    private:
+        CoordinateSequence& densePts;
+        std::size_t numSubSegs;
+    };
+
+    DensifiedPointsFilter filter(*pts, std::size_t(util::round(1.0 / densifyFrac)));
+    discreteGeom.apply_ro(filter);
+    return pts;
+}
+
 } // namespace geos.algorithm.distance
 } // namespace geos.algorithm
 } // namespace geos
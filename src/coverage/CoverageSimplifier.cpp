@@ -130,7 +130,7 @@ CoverageSimplifier::simplifyEdges(
 {
     std::unique_ptr<MultiLineString> lines = CoverageEdge::createLines(edges, m_geomFactory);
     std::vector<bool> freeRings = getFreeRings(edges);
-    std::unique_ptr<MultiLineString> linesSimp = TPVWSimplifier::simplify(lines.get(), freeRings, constraints, tolerance, progressFunction);
+    std::unique_ptr<MultiLineString> linesSimp = TPVWSimplifier::simplify(lines.get(), freeRings, constraints, tolerance, progressFunction, m_taskPool);
     //Assert: mlsSimp.getNumGeometries = edges.length
 
     setCoordinates(edges, linesSimp.get());
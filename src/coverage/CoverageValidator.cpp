@@ -89,17 +89,19 @@ CoverageValidator::validate()
         invalidLines.emplace_back(nullptr);
     }
 
-    for (std::size_t i = 0; i < m_coverage.size(); i++) {
+    //-- build up front so the index can be queried from several threads
+    index.build();
+
+    util::parallelFor(m_taskPool, m_coverage.size(), [&](std::size_t i) {
         const Geometry* geom = m_coverage[i];
-        std::unique_ptr<Geometry> result = validate(geom, index);
-        invalidLines[i].reset(result.release());
-    }
+        invalidLines[i] = validate(geom, index);
+    }, VALIDATE_GRAIN_SIZE);
     return invalidLines;
 }
 
 /* private */
 std::unique_ptr<Geometry>
-CoverageValidator::validate(const Geometry* targetGeom, TemplateSTRtree<const Geometry*>& index)
+CoverageValidator::validate(const Geometry* targetGeom, TemplateSTRtree<const Geometry*>& index) const
 {
     Envelope queryEnv = *(targetGeom->getEnvelopeInternal());
     queryEnv.expandBy(m_gapWidth);
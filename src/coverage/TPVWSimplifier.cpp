@@ -24,6 +24,10 @@
 #include <geos/geom/MultiLineString.h>
 
 #include <geos/simplify/LinkedLine.h>
+#include <geos/util/TaskPool.h>
+
+#include <algorithm>
+#include <functional>
 
 using geos::geom::Coordinate;
 using geos::geom::CoordinateSequence;
@@ -63,11 +67,13 @@ TPVWSimplifier::simplify(
     std::vector<bool>& p_freeRings,
     const MultiLineString* p_constraintLines,
     double distanceTolerance,
-    geos::util::ProgressFunction* progressFunction)
+    geos::util::ProgressFunction* progressFunction,
+    geos::util::TaskPool* taskPool)
 {
     TPVWSimplifier simp(p_lines, distanceTolerance);
     simp.setFreeRingIndices(p_freeRings);
     simp.setConstraints(p_constraintLines);
+    simp.setTaskPool(taskPool);
     std::unique_ptr<MultiLineString> result = simp.simplify(progressFunction);
     return result;
 }
@@ -81,9 +87,18 @@ TPVWSimplifier::TPVWSimplifier(
     , areaTolerance(distanceTolerance*distanceTolerance)
     , geomFactory(inputLines->getFactory())
     , constraintLines(nullptr)
+    , taskPool(nullptr)
     {}
 
 
+/* public */
+void
+TPVWSimplifier::setTaskPool(geos::util::TaskPool* pool)
+{
+    taskPool = pool;
+}
+
+
 /* private */
 void
 TPVWSimplifier::setConstraints(const MultiLineString* constraints)
@@ -144,13 +159,23 @@ TPVWSimplifier::simplify(geos::util::ProgressFunction* progressFunction)
         subProgress = geos::util::CreateScaledProgressFunction(
                         RATIO_FIRST_PASS, 1.0, *progressFunction);
     }
-    for (size_t i = 0, iNotify = 0; i < iterCount; ++i) {
-        auto& edge = edges[i];
-        std::unique_ptr<CoordinateSequence> ptsSimp = edge.simplify(edgeIndex);
-        auto ls = geomFactory->createLineString(std::move(ptsSimp));
-        result.emplace_back(ls.release());
-        if (progressFunction) {
-            geos::util::ProgressFunctionIteration(subProgress, i, iterCount, iNotify, notificationInterval);
+    if (taskPool != nullptr && taskPool->getNumWorkers() > 0 && iterCount > MIN_PARALLEL_EDGES) {
+        auto ptsSimp = simplifyInLevels(edges, edgeIndex,
+                                           progressFunction ? &subProgress : nullptr);
+        for (auto& pts : ptsSimp) {
+            auto ls = geomFactory->createLineString(std::move(pts));
+            result.emplace_back(ls.release());
+        }
+    }
+    else {
+        for (size_t i = 0, iNotify = 0; i < iterCount; ++i) {
+            auto& edge = edges[i];
+            std::unique_ptr<CoordinateSequence> ptsSimp = edge.simplify(edgeIndex);
+            auto ls = geomFactory->createLineString(std::move(ptsSimp));
+            result.emplace_back(ls.release());
+            if (progressFunction) {
+                geos::util::ProgressFunctionIteration(subProgress, i, iterCount, iNotify, notificationInterval);
+            }
         }
     }
     if (progressFunction) {
@@ -159,6 +184,67 @@ TPVWSimplifier::simplify(geos::util::ProgressFunction* progressFunction)
     return geomFactory->createMultiLineString(std::move(result));
 }
 
+/* private */
+std::vector<std::unique_ptr<CoordinateSequence>>
+TPVWSimplifier::simplifyInLevels(
+    std::vector<Edge>& edges,
+    EdgeIndex& edgeIndex,
+    geos::util::ProgressFunction* progressFunction)
+{
+    const std::size_t n = edges.size();
+
+    /*
+     * Simplifying an edge reads the edges whose envelopes intersect
+     * its envelope, and modifies only the edge itself. The sequential
+     * algorithm simplifies the edges in order, so each edge must be
+     * simplified after the intersecting edges before it, and before
+     * the intersecting edges after it. An edge is put in the level
+     * above the highest level of the intersecting edges before it.
+     * Edges of a level do not interact, so they are simplified
+     * concurrently, and simplifying the levels in order gives exactly
+     * the sequential result.
+     * Constraint edges are never modified, so they do not matter.
+     */
+    const Edge* edgesBegin = edges.data();
+    std::less<const Edge*> before;
+    edgeIndex.index.build();
+    std::vector<std::vector<std::size_t>> preceding(n);
+    util::parallelFor(taskPool, n, [&](std::size_t i) {
+        const Edge* edge = edgesBegin + i;
+        edgeIndex.index.query(*edge->getEnvelopeInternal(), [&](const Edge* hit) {
+            if (!before(hit, edgesBegin) && before(hit, edge))
+                preceding[i].push_back(static_cast<std::size_t>(hit - edgesBegin));
+        });
+    }, PARALLEL_GRAIN_SIZE);
+
+    std::vector<std::size_t> edgeLevel(n);
+    std::vector<std::vector<std::size_t>> levels;
+    for (std::size_t i = 0; i < n; i++) {
+        std::size_t level = 0;
+        for (std::size_t j : preceding[i]) {
+            level = std::max(level, edgeLevel[j] + 1);
+        }
+        edgeLevel[i] = level;
+        if (level == levels.size())
+            levels.emplace_back();
+        levels[level].push_back(i);
+    }
+
+    std::vector<std::unique_ptr<CoordinateSequence>> result(n);
+    std::size_t numDone = 0;
+    for (const auto& level : levels) {
+        util::parallelFor(taskPool, level.size(), [&](std::size_t k) {
+            std::size_t i = level[k];
+            result[i] = edges[i].simplify(edgeIndex);
+        }, PARALLEL_GRAIN_SIZE);
+        numDone += level.size();
+        if (progressFunction) {
+            (*progressFunction)(static_cast<double>(numDone) / static_cast<double>(n), nullptr);
+        }
+    }
+    return result;
+}
+
 /* private */
 std::vector<Edge>
 TPVWSimplifier::createEdges(
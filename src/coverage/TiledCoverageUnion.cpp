@@ -0,0 +1,266 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/coverage/TiledCoverageUnion.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryCollection.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/WKBReader.h>
+#include <geos/io/WKBStreamReader.h>
+#include <geos/operation/overlayng/CoverageUnion.h>
+#include <geos/util/GEOSException.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/IllegalStateException.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/Machine.h>
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::GeometryCollection;
+using geos::geom::GeometryFactory;
+
+
+namespace geos {     // geos
+namespace coverage { // geos.coverage
+
+/* public */
+TiledCoverageUnion::TiledCoverageUnion(const Envelope& p_extent, std::size_t p_gridSize)
+    : extent(p_extent)
+    , gridSize(p_gridSize)
+    //-- keep Z, M and SRID of the polygons through the WKB
+    , writer(4, getMachineByteOrder(), true)
+    , tileData(p_gridSize * p_gridSize)
+    , tileChunks(p_gridSize * p_gridSize)
+{
+    if (gridSize == 0)
+        throw util::IllegalArgumentException("TiledCoverageUnion: grid size must be positive");
+    if (extent.isNull())
+        throw util::IllegalArgumentException("TiledCoverageUnion: extent must not be empty");
+}
+
+/* public static */
+std::unique_ptr<Geometry>
+TiledCoverageUnion::Union(
+    io::WKBStreamReader& reader,
+    const Envelope& extent,
+    std::size_t gridSize,
+    std::iostream* spillStream)
+{
+    TiledCoverageUnion tcu(extent, gridSize);
+    tcu.setSpillStream(spillStream);
+    tcu.add(reader);
+    return tcu.getResult();
+}
+
+/* public */
+void
+TiledCoverageUnion::add(const Geometry& geom)
+{
+    if (isComputed)
+        throw util::IllegalStateException("TiledCoverageUnion: result has already been computed");
+
+    auto typeId = geom.getGeometryTypeId();
+    if (typeId != geom::GEOS_POLYGON && typeId != geom::GEOS_MULTIPOLYGON)
+        throw util::IllegalArgumentException("TiledCoverageUnion: argument is non-polygonal");
+    if (geom.isEmpty())
+        return;
+    if (factory == nullptr)
+        factory = geom.getFactory();
+
+    //-- each record is the WKB size followed by the WKB
+    std::vector<unsigned char>& data = tileData[tileIndex(*geom.getEnvelopeInternal())];
+    std::uint64_t wkbSize = writer.getWkbSize(geom);
+    std::size_t pos = data.size();
+    data.resize(pos + sizeof(wkbSize) + wkbSize);
+    std::memcpy(data.data() + pos, &wkbSize, sizeof(wkbSize));
+    writer.write(geom, data.data() + pos + sizeof(wkbSize), static_cast<std::size_t>(wkbSize));
+
+    bufferedSize += sizeof(wkbSize) + wkbSize;
+    if (spillStream != nullptr && bufferedSize > memoryLimit)
+        spill();
+}
+
+/* public */
+std::size_t
+TiledCoverageUnion::add(io::WKBStreamReader& reader)
+{
+    std::size_t count = 0;
+    while (auto geom = reader.next()) {
+        add(*geom);
+        count++;
+    }
+    return count;
+}
+
+/* public */
+std::unique_ptr<Geometry>
+TiledCoverageUnion::getResult()
+{
+    if (isComputed)
+        throw util::IllegalStateException("TiledCoverageUnion: result has already been computed");
+    isComputed = true;
+
+    std::unique_ptr<Geometry> result = unionRange(0, gridSize, 0, gridSize);
+    if (result == nullptr) {
+        const GeometryFactory* gf = factory ? factory : GeometryFactory::getDefaultInstance();
+        return gf->createEmpty(2);
+    }
+    return result;
+}
+
+/* private */
+std::size_t
+TiledCoverageUnion::gridIndex(double v, double min, double width) const
+{
+    if (width <= 0 || v <= min)
+        return 0;
+    double i = (v - min) / width * static_cast<double>(gridSize);
+    if (i >= static_cast<double>(gridSize - 1))
+        return gridSize - 1;
+    return static_cast<std::size_t>(i);
+}
+
+/* private */
+std::size_t
+TiledCoverageUnion::tileIndex(const Envelope& env) const
+{
+    std::size_t col = gridIndex(0.5 * (env.getMinX() + env.getMaxX()), extent.getMinX(), extent.getWidth());
+    std::size_t row = gridIndex(0.5 * (env.getMinY() + env.getMaxY()), extent.getMinY(), extent.getHeight());
+    return row * gridSize + col;
+}
+
+/* private */
+void
+TiledCoverageUnion::spill()
+{
+    spillStream->seekp(0, std::ios::end);
+    for (std::size_t tile = 0; tile < tileData.size(); tile++) {
+        std::vector<unsigned char>& data = tileData[tile];
+        if (data.empty())
+            continue;
+
+        auto offset = static_cast<std::uint64_t>(spillStream->tellp());
+        spillStream->write(reinterpret_cast<const char*>(data.data()),
+                           static_cast<std::streamsize>(data.size()));
+        if (!*spillStream)
+            throw util::GEOSException("TiledCoverageUnion: error writing spill stream");
+        tileChunks[tile].push_back({offset, data.size()});
+
+        //-- release the memory, not just the contents
+        std::vector<unsigned char>().swap(data);
+    }
+    bufferedSize = 0;
+}
+
+/* private */
+std::unique_ptr<Geometry>
+TiledCoverageUnion::unionTile(std::size_t tile)
+{
+    std::vector<unsigned char> data;
+    for (const Chunk& chunk : tileChunks[tile]) {
+        std::size_t pos = data.size();
+        data.resize(pos + chunk.size);
+        spillStream->seekg(static_cast<std::streamoff>(chunk.offset));
+        spillStream->read(reinterpret_cast<char*>(data.data() + pos),
+                          static_cast<std::streamsize>(chunk.size));
+        if (!*spillStream)
+            throw util::GEOSException("TiledCoverageUnion: error reading spill stream");
+    }
+    std::vector<Chunk>().swap(tileChunks[tile]);
+    data.insert(data.end(), tileData[tile].begin(), tileData[tile].end());
+    std::vector<unsigned char>().swap(tileData[tile]);
+
+    if (data.empty())
+        return nullptr;
+
+    io::WKBReader reader(*factory);
+    std::vector<std::unique_ptr<Geometry>> polys;
+    std::size_t pos = 0;
+    while (pos < data.size()) {
+        std::uint64_t wkbSize;
+        std::memcpy(&wkbSize, data.data() + pos, sizeof(wkbSize));
+        pos += sizeof(wkbSize);
+        polys.push_back(reader.read(data.data() + pos, static_cast<std::size_t>(wkbSize)));
+        pos += static_cast<std::size_t>(wkbSize);
+    }
+    //-- the WKB is no longer needed while the union is computed
+    std::vector<unsigned char>().swap(data);
+
+    return unionParts(polys);
+}
+
+/* private */
+std::unique_ptr<Geometry>
+TiledCoverageUnion::unionRange(
+    std::size_t x0, std::size_t x1,
+    std::size_t y0, std::size_t y1)
+{
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    if (x1 - x0 == 1 && y1 - y0 == 1)
+        return unionTile(y0 * gridSize + x0);
+
+    //-- merge the quadrants, so merged results stay spatially compact
+    std::size_t xm = x0 + (x1 - x0 + 1) / 2;
+    std::size_t ym = y0 + (y1 - y0 + 1) / 2;
+    std::vector<std::unique_ptr<Geometry>> parts;
+    for (auto& y : { std::make_pair(y0, ym), std::make_pair(ym, y1) }) {
+        for (auto& x : { std::make_pair(x0, xm), std::make_pair(xm, x1) }) {
+            if (x.first == x.second || y.first == y.second)
+                continue;
+            auto part = unionRange(x.first, x.second, y.first, y.second);
+            if (part != nullptr)
+                parts.push_back(std::move(part));
+        }
+    }
+
+    if (parts.empty())
+        return nullptr;
+    if (parts.size() == 1)
+        return std::move(parts[0]);
+    return unionParts(parts);
+}
+
+/* private */
+std::unique_ptr<Geometry>
+TiledCoverageUnion::unionParts(std::vector<std::unique_ptr<Geometry>>& parts) const
+{
+    //-- flatten multipolygons, so the coverage is a collection of polygons
+    std::vector<std::unique_ptr<Geometry>> polys;
+    for (auto& part : parts) {
+        if (part->getGeometryTypeId() == geom::GEOS_MULTIPOLYGON) {
+            auto* mp = static_cast<GeometryCollection*>(part.get());
+            for (auto& poly : mp->releaseGeometries())
+                polys.push_back(std::move(poly));
+        }
+        else if (!part->isEmpty()) {
+            polys.push_back(std::move(part));
+        }
+    }
+    parts.clear();
+
+    if (polys.empty())
+        return nullptr;
+    std::unique_ptr<GeometryCollection> coverage = factory->createGeometryCollection(std::move(polys));
+    return operation::overlayng::CoverageUnion::geomunion(coverage.get());
+}
+
+
+} // namespace geos.coverage
+} // namespace geos
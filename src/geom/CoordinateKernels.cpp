@@ -0,0 +1,680 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/CoordinateKernels.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GEOS_KERNELS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(_MSC_VER)
+#define GEOS_KERNELS_AVX2 1
+#define GEOS_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define GEOS_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace geos {
+namespace geom { // geos::geom
+
+namespace {
+
+using InstructionSet = CoordinateKernels::InstructionSet;
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+/*
+ * Scalar building blocks. The vector kernels compute the same terms
+ * with the same operations, and use these for the remaining
+ * coordinates that do not fill a vector.
+ *
+ * Terms of the area and length sums are added into four partial sums,
+ * term j going to sum j % 4, so that all kernels give identical results.
+ */
+
+inline double
+X(const double* v, std::size_t i, std::size_t stride)
+{
+    return v[i * stride];
+}
+
+inline double
+Y(const double* v, std::size_t i, std::size_t stride)
+{
+    return v[i * stride + 1];
+}
+
+inline double
+areaTerm(const double* v, std::size_t i, std::size_t stride, double x0)
+{
+    return (X(v, i, stride) - x0) * (Y(v, i - 1, stride) - Y(v, i + 1, stride));
+}
+
+inline double
+lengthTerm(const double* v, std::size_t j, std::size_t stride)
+{
+    double dx = X(v, j + 1, stride) - X(v, j, stride);
+    double dy = Y(v, j + 1, stride) - Y(v, j, stride);
+    return std::sqrt(dx * dx + dy * dy);
+}
+
+inline double
+sumPartials(const double* p)
+{
+    return (p[0] + p[1]) + (p[2] + p[3]);
+}
+
+// ext holds minx, maxx, miny, maxy
+void
+envelopeScalar(const double* v, std::size_t begin, std::size_t n, std::size_t stride, double* ext)
+{
+    for (std::size_t i = begin; i < n; i++) {
+        ext[0] = std::min(ext[0], X(v, i, stride));
+        ext[1] = std::max(ext[1], X(v, i, stride));
+        ext[2] = std::min(ext[2], Y(v, i, stride));
+        ext[3] = std::max(ext[3], Y(v, i, stride));
+    }
+}
+
+void
+areaScalar(const double* v, std::size_t begin, std::size_t numTerms, std::size_t stride, double x0, double* p)
+{
+    for (std::size_t j = begin; j < numTerms; j++) {
+        p[j & 3] += areaTerm(v, j + 1, stride, x0);
+    }
+}
+
+void
+lengthScalar(const double* v, std::size_t begin, std::size_t numTerms, std::size_t stride, double* p)
+{
+    for (std::size_t j = begin; j < numTerms; j++) {
+        p[j & 3] += lengthTerm(v, j, stride);
+    }
+}
+
+double
+maxRisingYScalar(const double* v, std::size_t begin, std::size_t n, std::size_t stride, double maxY)
+{
+    for (std::size_t i = std::max<std::size_t>(begin, 1); i < n; i++) {
+        double y = Y(v, i, stride);
+        if (y > Y(v, i - 1, stride) && y > maxY) {
+            maxY = y;
+        }
+    }
+    return maxY;
+}
+
+/*
+ * A loop keeps the first of several equal extreme values. Vector
+ * kernels compare in several lanes, so when the extreme is zero
+ * the sign of the first zero is looked up.
+ */
+inline void
+fixZeroSigns(const double* v, std::size_t n, std::size_t stride, double* ext)
+{
+    for (std::size_t k = 0; k < 4; k++) {
+        if (ext[k] != 0.0) {
+            continue;
+        }
+        std::size_t offset = k < 2 ? 0 : 1;
+        for (std::size_t i = 0; i < n; i++) {
+            if (v[i * stride + offset] == 0.0) {
+                ext[k] = v[i * stride + offset];
+                break;
+            }
+        }
+    }
+}
+
+inline double
+fixZeroSign(const double* v, std::size_t n, std::size_t stride, double maxY)
+{
+    if (maxY != 0.0) {
+        return maxY;
+    }
+    for (std::size_t i = 1; i < n; i++) {
+        double y = Y(v, i, stride);
+        if (y == 0.0 && y > Y(v, i - 1, stride)) {
+            return y;
+        }
+    }
+    return maxY;
+}
+
+void
+affineScalar(double* v, std::size_t begin, std::size_t n, std::size_t stride, const double* c)
+{
+    for (std::size_t i = begin; i < n; i++) {
+        double x = v[i * stride];
+        double y = v[i * stride + 1];
+        v[i * stride] = c[0] * x + c[1] * y + c[4];
+        v[i * stride + 1] = c[2] * x + c[3] * y + c[5];
+    }
+}
+
+struct Kernels {
+    InstructionSet instructionSet;
+    void (*envelope)(const double* v, std::size_t n, std::size_t stride, double* ext);
+    double (*areaSum)(const double* v, std::size_t n, std::size_t stride);
+    double (*length)(const double* v, std::size_t n, std::size_t stride);
+    double (*maxRisingY)(const double* v, std::size_t n, std::size_t stride);
+    // c holds a, b, d, e, xoff, yoff
+    void (*affine)(double* v, std::size_t n, std::size_t stride, const double* c);
+};
+
+const Kernels scalarKernels = {
+    InstructionSet::SCALAR,
+    [](const double* v, std::size_t n, std::size_t stride, double* ext) {
+        envelopeScalar(v, 0, n, stride, ext);
+    },
+    [](const double* v, std::size_t n, std::size_t stride) {
+        double p[4] = {0, 0, 0, 0};
+        areaScalar(v, 0, n - 2, stride, X(v, 0, stride), p);
+        return sumPartials(p);
+    },
+    [](const double* v, std::size_t n, std::size_t stride) {
+        double p[4] = {0, 0, 0, 0};
+        lengthScalar(v, 0, n - 1, stride, p);
+        return sumPartials(p);
+    },
+    [](const double* v, std::size_t n, std::size_t stride) {
+        return maxRisingYScalar(v, 1, n, stride, -INF);
+    },
+    [](double* v, std::size_t n, std::size_t stride, const double* c) {
+        affineScalar(v, 0, n, stride, c);
+    }
+};
+
+/*
+ * Kernels for two-lane vectors (SSE2 and NEON), written against
+ * a small set of vector operations.
+ */
+template<typename Ops>
+struct TwoLaneKernels {
+    using V = typename Ops::V;
+
+    // Loads the X and Y ordinates of coordinates i and i+1
+    static void load2(const double* v, std::size_t i, std::size_t stride, V& x, V& y)
+    {
+        V a = Ops::load(v + i * stride);
+        V b = Ops::load(v + (i + 1) * stride);
+        x = Ops::zipLo(a, b);
+        y = Ops::zipHi(a, b);
+    }
+
+    static void envelope(const double* v, std::size_t n, std::size_t stride, double* ext)
+    {
+        V mn0 = Ops::set1(INF), mn1 = mn0;
+        V mx0 = Ops::set1(-INF), mx1 = mx0;
+        std::size_t i = 0;
+        for (; i + 2 <= n; i += 2) {
+            V p0 = Ops::load(v + i * stride);
+            V p1 = Ops::load(v + (i + 1) * stride);
+            mn0 = Ops::min(p0, mn0);
+            mn1 = Ops::min(p1, mn1);
+            mx0 = Ops::max(p0, mx0);
+            mx1 = Ops::max(p1, mx1);
+        }
+        double mn[2], mx[2];
+        Ops::store(mn, Ops::min(mn1, mn0));
+        Ops::store(mx, Ops::max(mx1, mx0));
+        ext[0] = mn[0];
+        ext[1] = mx[0];
+        ext[2] = mn[1];
+        ext[3] = mx[1];
+        envelopeScalar(v, i, n, stride, ext);
+        fixZeroSigns(v, n, stride, ext);
+    }
+
+    static double areaSum(const double* v, std::size_t n, std::size_t stride)
+    {
+        const std::size_t numTerms = n - 2;
+        const double x0 = X(v, 0, stride);
+        const V vx0 = Ops::set1(x0);
+        V acc01 = Ops::set1(0.0), acc23 = acc01;
+        V x, y, yPrev, yNext, unused;
+        std::size_t j = 0;
+        for (; j + 4 <= numTerms; j += 4) {
+            std::size_t i = j + 1;
+            load2(v, i - 1, stride, unused, yPrev);
+            load2(v, i, stride, x, y);
+            load2(v, i + 1, stride, unused, yNext);
+            acc01 = Ops::add(acc01, Ops::mul(Ops::sub(x, vx0), Ops::sub(yPrev, yNext)));
+
+            load2(v, i + 2, stride, x, y);
+            yPrev = yNext;
+            load2(v, i + 3, stride, unused, yNext);
+            acc23 = Ops::add(acc23, Ops::mul(Ops::sub(x, vx0), Ops::sub(yPrev, yNext)));
+        }
+        double p[4];
+        Ops::store(p, acc01);
+        Ops::store(p + 2, acc23);
+        areaScalar(v, j, numTerms, stride, x0, p);
+        return sumPartials(p);
+    }
+
+    static V lengthTerms(const double* v, std::size_t j, std::size_t stride)
+    {
+        V x0, y0, x1, y1;
+        load2(v, j, stride, x0, y0);
+        load2(v, j + 1, stride, x1, y1);
+        V dx = Ops::sub(x1, x0);
+        V dy = Ops::sub(y1, y0);
+        return Ops::sqrt(Ops::add(Ops::mul(dx, dx), Ops::mul(dy, dy)));
+    }
+
+    static double length(const double* v, std::size_t n, std::size_t stride)
+    {
+        const std::size_t numTerms = n - 1;
+        V acc01 = Ops::set1(0.0), acc23 = acc01;
+        std::size_t j = 0;
+        for (; j + 4 <= numTerms; j += 4) {
+            acc01 = Ops::add(acc01, lengthTerms(v, j, stride));
+            acc23 = Ops::add(acc23, lengthTerms(v, j + 2, stride));
+        }
+        double p[4];
+        Ops::store(p, acc01);
+        Ops::store(p + 2, acc23);
+        lengthScalar(v, j, numTerms, stride, p);
+        return sumPartials(p);
+    }
+
+    static double maxRisingY(const double* v, std::size_t n, std::size_t stride)
+    {
+        const V negInf = Ops::set1(-INF);
+        V acc = negInf;
+        V x, y, yPrev;
+        std::size_t i = 1;
+        for (; i + 2 <= n; i += 2) {
+            load2(v, i - 1, stride, x, yPrev);
+            load2(v, i, stride, x, y);
+            acc = Ops::max(Ops::selectGreater(y, yPrev, negInf), acc);
+        }
+        double m[2];
+        Ops::store(m, acc);
+        double maxY = maxRisingYScalar(v, i, n, stride, std::max(m[1], m[0]));
+        return fixZeroSign(v, n, stride, maxY);
+    }
+
+    static void affine(double* v, std::size_t n, std::size_t stride, const double* c)
+    {
+        const V ad = Ops::set2(c[0], c[2]);
+        const V be = Ops::set2(c[1], c[3]);
+        const V off = Ops::set2(c[4], c[5]);
+        for (std::size_t i = 0; i < n; i++) {
+            double* p = v + i * stride;
+            V xy = Ops::load(p);
+            V xx = Ops::zipLo(xy, xy);
+            V yy = Ops::zipHi(xy, xy);
+            Ops::store(p, Ops::add(Ops::add(Ops::mul(ad, xx), Ops::mul(be, yy)), off));
+        }
+    }
+};
+
+#ifdef GEOS_KERNELS_SSE2
+
+struct Sse2Ops {
+    using V = __m128d;
+
+    static V load(const double* p) { return _mm_loadu_pd(p); }
+    static void store(double* p, V a) { _mm_storeu_pd(p, a); }
+    static V set1(double a) { return _mm_set1_pd(a); }
+    static V set2(double lane0, double lane1) { return _mm_set_pd(lane1, lane0); }
+    static V zipLo(V a, V b) { return _mm_unpacklo_pd(a, b); }
+    static V zipHi(V a, V b) { return _mm_unpackhi_pd(a, b); }
+    static V add(V a, V b) { return _mm_add_pd(a, b); }
+    static V sub(V a, V b) { return _mm_sub_pd(a, b); }
+    static V mul(V a, V b) { return _mm_mul_pd(a, b); }
+    static V sqrt(V a) { return _mm_sqrt_pd(a); }
+    // a < b ? a : b, keeping b if a is NaN
+    static V min(V a, V b) { return _mm_min_pd(a, b); }
+    // a > b ? a : b, keeping b if a is NaN
+    static V max(V a, V b) { return _mm_max_pd(a, b); }
+    // a > b ? a : other
+    static V selectGreater(V a, V b, V other)
+    {
+        V mask = _mm_cmpgt_pd(a, b);
+        return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, other));
+    }
+};
+
+using Sse2 = TwoLaneKernels<Sse2Ops>;
+
+const Kernels sse2Kernels = {
+    InstructionSet::SSE2,
+    &Sse2::envelope,
+    &Sse2::areaSum,
+    &Sse2::length,
+    &Sse2::maxRisingY,
+    &Sse2::affine
+};
+
+#endif // GEOS_KERNELS_SSE2
+
+#ifdef GEOS_KERNELS_NEON
+
+struct NeonOps {
+    using V = float64x2_t;
+
+    static V load(const double* p) { return vld1q_f64(p); }
+    static void store(double* p, V a) { vst1q_f64(p, a); }
+    static V set1(double a) { return vdupq_n_f64(a); }
+    static V set2(double lane0, double lane1) { return vsetq_lane_f64(lane1, vdupq_n_f64(lane0), 1); }
+    static V zipLo(V a, V b) { return vzip1q_f64(a, b); }
+    static V zipHi(V a, V b) { return vzip2q_f64(a, b); }
+    static V add(V a, V b) { return vaddq_f64(a, b); }
+    static V sub(V a, V b) { return vsubq_f64(a, b); }
+    static V mul(V a, V b) { return vmulq_f64(a, b); }
+    static V sqrt(V a) { return vsqrtq_f64(a); }
+    // vminq_f64/vmaxq_f64 propagate NaN, so compare and select instead
+    static V min(V a, V b) { return vbslq_f64(vcltq_f64(a, b), a, b); }
+    static V max(V a, V b) { return vbslq_f64(vcgtq_f64(a, b), a, b); }
+    static V selectGreater(V a, V b, V other) { return vbslq_f64(vcgtq_f64(a, b), a, other); }
+};
+
+using Neon = TwoLaneKernels<NeonOps>;
+
+const Kernels neonKernels = {
+    InstructionSet::NEON,
+    &Neon::envelope,
+    &Neon::areaSum,
+    &Neon::length,
+    &Neon::maxRisingY,
+    &Neon::affine
+};
+
+#endif // GEOS_KERNELS_NEON
+
+#ifdef GEOS_KERNELS_AVX2
+
+// Loads the X and Y ordinates of coordinates i and i+1 into one vector
+GEOS_AVX2_TARGET inline __m256d
+avx2LoadPair(const double* v, std::size_t i, std::size_t stride)
+{
+    return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(v + i * stride)),
+                                _mm_loadu_pd(v + (i + 1) * stride), 1);
+}
+
+// Loads the X and Y ordinates of coordinates i to i+3
+GEOS_AVX2_TARGET inline void
+avx2Load4(const double* v, std::size_t i, std::size_t stride, __m256d& x, __m256d& y)
+{
+    __m256d a = avx2LoadPair(v, i, stride);     // x0 y0 x1 y1
+    __m256d b = avx2LoadPair(v, i + 2, stride); // x2 y2 x3 y3
+    x = _mm256_permute4x64_pd(_mm256_unpacklo_pd(a, b), 0xD8);
+    y = _mm256_permute4x64_pd(_mm256_unpackhi_pd(a, b), 0xD8);
+}
+
+GEOS_AVX2_TARGET void
+avx2Envelope(const double* v, std::size_t n, std::size_t stride, double* ext)
+{
+    __m256d mn0 = _mm256_set1_pd(INF), mn1 = mn0;
+    __m256d mx0 = _mm256_set1_pd(-INF), mx1 = mx0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d p0 = avx2LoadPair(v, i, stride);
+        __m256d p1 = avx2LoadPair(v, i + 2, stride);
+        mn0 = _mm256_min_pd(p0, mn0);
+        mn1 = _mm256_min_pd(p1, mn1);
+        mx0 = _mm256_max_pd(p0, mx0);
+        mx1 = _mm256_max_pd(p1, mx1);
+    }
+    __m256d mn4 = _mm256_min_pd(mn1, mn0);
+    __m256d mx4 = _mm256_max_pd(mx1, mx0);
+    double mn[2], mx[2];
+    _mm_storeu_pd(mn, _mm_min_pd(_mm256_extractf128_pd(mn4, 1), _mm256_castpd256_pd128(mn4)));
+    _mm_storeu_pd(mx, _mm_max_pd(_mm256_extractf128_pd(mx4, 1), _mm256_castpd256_pd128(mx4)));
+    ext[0] = mn[0];
+    ext[1] = mx[0];
+    ext[2] = mn[1];
+    ext[3] = mx[1];
+    envelopeScalar(v, i, n, stride, ext);
+    fixZeroSigns(v, n, stride, ext);
+}
+
+GEOS_AVX2_TARGET double
+avx2AreaSum(const double* v, std::size_t n, std::size_t stride)
+{
+    const std::size_t numTerms = n - 2;
+    const double x0 = X(v, 0, stride);
+    const __m256d vx0 = _mm256_set1_pd(x0);
+    __m256d acc = _mm256_setzero_pd();
+    __m256d x, y, yPrev, yNext, unused;
+    std::size_t j = 0;
+    for (; j + 4 <= numTerms; j += 4) {
+        std::size_t i = j + 1;
+        avx2Load4(v, i - 1, stride, unused, yPrev);
+        avx2Load4(v, i, stride, x, y);
+        avx2Load4(v, i + 1, stride, unused, yNext);
+        acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_sub_pd(x, vx0), _mm256_sub_pd(yPrev, yNext)));
+    }
+    double p[4];
+    _mm256_storeu_pd(p, acc);
+    areaScalar(v, j, numTerms, stride, x0, p);
+    return sumPartials(p);
+}
+
+GEOS_AVX2_TARGET double
+avx2Length(const double* v, std::size_t n, std::size_t stride)
+{
+    const std::size_t numTerms = n - 1;
+    __m256d acc = _mm256_setzero_pd();
+    __m256d x0, y0, x1, y1;
+    std::size_t j = 0;
+    for (; j + 4 <= numTerms; j += 4) {
+        avx2Load4(v, j, stride, x0, y0);
+        avx2Load4(v, j + 1, stride, x1, y1);
+        __m256d dx = _mm256_sub_pd(x1, x0);
+        __m256d dy = _mm256_sub_pd(y1, y0);
+        acc = _mm256_add_pd(acc, _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy))));
+    }
+    double p[4];
+    _mm256_storeu_pd(p, acc);
+    lengthScalar(v, j, numTerms, stride, p);
+    return sumPartials(p);
+}
+
+GEOS_AVX2_TARGET double
+avx2MaxRisingY(const double* v, std::size_t n, std::size_t stride)
+{
+    const __m256d negInf = _mm256_set1_pd(-INF);
+    __m256d acc = negInf;
+    __m256d x, y, yPrev;
+    std::size_t i = 1;
+    for (; i + 4 <= n; i += 4) {
+        avx2Load4(v, i - 1, stride, x, yPrev);
+        avx2Load4(v, i, stride, x, y);
+        __m256d rising = _mm256_cmp_pd(y, yPrev, _CMP_GT_OQ);
+        acc = _mm256_max_pd(_mm256_blendv_pd(negInf, y, rising), acc);
+    }
+    double m[4];
+    _mm256_storeu_pd(m, acc);
+    double maxY = std::max(std::max(m[0], m[1]), std::max(m[2], m[3]));
+    maxY = maxRisingYScalar(v, i, n, stride, maxY);
+    return fixZeroSign(v, n, stride, maxY);
+}
+
+GEOS_AVX2_TARGET void
+avx2Affine(double* v, std::size_t n, std::size_t stride, const double* c)
+{
+    const __m256d ad = _mm256_set_pd(c[2], c[0], c[2], c[0]);
+    const __m256d be = _mm256_set_pd(c[3], c[1], c[3], c[1]);
+    const __m256d off = _mm256_set_pd(c[5], c[4], c[5], c[4]);
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m256d xy = avx2LoadPair(v, i, stride);
+        __m256d xx = _mm256_unpacklo_pd(xy, xy);
+        __m256d yy = _mm256_unpackhi_pd(xy, xy);
+        __m256d r = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(ad, xx), _mm256_mul_pd(be, yy)), off);
+        _mm_storeu_pd(v + i * stride, _mm256_castpd256_pd128(r));
+        _mm_storeu_pd(v + (i + 1) * stride, _mm256_extractf128_pd(r, 1));
+    }
+    affineScalar(v, i, n, stride, c);
+}
+
+const Kernels avx2Kernels = {
+    InstructionSet::AVX2,
+    &avx2Envelope,
+    &avx2AreaSum,
+    &avx2Length,
+    &avx2MaxRisingY,
+    &avx2Affine
+};
+
+#endif // GEOS_KERNELS_AVX2
+
+const Kernels*
+kernelsFor(InstructionSet is)
+{
+    switch (is) {
+        case InstructionSet::SCALAR:
+            return &scalarKernels;
+        case InstructionSet::SSE2:
+#ifdef GEOS_KERNELS_SSE2
+            return &sse2Kernels;
+#else
+            return nullptr;
+#endif
+        case InstructionSet::AVX2:
+#ifdef GEOS_KERNELS_AVX2
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return &avx2Kernels;
+            }
+#endif
+            return nullptr;
+        case InstructionSet::NEON:
+#ifdef GEOS_KERNELS_NEON
+            return &neonKernels;
+#else
+            return nullptr;
+#endif
+    }
+    return nullptr;
+}
+
+std::atomic<const Kernels*> currentKernels{nullptr};
+
+const Kernels&
+kernels()
+{
+    const Kernels* k = currentKernels.load(std::memory_order_acquire);
+    if (k == nullptr) {
+        for (InstructionSet is : {InstructionSet::AVX2, InstructionSet::NEON, InstructionSet::SSE2, InstructionSet::SCALAR}) {
+            k = kernelsFor(is);
+            if (k) {
+                break;
+            }
+        }
+        currentKernels.store(k, std::memory_order_release);
+    }
+    return *k;
+}
+
+} // anonymous namespace
+
+/*public static*/
+CoordinateKernels::InstructionSet
+CoordinateKernels::getInstructionSet()
+{
+    return kernels().instructionSet;
+}
+
+/*public static*/
+bool
+CoordinateKernels::isSupported(InstructionSet is)
+{
+    return kernelsFor(is) != nullptr;
+}
+
+/*public static*/
+bool
+CoordinateKernels::setInstructionSet(InstructionSet is)
+{
+    const Kernels* k = kernelsFor(is);
+    if (k == nullptr) {
+        return false;
+    }
+    currentKernels.store(k, std::memory_order_release);
+    return true;
+}
+
+/*public static*/
+void
+CoordinateKernels::envelope(const double* v, std::size_t n, std::size_t stride,
+                            double& minx, double& maxx, double& miny, double& maxy)
+{
+    double ext[4] = { INF, -INF, INF, -INF };
+    if (n > 0) {
+        kernels().envelope(v, n, stride, ext);
+    }
+    minx = ext[0];
+    maxx = ext[1];
+    miny = ext[2];
+    maxy = ext[3];
+}
+
+/*public static*/
+double
+CoordinateKernels::signedArea(const double* v, std::size_t n, std::size_t stride)
+{
+    if (n < 3) {
+        return 0.0;
+    }
+    return kernels().areaSum(v, n, stride) / 2.0;
+}
+
+/*public static*/
+double
+CoordinateKernels::length(const double* v, std::size_t n, std::size_t stride)
+{
+    if (n < 2) {
+        return 0.0;
+    }
+    return kernels().length(v, n, stride);
+}
+
+/*public static*/
+double
+CoordinateKernels::maxRisingY(const double* v, std::size_t n, std::size_t stride)
+{
+    if (n < 2) {
+        return -INF;
+    }
+    return kernels().maxRisingY(v, n, stride);
+}
+
+/*public static*/
+void
+CoordinateKernels::affine(double* v, std::size_t n, std::size_t stride,
+                          double a, double b, double d, double e,
+                          double xoff, double yoff)
+{
+    const double c[6] = { a, b, d, e, xoff, yoff };
+    kernels().affine(v, n, stride, c);
+}
+
+} // namespace geos::geom
+} // namespace geos
@@ -17,6 +17,7 @@
 #include <geos/constants.h>
 #include <geos/profiler.h>
 #include <geos/geom/CoordinateFilter.h>
+#include <geos/geom/CoordinateKernels.h>
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/Envelope.h>
@@ -133,6 +134,50 @@ CoordinateSequence::CoordinateSequence(const std::initializer_list<CoordinateXYZ
     add(list.begin(), list.end());
 }
 
+CoordinateSequence
+CoordinateSequence::borrow(const double* buf, std::size_t sz, bool hasz, bool hasm)
+{
+    if (!canBorrow(hasz, hasm)) {
+        throw util::IllegalArgumentException("Coordinate layout cannot be borrowed; it must be copied");
+    }
+
+    CoordinateSequence seq(0, hasz, hasm, false);
+    if (sz > 0) {
+        seq.m_borrowed = buf;
+        seq.m_borrowedSize = sz * seq.stride();
+    }
+    return seq;
+}
+
+bool
+CoordinateSequence::canBorrow(bool hasz, bool hasm)
+{
+    return CoordinateSequence(0, hasz, hasm, false).stride() == 2u + hasz + hasm;
+}
+
+CoordinateSequence::CoordinateSequence(const CoordinateSequence& other) :
+    m_vect(other.ordinates(), other.ordinates() + other.numOrdinates()),
+    m_stride(other.m_stride),
+    m_hasdim(other.m_hasdim),
+    m_hasz(other.m_hasz),
+    m_hasm(other.m_hasm)
+{}
+
+CoordinateSequence&
+CoordinateSequence::operator=(const CoordinateSequence& other)
+{
+    if (this != &other) {
+        m_vect.assign(other.ordinates(), other.ordinates() + other.numOrdinates());
+        m_borrowed = nullptr;
+        m_borrowedSize = 0;
+        m_stride = other.m_stride;
+        m_hasdim = other.m_hasdim;
+        m_hasz = other.m_hasz;
+        m_hasm = other.m_hasm;
+    }
+    return *this;
+}
+
 template<typename T>
 void fillVector(std::vector<double> & v)
 {
@@ -157,9 +202,10 @@ void
 CoordinateSequence::add(const CoordinateSequence& cs, std::size_t from, std::size_t to)
 {
     if (cs.stride() == stride() && cs.hasM() == hasM()) {
+        ensureOwned();
         m_vect.insert(m_vect.end(),
-                      std::next(cs.m_vect.cbegin(), static_cast<std::ptrdiff_t>(from * stride())),
-                      std::next(cs.m_vect.cbegin(), static_cast<std::ptrdiff_t>((to + 1u)*stride())));
+                      cs.ordinates() + from * stride(),
+                      cs.ordinates() + (to + 1u) * stride());
     } else {
         std::size_t pos = size();
         make_space(pos, to - from + 1);
@@ -261,6 +307,7 @@ void
 CoordinateSequence::closeRing(bool allowRepeated)
 {
     if(!isEmpty() && (allowRepeated || front<CoordinateXY>() != back<CoordinateXY>())) {
+        ensureOwned();
         const std::size_t n = stride();
         const std::size_t old = m_vect.size();
         m_vect.resize(old + n);
@@ -275,7 +322,7 @@ CoordinateSequence::getDimension() const
         return static_cast<std::size_t>(2 + hasM() + hasZ());
     }
 
-    if (m_vect.empty()) {
+    if (isEmpty()) {
         return 3;
     }
 
@@ -313,8 +360,10 @@ CoordinateSequence::hasRepeatedPoints() const
 {
     // Iterate over the array of doubles and check x/y values directly.
     // This is about 30% faster than retrieving/comparing CoordinateXY&.
-    for (std::size_t i = stride(); i < m_vect.size(); i += stride()) {
-        if (m_vect[i - stride()] == m_vect[i] && m_vect[i + 1 - stride()] == m_vect[i+1]) {
+    const double* v = ordinates();
+    const std::size_t n = numOrdinates();
+    for (std::size_t i = stride(); i < n; i += stride()) {
+        if (v[i - stride()] == v[i] && v[i + 1 - stride()] == v[i+1]) {
             return true;
         }
     }
@@ -324,17 +373,19 @@ CoordinateSequence::hasRepeatedPoints() const
 bool
 CoordinateSequence::hasRepeatedOrInvalidPoints() const
 {
+    const double* v = ordinates();
+    const std::size_t n = numOrdinates();
     // Check first points
-    if (! (std::isfinite(m_vect[0]) && std::isfinite(m_vect[1]) )) {
+    if (! (std::isfinite(v[0]) && std::isfinite(v[1]) )) {
         return true;
     }
     // Iterate over the array of doubles and check x/y values directly.
     // This is about 30% faster than retrieving/comparing CoordinateXY&.
-    for (std::size_t i = stride(); i < m_vect.size(); i += stride()) {
-        if (! (std::isfinite(m_vect[i]) && std::isfinite(m_vect[i+1]) )) {
+    for (std::size_t i = stride(); i < n; i += stride()) {
+        if (! (std::isfinite(v[i]) && std::isfinite(v[i+1]) )) {
             return true;
         }
-        if (m_vect[i - stride()] == m_vect[i] && m_vect[i + 1 - stride()] == m_vect[i+1]) {
+        if (v[i - stride()] == v[i] && v[i + 1 - stride()] == v[i+1]) {
             return true;
         }
     }
@@ -416,6 +467,7 @@ CoordinateSequence::scroll(const CoordinateXY* firstCoordinate)
 void
 CoordinateSequence::scroll(size_t ind)
 {
+    ensureOwned();
     std::rotate(m_vect.begin(),
         std::next(m_vect.begin(), static_cast<std::ptrdiff_t>(ind * stride())),
         m_vect.end());
@@ -453,6 +505,7 @@ CoordinateSequence::isRing() const
 void
 CoordinateSequence::reverse()
 {
+    ensureOwned();
     auto mid = m_vect.size() / 2;
     auto last = m_vect.size() - stride();
     for (std::size_t i = 0; i < mid; i += stride()) {
@@ -522,9 +575,11 @@ CoordinateSequence::equalsIdentical(const CoordinateSequence& other) const
 
     assert(getCoordinateType() == other.getCoordinateType());
 
-    for (std::size_t i = 0; i < m_vect.size(); i++) {
-        const double& a = m_vect[i];
-        const double& b = other.m_vect[i];
+    const double* v = ordinates();
+    const double* ov = other.ordinates();
+    for (std::size_t i = 0; i < numOrdinates(); i++) {
+        const double& a = v[i];
+        const double& b = ov[i];
         if (a != b && !(std::isnan(a) && std::isnan(b))) {
             return false;
         }
@@ -537,9 +592,25 @@ void
 CoordinateSequence::expandEnvelope(Envelope& env) const
 {
     const std::size_t p_size = getSize();
-    for(std::size_t i = 0; i < p_size; i++) {
+    std::size_t i = 0;
+    // A null envelope takes the first coordinate as is
+    for(; i < p_size && env.isNull(); i++) {
         env.expandToInclude(getAt<CoordinateXY>(i));
     }
+    if (i < p_size) {
+        double xmin, xmax, ymin, ymax;
+        CoordinateKernels::envelope(ordinates() + i * stride(), p_size - i, stride(),
+                                    xmin, xmax, ymin, ymax);
+        // extents are empty (min > max) if all ordinates are NaN
+        if (xmin <= xmax) {
+            env.expandToInclude(xmin, env.getMinY());
+            env.expandToInclude(xmax, env.getMinY());
+        }
+        if (ymin <= ymax) {
+            env.expandToInclude(env.getMinX(), ymin);
+            env.expandToInclude(env.getMinX(), ymax);
+        }
+    }
 }
 
 Envelope
@@ -548,17 +619,8 @@ CoordinateSequence::getEnvelope() const {
         return {};
     }
 
-    double xmin = std::numeric_limits<double>::infinity();
-    double ymin = std::numeric_limits<double>::infinity();
-    double xmax = -std::numeric_limits<double>::infinity();
-    double ymax = -std::numeric_limits<double>::infinity();
-
-    for (std::size_t i = 0; i < m_vect.size(); i += stride()) {
-        xmin = std::min(xmin, m_vect[i]);
-        xmax = std::max(xmax, m_vect[i]);
-        ymin = std::min(ymin, m_vect[i+1]);
-        ymax = std::max(ymax, m_vect[i+1]);
-    }
+    double xmin, xmax, ymin, ymax;
+    CoordinateKernels::envelope(ordinates(), size(), stride(), xmin, xmax, ymin, ymax);
 
     return {xmin, xmax, ymin, ymax};
 }
@@ -610,6 +672,8 @@ CoordinateSequence::setPoints(const std::vector<Coordinate>& v)
     m_hasdim = false;
     m_hasz = false;
     m_hasm = false;
+    m_borrowed = nullptr;
+    m_borrowedSize = 0;
 
     m_vect.resize(m_stride * v.size());
     const double* cbuf = reinterpret_cast<const double*>(v.data());
@@ -623,6 +687,8 @@ CoordinateSequence::setPoints(const std::vector<CoordinateXY>& v)
     m_hasdim = false;
     m_hasz = false;
     m_hasm = false;
+    m_borrowed = nullptr;
+    m_borrowedSize = 0;
 
     m_vect.resize(m_stride * v.size());
     for (std::size_t i = 0; i < v.size(); i++) {
@@ -642,6 +708,7 @@ CoordinateSequence::setZM(bool p_hasZ, bool p_hasM)
     // Make sure we don't carry over Z values that were hiding in a
     // self-declared 2D sequence.
     if (!p_hasZ && (getCoordinateType() == CoordinateType::XYZ || getCoordinateType() == CoordinateType::XYZM)) {
+        ensureOwned();
         const Coordinate& nullCoord = Coordinate::getNull();
         for (std::size_t i = 2; i < m_vect.size(); i += stride()) {
             m_vect[i] = nullCoord.z;
@@ -655,6 +722,7 @@ CoordinateSequence::swap(std::size_t i, std::size_t j)
     using difference_type = decltype(m_vect)::difference_type;
 
     if (i != j) {
+        ensureOwned();
         std::swap_ranges(std::next(m_vect.begin(), static_cast<difference_type>(i*stride())),
                          std::next(m_vect.begin(), static_cast<difference_type>(i+1) * stride()),
                          std::next(m_vect.begin(), static_cast<difference_type>(j*stride())));
@@ -665,7 +733,7 @@ void
 CoordinateSequence::toVector(std::vector<Coordinate>& out) const
 {
     if (getCoordinateType() == CoordinateType::XYZ) {
-        const Coordinate* cbuf = reinterpret_cast<const Coordinate*>(m_vect.data());
+        const Coordinate* cbuf = reinterpret_cast<const Coordinate*>(ordinates());
         out.insert(out.end(), cbuf, cbuf + size());
     } else if (hasZ()) {
         for (const auto& c : items<Coordinate>()) {
@@ -682,7 +750,7 @@ void
 CoordinateSequence::toVector(std::vector<CoordinateXY>& out) const
 {
     if (stride() == 2) {
-        const CoordinateXY* cbuf = reinterpret_cast<const CoordinateXY*>(m_vect.data());
+        const CoordinateXY* cbuf = reinterpret_cast<const CoordinateXY*>(ordinates());
         out.insert(out.end(), cbuf, cbuf + size());
     } else {
         for (const CoordinateXY& c : items<CoordinateXY>()) {
@@ -694,6 +762,7 @@ CoordinateSequence::toVector(std::vector<CoordinateXY>& out) const
 void
 CoordinateSequence::pop_back()
 {
+    ensureOwned();
     switch (stride()) {
     case 4: m_vect.pop_back(); // fall through
     case 3: m_vect.pop_back(); // fall through
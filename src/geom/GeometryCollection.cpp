@@ -327,7 +327,7 @@ GeometryCollection::equalsIdentical(const Geometry* other_g) const
         return false;
     }
 
-    if (envelope != other.envelope) {
+    if (*getEnvelopeInternal() != *other.getEnvelopeInternal()) {
         return false;
     }
 
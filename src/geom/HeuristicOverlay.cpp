@@ -127,6 +127,13 @@ bool isHandledByOverlayNG(const Geometry* geom) {
 
 std::unique_ptr<Geometry>
 HeuristicOverlay(const Geometry* g0, const Geometry* g1, int opCode)
+{
+    return HeuristicOverlay(g0, g1, opCode, nullptr);
+}
+
+std::unique_ptr<Geometry>
+HeuristicOverlay(const Geometry* g0, const Geometry* g1, int opCode,
+                 operation::overlayng::OverlayContext* context)
 {
     /**
      * If feasible, do fast combine instead of full overlay 
@@ -188,7 +195,7 @@ HeuristicOverlay(const Geometry* g0, const Geometry* g1, int opCode)
         ret = OverlayNGRobust::Union(g0);
     }
     else {
-        ret = OverlayNGRobust::Overlay(g0, g1, opCode);
+        ret = OverlayNGRobust::Overlay(g0, g1, opCode, context);
     }
 
     return ret;
@@ -18,11 +18,120 @@
 
 
 #include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Point.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/TaskPool.h>
+
+#include <algorithm>
 
 namespace geos {
 namespace geom { // geos.geom
 namespace prep { // geos.geom.prep
 
+namespace {
+
+// Below this size, preparing per-thread copies is not worth it
+constexpr std::size_t MIN_PARALLEL_BATCH_SIZE = 64;
+
+template<typename F>
+void
+evaluateXY(const PreparedGeometry& prep, const double* x, const double* y,
+           std::size_t start, std::size_t end, unsigned char* result, F&& predicate)
+{
+    auto pt = prep.getGeometry().getFactory()->createPoint(CoordinateXY(0, 0));
+
+    for (std::size_t i = start; i < end; i++) {
+        if ((i & 0x3ff) == 0) {
+            GEOS_CHECK_FOR_INTERRUPTS();
+        }
+        pt->setXY(x[i], y[i]);
+        result[i] = predicate(prep, pt.get());
+    }
+}
+
+template<typename F>
+void
+evaluateEach(const PreparedGeometry& prep, const Geometry* const* geoms,
+             std::size_t start, std::size_t end, unsigned char* result, F&& predicate)
+{
+    for (std::size_t i = start; i < end; i++) {
+        GEOS_CHECK_FOR_INTERRUPTS();
+        result[i] = predicate(prep, geoms[i]);
+    }
+}
+
+}
+
+/*protected*/
+void
+PreparedGeometry::forEachRange(std::size_t n, geos::util::TaskPool* pool,
+                               const std::function<void(const PreparedGeometry&, std::size_t, std::size_t)>& f) const
+{
+    if (pool == nullptr || pool->getNumWorkers() == 0 || n < MIN_PARALLEL_BATCH_SIZE) {
+        f(*this, 0, n);
+        return;
+    }
+
+    // Compute any lazily-cached envelope before it is shared
+    getGeometry().getEnvelopeInternal();
+
+    std::size_t numRanges = std::min(pool->getConcurrency(), n);
+    geos::util::parallelFor(pool, numRanges, [this, n, numRanges, &f](std::size_t r) {
+        std::size_t start = n * r / numRanges;
+        std::size_t end = n * (r + 1) / numRanges;
+
+        auto local = PreparedGeometryFactory::prepare(&getGeometry());
+        f(*local, start, end);
+    });
+}
+
+void
+PreparedGeometry::containsXY(const double* x, const double* y, std::size_t n,
+                             unsigned char* result, geos::util::TaskPool* pool) const
+{
+    forEachRange(n, pool, [x, y, result](const PreparedGeometry& prep, std::size_t start, std::size_t end) {
+        evaluateXY(prep, x, y, start, end, result, [](const PreparedGeometry& p, const Geometry* g) {
+            return p.contains(g);
+        });
+    });
+}
+
+void
+PreparedGeometry::intersectsXY(const double* x, const double* y, std::size_t n,
+                               unsigned char* result, geos::util::TaskPool* pool) const
+{
+    forEachRange(n, pool, [x, y, result](const PreparedGeometry& prep, std::size_t start, std::size_t end) {
+        evaluateXY(prep, x, y, start, end, result, [](const PreparedGeometry& p, const Geometry* g) {
+            return p.intersects(g);
+        });
+    });
+}
+
+void
+PreparedGeometry::containsEach(const Geometry* const* geoms, std::size_t n,
+                               unsigned char* result, geos::util::TaskPool* pool) const
+{
+    forEachRange(n, pool, [geoms, result](const PreparedGeometry& prep, std::size_t start, std::size_t end) {
+        evaluateEach(prep, geoms, start, end, result, [](const PreparedGeometry& p, const Geometry* g) {
+            return p.contains(g);
+        });
+    });
+}
+
+void
+PreparedGeometry::intersectsEach(const Geometry* const* geoms, std::size_t n,
+                                 unsigned char* result, geos::util::TaskPool* pool) const
+{
+    forEachRange(n, pool, [geoms, result](const PreparedGeometry& prep, std::size_t start, std::size_t end) {
+        evaluateEach(prep, geoms, start, end, result, [](const PreparedGeometry& p, const Geometry* g) {
+            return p.intersects(g);
+        });
+    });
+}
+
 } // namespace geos.geom.prep
 } // namespace geos.geom
 } // namespace geos
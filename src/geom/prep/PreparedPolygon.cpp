@@ -31,7 +31,10 @@
 #include <geos/algorithm/locate/PointOnGeometryLocator.h>
 #include <geos/algorithm/locate/IndexedPointInAreaLocator.h>
 #include <geos/algorithm/locate/SimplePointInAreaLocator.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/TaskPool.h>
 // std
+#include <algorithm>
 #include <cstddef>
 
 namespace geos {
@@ -83,6 +86,70 @@ getPointLocator() const
     return indexedPtOnGeomLoc.get();
 }
 
+algorithm::locate::PointOnGeometryLocator*
+PreparedPolygon::
+getIndexedPointLocator() const
+{
+    if (!indexedPtOnGeomLoc) {
+        indexedPtOnGeomLoc = detail::make_unique<algorithm::locate::IndexedPointInAreaLocator>(getGeometry());
+    }
+
+    // The index is built on first use; do so now, before any concurrent use
+    CoordinateXY pt;
+    getGeometry().getEnvelopeInternal()->centre(pt);
+    indexedPtOnGeomLoc->locate(&pt);
+
+    return indexedPtOnGeomLoc.get();
+}
+
+template<typename F>
+void
+PreparedPolygon::
+locateXY(const double* x, const double* y, std::size_t n,
+         unsigned char* result, geos::util::TaskPool* pool, F&& locationTest) const
+{
+    const Envelope* env = getGeometry().getEnvelopeInternal();
+    if (env->isNull()) {
+        std::fill(result, result + n, static_cast<unsigned char>(0));
+        return;
+    }
+
+    algorithm::locate::PointOnGeometryLocator* locator = getIndexedPointLocator();
+
+    constexpr std::size_t chunkSize = 1024;
+    std::size_t numChunks = (n + chunkSize - 1) / chunkSize;
+
+    geos::util::parallelFor(pool, numChunks, [=, &locationTest](std::size_t chunk) {
+        GEOS_CHECK_FOR_INTERRUPTS();
+
+        std::size_t end = std::min(n, (chunk + 1) * chunkSize);
+        for (std::size_t i = chunk * chunkSize; i < end; i++) {
+            CoordinateXY pt(x[i], y[i]);
+            result[i] = env->covers(pt.x, pt.y) && locationTest(locator->locate(&pt));
+        }
+    });
+}
+
+void
+PreparedPolygon::
+containsXY(const double* x, const double* y, std::size_t n,
+           unsigned char* result, geos::util::TaskPool* pool) const
+{
+    locateXY(x, y, n, result, pool, [](Location loc) {
+        return loc == Location::INTERIOR;
+    });
+}
+
+void
+PreparedPolygon::
+intersectsXY(const double* x, const double* y, std::size_t n,
+             unsigned char* result, geos::util::TaskPool* pool) const
+{
+    locateXY(x, y, n, result, pool, [](Location loc) {
+        return loc != Location::EXTERIOR;
+    });
+}
+
 bool
 PreparedPolygon::
 contains(const geom::Geometry* g) const
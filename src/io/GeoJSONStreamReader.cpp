@@ -0,0 +1,294 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamReader.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/ParseException.h>
+
+#include <istream>
+#include <string>
+
+using json = geos_nlohmann::json;
+
+namespace geos {
+namespace io { // geos.io
+
+GeoJSONStreamReader::GeoJSONStreamReader(std::istream& p_instr)
+    : GeoJSONStreamReader(p_instr, *(geom::GeometryFactory::getDefaultInstance()))
+{}
+
+GeoJSONStreamReader::GeoJSONStreamReader(std::istream& p_instr, const geom::GeometryFactory& gf)
+    : instr(p_instr)
+    , reader(gf)
+    , state(State::START)
+    , numFeaturesRead(0)
+    , documentFeatureIndex(0)
+{}
+
+GeoJSONStreamReader::GeoJSONStreamReader(std::unique_ptr<std::istream> p_instr, const geom::GeometryFactory& gf)
+    : ownedStream(std::move(p_instr))
+    , instr(*ownedStream)
+    , reader(gf)
+    , state(State::START)
+    , numFeaturesRead(0)
+    , documentFeatureIndex(0)
+{}
+
+GeoJSONStreamReader::~GeoJSONStreamReader() = default;
+
+/*public*/
+std::unique_ptr<GeoJSONFeature>
+GeoJSONStreamReader::next()
+{
+    std::string text;
+    if (readFeatureText(text)) {
+        try {
+            return std::make_unique<GeoJSONFeature>(reader.readFeature(json::parse(text)));
+        }
+        catch (json::exception& ex) {
+            throw ParseException("Error parsing JSON", ex.what());
+        }
+    }
+
+    if (documentFeatureIndex < documentFeatures.size()) {
+        return std::make_unique<GeoJSONFeature>(std::move(documentFeatures[documentFeatureIndex++]));
+    }
+    return nullptr;
+}
+
+/*public*/
+std::unique_ptr<geom::Geometry>
+GeoJSONStreamReader::nextGeometry()
+{
+    std::string text;
+    if (readFeatureText(text)) {
+        try {
+            return reader.readFeatureForGeometry(json::parse(text));
+        }
+        catch (json::exception& ex) {
+            throw ParseException("Error parsing JSON", ex.what());
+        }
+    }
+
+    if (documentFeatureIndex < documentFeatures.size()) {
+        return documentFeatures[documentFeatureIndex++].getGeometry()->clone();
+    }
+    return nullptr;
+}
+
+/*private*/
+bool
+GeoJSONStreamReader::readFeatureText(std::string& text)
+{
+    // Returns false once the "features" array has been read. A document
+    // without a "features" array is parsed whole into documentFeatures.
+    if (state == State::START) {
+        skipWhitespace();
+        expect('{', &document);
+        readMembers(false);
+    }
+
+    if (state == State::IN_DOCUMENT) {
+        documentFeatures = reader.readFeatures(document).getFeatures();
+        document.clear();
+        state = State::END;
+    }
+
+    if (state != State::IN_FEATURES) {
+        return false;
+    }
+
+    skipWhitespace();
+    if (peek() == ']') {
+        get();
+        readMembers(true);
+        return false;
+    }
+    // features after the first must follow a comma
+    if (numFeaturesRead > 0) {
+        expect(',', nullptr);
+        skipWhitespace();
+    }
+
+    text.clear();
+    readValue(&text);
+    numFeaturesRead++;
+    return true;
+}
+
+/*private*/
+void
+GeoJSONStreamReader::readMembers(bool afterMember)
+{
+    // Reads the members of the top-level object until the start of the
+    // "features" array or the end of the object. Other members are
+    // appended to the document text. Members after the first must
+    // follow a comma.
+    for (;;) {
+        skipWhitespace();
+        if (peek() == '}') {
+            get();
+            document.push_back('}');
+            state = (state == State::IN_FEATURES) ? State::END : State::IN_DOCUMENT;
+            return;
+        }
+        if (afterMember) {
+            expect(',', nullptr);
+            skipWhitespace();
+        }
+        afterMember = true;
+
+        std::string key;
+        readString(&key);
+        skipWhitespace();
+        expect(':', nullptr);
+
+        if (key == "\"features\"" && state == State::START) {
+            skipWhitespace();
+            if (peek() == '[') {
+                get();
+                state = State::IN_FEATURES;
+                return;
+            }
+        }
+
+        if (document.size() > 1) {
+            document.push_back(',');
+        }
+        document += key;
+        document.push_back(':');
+        readValue(&document);
+    }
+}
+
+/*private*/
+int
+GeoJSONStreamReader::get()
+{
+    int c = instr.rdbuf()->sbumpc();
+    if (c == std::char_traits<char>::eof()) {
+        throw ParseException("Unexpected end of GeoJSON input");
+    }
+    return c;
+}
+
+/*private*/
+int
+GeoJSONStreamReader::peek()
+{
+    return instr.rdbuf()->sgetc();
+}
+
+/*private*/
+void
+GeoJSONStreamReader::skipWhitespace()
+{
+    for (;;) {
+        int c = peek();
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+            return;
+        }
+        get();
+    }
+}
+
+/*private*/
+void
+GeoJSONStreamReader::expect(char expected, std::string* out)
+{
+    int c = get();
+    if (c != expected) {
+        throw ParseException("Expected '" + std::string(1, expected) + "' in GeoJSON input");
+    }
+    if (out) {
+        out->push_back(expected);
+    }
+}
+
+/*private*/
+void
+GeoJSONStreamReader::readString(std::string* out)
+{
+    expect('"', out);
+    for (;;) {
+        char c = static_cast<char>(get());
+        if (out) {
+            out->push_back(c);
+        }
+        if (c == '\\') {
+            char escaped = static_cast<char>(get());
+            if (out) {
+                out->push_back(escaped);
+            }
+        }
+        else if (c == '"') {
+            return;
+        }
+    }
+}
+
+/*private*/
+void
+GeoJSONStreamReader::readValue(std::string* out)
+{
+    skipWhitespace();
+    int c = peek();
+
+    if (c == '"') {
+        readString(out);
+        return;
+    }
+
+    if (c == '{' || c == '[') {
+        int depth = 0;
+        do {
+            if (peek() == '"') {
+                readString(out);
+                continue;
+            }
+            c = get();
+            if (out) {
+                out->push_back(static_cast<char>(c));
+            }
+            if (c == '{' || c == '[') {
+                depth++;
+            }
+            else if (c == '}' || c == ']') {
+                depth--;
+            }
+        }
+        while (depth > 0);
+        return;
+    }
+
+    // number, boolean or null
+    std::size_t len = 0;
+    while ((c = peek()) != std::char_traits<char>::eof() &&
+            c != ',' && c != '}' && c != ']' &&
+            c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+        get();
+        if (out) {
+            out->push_back(static_cast<char>(c));
+        }
+        len++;
+    }
+    if (len == 0) {
+        throw ParseException("Unexpected character in GeoJSON input");
+    }
+}
+
+} // namespace geos.io
+} // namespace geos
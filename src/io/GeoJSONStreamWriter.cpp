@@ -0,0 +1,96 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/GeoJSONStreamWriter.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalStateException.h>
+
+#include <ostream>
+
+namespace geos {
+namespace io { // geos.io
+
+static const char* const COLLECTION_START = "{\"type\":\"FeatureCollection\",\"features\":[";
+static const char* const COLLECTION_END = "]}";
+
+GeoJSONStreamWriter::GeoJSONStreamWriter(std::ostream& p_os)
+    : os(p_os)
+    , numFeatures(0)
+    , isFinished(false)
+{}
+
+GeoJSONStreamWriter::GeoJSONStreamWriter(std::unique_ptr<std::ostream> p_os)
+    : ownedStream(std::move(p_os))
+    , os(*ownedStream)
+    , numFeatures(0)
+    , isFinished(false)
+{}
+
+GeoJSONStreamWriter::~GeoJSONStreamWriter()
+{
+    if (!isFinished) {
+        finish();
+    }
+}
+
+/*public*/
+void
+GeoJSONStreamWriter::write(const GeoJSONFeature& feature)
+{
+    writeSeparator();
+    os << writer.write(feature);
+}
+
+/*public*/
+void
+GeoJSONStreamWriter::write(const geom::Geometry* geometry)
+{
+    writeSeparator();
+    os << writer.write(geometry, GeoJSONType::FEATURE);
+}
+
+/*public*/
+void
+GeoJSONStreamWriter::finish()
+{
+    if (isFinished) {
+        return;
+    }
+    if (numFeatures == 0) {
+        os << COLLECTION_START;
+    }
+    os << COLLECTION_END;
+    os.flush();
+    isFinished = true;
+}
+
+/*private*/
+void
+GeoJSONStreamWriter::writeSeparator()
+{
+    if (isFinished) {
+        throw util::IllegalStateException("GeoJSONStreamWriter has been finished");
+    }
+    if (numFeatures == 0) {
+        os << COLLECTION_START;
+    }
+    else {
+        os << ',';
+    }
+    numFeatures++;
+}
+
+} // namespace geos.io
+} // namespace geos
@@ -20,9 +20,23 @@
 #include <geos/io/StringTokenizer.h>
 #include <geos/constants.h>
 
-#include <string>
+#include <algorithm>
+#include <cctype>
 #include <cstdlib>
 #include <limits>
+#include <string>
+
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+// from_chars for floating point values is missing from some
+// standard libraries
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define GEOS_HAVE_FROM_CHARS_DOUBLE 1
+#endif
 
 using std::string;
 
@@ -31,12 +45,22 @@ namespace io { // geos.io
 
 /*public*/
 StringTokenizer::StringTokenizer(const string& txt)
+    : StringTokenizer(txt, 0)
+{
+}
+
+/*public*/
+StringTokenizer::StringTokenizer(const string& txt, std::size_t start)
     :
-    str(txt),
+    begin(txt.data()),
+    end(txt.data() + txt.size()),
+    iter(txt.data() + std::min(start, txt.size())),
     stok(""),
-    ntok(0.0)
+    ntok(0.0),
+    hasPeek(false),
+    peekTo(nullptr),
+    peekType(TT_EOF)
 {
-    iter = str.begin();
 }
 
 double
@@ -75,112 +99,114 @@ strtod_with_vc_fix(const char* str, char** str_end)
     return dbl;
 }
 
-/*public*/
-int
-StringTokenizer::nextToken()
+namespace {
+
+inline bool
+isWhitespace(char c)
 {
-    string tok = "";
-    if(iter == str.end()) {
-        return StringTokenizer::TT_EOF;
-    }
-    switch(*iter) {
-    case '(':
-    case ')':
-    case ',':
-        return *iter++;
-    case '\n':
-    case '\r':
-    case '\t':
-    case ' ':
-        string::size_type pos = str.find_first_not_of(" \n\r\t",
-                                static_cast<string::size_type>(iter - str.begin()));
-        if(pos == string::npos) {
-            return StringTokenizer::TT_EOF;
-        }
-        else {
-            iter = str.begin() + static_cast<string::difference_type>(pos);
-            return nextToken();
-        }
-    }
-    string::size_type pos = str.find_first_of("\n\r\t() ,",
-                            static_cast<string::size_type>(iter - str.begin()));
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-            iter = str.end();
-        }
-        else {
-            return StringTokenizer::TT_EOF;
-        }
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+inline bool
+isDelimiter(char c)
+{
+    return isWhitespace(c) || c == '(' || c == ')' || c == ',';
+}
+
+// Parses a number occupying all of [from, to)
+bool
+parseNumber(const char* from, const char* to, double& val)
+{
+#if GEOS_HAVE_FROM_CHARS_DOUBLE
+    auto res = std::from_chars(from, to, val);
+    if(res.ec == std::errc() && res.ptr == to) {
+        return true;
     }
-    else {
-        tok.assign(iter, str.begin() + static_cast<string::difference_type>(pos));
-        iter = str.begin() + static_cast<string::difference_type>(pos);
+#endif
+    // strtod also accepts a leading '+', hexadecimal values and
+    // out-of-range values. No number starts with another letter.
+    char c = *from;
+    if(!std::isdigit(static_cast<unsigned char>(c)) &&
+            c != '+' && c != '-' && c != '.' &&
+            c != 'i' && c != 'I' && c != 'n' && c != 'N') {
+        return false;
     }
+    string tok(from, to);
     char* stopstring;
     double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
     if(*stopstring == '\0') {
-        ntok = dbl;
-        stok = "";
-        return StringTokenizer::TT_NUMBER;
-    }
-    else {
-        ntok = 0.0;
-        stok = tok;
-        return StringTokenizer::TT_WORD;
+        val = dbl;
+        return true;
     }
+    return false;
 }
 
-/*public*/
+}
+
+/*private*/
 int
-StringTokenizer::peekNextToken()
+StringTokenizer::scanToken(const char*& to)
 {
-
-    string::size_type pos;
-    string tok = "";
-    if(iter == str.end()) {
-        return StringTokenizer::TT_EOF;
+    const char* from = iter;
+    while(from != end && isWhitespace(*from)) {
+        from++;
     }
-
-    pos = str.find_first_not_of(" \r\n\t", static_cast<string::size_type>(iter - str.begin()));
-
-    if(pos == string::npos) {
+    if(from == end) {
+        to = end;
         return StringTokenizer::TT_EOF;
     }
-    switch(str[pos]) {
+    switch(*from) {
     case '(':
     case ')':
     case ',':
-        return str[pos];
+        to = from + 1;
+        return *from;
     }
 
     // It's either a Number or a Word, let's see when it ends
-    pos = str.find_first_of("\n\r\t() ,", pos + 1);
-
-    if(pos == string::npos) {
-        if(iter != str.end()) {
-            tok.assign(iter, str.end());
-        }
-        else {
-            return StringTokenizer::TT_EOF;
-        }
-    }
-    else {
-        tok.assign(iter, str.begin() + static_cast<string::difference_type>(pos)); //str.end());
+    to = from + 1;
+    while(to != end && !isDelimiter(*to)) {
+        to++;
     }
 
-    char* stopstring;
-    double dbl = strtod_with_vc_fix(tok.c_str(), &stopstring);
-    if(*stopstring == '\0') {
+    double dbl;
+    if(parseNumber(from, to, dbl)) {
         ntok = dbl;
-        stok = "";
+        stok.clear();
         return StringTokenizer::TT_NUMBER;
     }
+    ntok = 0.0;
+    stok.assign(from, to);
+    return StringTokenizer::TT_WORD;
+}
+
+/*public*/
+int
+StringTokenizer::nextToken()
+{
+    int type;
+    const char* to;
+    if(hasPeek) {
+        type = peekType;
+        to = peekTo;
+        hasPeek = false;
+    }
     else {
-        ntok = 0.0;
-        stok = tok;
-        return StringTokenizer::TT_WORD;
+        type = scanToken(to);
     }
+    iter = to;
+    return type;
+}
+
+/*public*/
+int
+StringTokenizer::peekNextToken()
+{
+    if(!hasPeek) {
+        peekType = scanToken(peekTo);
+        hasPeek = true;
+    }
+    return peekType;
 }
 
 /*public*/
@@ -197,5 +223,12 @@ StringTokenizer::getSVal() const
     return stok;
 }
 
+/*public*/
+std::size_t
+StringTokenizer::getPosition() const
+{
+    return static_cast<std::size_t>(iter - begin);
+}
+
 } // namespace geos.io
 } // namespace geos
@@ -0,0 +1,379 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/io/WKBMappedReader.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/io/ByteOrderDataInStream.h>
+#include <geos/io/ByteOrderValues.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/WKBConstants.h>
+#include <geos/io/WKBReader.h>
+#include <geos/util/GEOSException.h>
+
+#include <cmath>
+#include <sstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::GeometryFactory;
+
+namespace geos {
+namespace io {
+
+/**
+ * A read-only memory mapping of a whole file.
+ */
+class WKBMappedReader::MappedFile {
+
+public:
+
+    explicit MappedFile(const std::string& fileName)
+    {
+#ifdef _WIN32
+        fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            throw util::GEOSException("Unable to open file " + fileName);
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize)) {
+            CloseHandle(fileHandle);
+            throw util::GEOSException("Unable to read size of file " + fileName);
+        }
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+        if (size == 0) {
+            return;
+        }
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle != nullptr) {
+            addr = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        }
+        if (addr == nullptr) {
+            release();
+            throw util::GEOSException("Unable to map file " + fileName);
+        }
+#else
+        int fd = open(fileName.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw util::GEOSException("Unable to open file " + fileName);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            close(fd);
+            throw util::GEOSException("Unable to read size of file " + fileName);
+        }
+        size = static_cast<std::size_t>(st.st_size);
+        if (size > 0) {
+            addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if (addr == MAP_FAILED) {
+            addr = nullptr;
+            throw util::GEOSException("Unable to map file " + fileName);
+        }
+#endif
+    }
+
+    ~MappedFile()
+    {
+        release();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const unsigned char* getData() const
+    {
+        return static_cast<const unsigned char*>(addr);
+    }
+
+    std::size_t getSize() const
+    {
+        return size;
+    }
+
+private:
+
+    void* addr = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#endif
+
+    void release()
+    {
+#ifdef _WIN32
+        if (addr != nullptr) {
+            UnmapViewOfFile(addr);
+        }
+        if (mappingHandle != nullptr) {
+            CloseHandle(mappingHandle);
+        }
+        if (fileHandle != INVALID_HANDLE_VALUE) {
+            CloseHandle(fileHandle);
+        }
+#else
+        if (addr != nullptr) {
+            munmap(addr, size);
+        }
+#endif
+        addr = nullptr;
+    }
+};
+
+namespace {
+
+/**
+ * Walks the structure of a WKB record to find its length and,
+ * optionally, the envelope of its vertices, without creating any
+ * geometry. When the envelope is not needed the coordinates are
+ * skipped without being read.
+ */
+class WKBScanner {
+
+public:
+
+    WKBScanner(const unsigned char* buf, std::size_t size, bool p_computeEnvelope)
+        : dis(buf, size)
+        , remainingAtStart(size)
+        , computeEnvelope(p_computeEnvelope)
+        , hasArcs(false)
+        , depth(0)
+    {}
+
+    void scan()
+    {
+        scanGeometry();
+    }
+
+    std::size_t getLength() const
+    {
+        return remainingAtStart - dis.size();
+    }
+
+    const Envelope& getEnvelope() const
+    {
+        return env;
+    }
+
+    /**
+     * Tests whether the record contains circular arcs, in which case
+     * the envelope of the vertices may not contain the geometry.
+     */
+    bool hasCircularArcs() const
+    {
+        return hasArcs;
+    }
+
+private:
+
+    static constexpr int MAX_PARSE_DEPTH = 100;
+
+    ByteOrderDataInStream dis;
+    std::size_t remainingAtStart;
+    bool computeEnvelope;
+    Envelope env;
+    bool hasArcs;
+    int depth;
+
+    void scanGeometry()
+    {
+        if (depth >= MAX_PARSE_DEPTH) {
+            throw ParseException("Input geometry exceeds nesting depth limit");
+        }
+        ++depth;
+        struct DepthGuard { int& d; ~DepthGuard() { --d; } } guard{depth};
+
+        unsigned char byteOrder = dis.readByte();
+        if (byteOrder == WKBConstants::wkbNDR) {
+            dis.setOrder(ByteOrderValues::ENDIAN_LITTLE);
+        }
+        else if (byteOrder == WKBConstants::wkbXDR) {
+            dis.setOrder(ByteOrderValues::ENDIAN_BIG);
+        }
+        else {
+            throw ParseException("Invalid WKB byte order");
+        }
+
+        uint32_t typeInt = dis.readUnsigned();
+        uint32_t geometryType = (typeInt & 0xffff) % 1000;
+        uint32_t isoTypeRange = (typeInt & 0xffff) / 1000;
+        bool hasZ = (isoTypeRange == 1) || (isoTypeRange == 3) || (typeInt & 0x80000000) != 0;
+        bool hasM = (isoTypeRange == 2) || (isoTypeRange == 3) || (typeInt & 0x40000000) != 0;
+        unsigned int dim = 2u + (hasZ ? 1u : 0u) + (hasM ? 1u : 0u);
+
+        if ((typeInt & 0x20000000) != 0) {
+            dis.readInt(); // SRID
+        }
+
+        switch (geometryType) {
+        case WKBConstants::wkbPoint:
+            scanCoordinates(1, dim);
+            break;
+        case WKBConstants::wkbCircularString:
+            hasArcs = true;
+            scanCoordinates(dis.readUnsigned(), dim);
+            break;
+        case WKBConstants::wkbLineString:
+            scanCoordinates(dis.readUnsigned(), dim);
+            break;
+        case WKBConstants::wkbPolygon: {
+            uint32_t numRings = dis.readUnsigned();
+            for (uint32_t i = 0; i < numRings; i++) {
+                scanCoordinates(dis.readUnsigned(), dim);
+            }
+            break;
+        }
+        case WKBConstants::wkbMultiPoint:
+        case WKBConstants::wkbMultiLineString:
+        case WKBConstants::wkbMultiPolygon:
+        case WKBConstants::wkbGeometryCollection:
+        case WKBConstants::wkbCompoundCurve:
+        case WKBConstants::wkbCurvePolygon:
+        case WKBConstants::wkbMultiCurve:
+        case WKBConstants::wkbMultiSurface: {
+            uint32_t numGeoms = dis.readUnsigned();
+            for (uint32_t i = 0; i < numGeoms; i++) {
+                scanGeometry();
+            }
+            break;
+        }
+        default:
+            std::stringstream err;
+            err << "Unknown WKB type " << geometryType;
+            throw ParseException(err.str());
+        }
+    }
+
+    void scanCoordinates(uint32_t numPoints, unsigned int dim)
+    {
+        if (numPoints > dis.size() / (8u * dim)) {
+            throw ParseException("Input buffer is smaller than requested object size");
+        }
+        if (!computeEnvelope) {
+            dis.skip(static_cast<std::size_t>(numPoints) * 8u * dim);
+            return;
+        }
+        for (uint32_t i = 0; i < numPoints; i++) {
+            double x = dis.readDouble();
+            double y = dis.readDouble();
+            for (unsigned int j = 2; j < dim; j++) {
+                dis.readDouble();
+            }
+            // Empty points are encoded as NaN
+            if (!std::isnan(x) && !std::isnan(y)) {
+                env.expandToInclude(x, y);
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+WKBMappedReader::WKBMappedReader(const std::string& fileName)
+    : WKBMappedReader(fileName, *GeometryFactory::getDefaultInstance())
+{}
+
+WKBMappedReader::WKBMappedReader(const std::string& fileName, const GeometryFactory& f)
+    : factory(f)
+    , file(new MappedFile(fileName))
+    , data(file->getData())
+    , dataSize(file->getSize())
+{
+    buildIndex();
+}
+
+WKBMappedReader::WKBMappedReader(const unsigned char* buf, std::size_t size)
+    : WKBMappedReader(buf, size, *GeometryFactory::getDefaultInstance())
+{}
+
+WKBMappedReader::WKBMappedReader(const unsigned char* buf, std::size_t size, const GeometryFactory& f)
+    : factory(f)
+    , data(buf)
+    , dataSize(size)
+{
+    buildIndex();
+}
+
+WKBMappedReader::~WKBMappedReader() = default;
+
+/*private*/
+void
+WKBMappedReader::buildIndex()
+{
+    std::size_t offset = 0;
+    while (offset < dataSize) {
+        WKBScanner scanner(data + offset, dataSize - offset, false);
+        scanner.scan();
+
+        offsets.push_back(offset);
+        offset += scanner.getLength();
+    }
+    offsets.push_back(dataSize);
+}
+
+/*private*/
+void
+WKBMappedReader::computeEnvelopes() const
+{
+    envelopes.clear();
+    envelopes.reserve(size());
+    for (std::size_t i = 0; i < size(); i++) {
+        WKBScanner scanner(getRecordData(i), getRecordSize(i), true);
+        scanner.scan();
+
+        if (scanner.hasCircularArcs()) {
+            envelopes.push_back(*read(i)->getEnvelopeInternal());
+        }
+        else {
+            envelopes.push_back(scanner.getEnvelope());
+        }
+    }
+}
+
+/*public*/
+const Envelope&
+WKBMappedReader::getEnvelope(std::size_t i) const
+{
+    std::call_once(envelopesComputed, [this]() {
+        computeEnvelopes();
+    });
+    return envelopes[i];
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+WKBMappedReader::read(std::size_t i) const
+{
+    WKBReader rdr(factory);
+    return rdr.read(getRecordData(i), getRecordSize(i));
+}
+
+} // namespace io
+} // namespace geos
@@ -38,7 +38,9 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/util.h>
+#include <geos/util/TaskPool.h>
 
+#include <algorithm>
 #include <iomanip>
 #include <ostream>
 #include <sstream>
@@ -260,6 +262,31 @@ WKBReader::read(const unsigned char* buf, size_t size)
     return readGeometry();
 }
 
+std::vector<std::unique_ptr<Geometry>>
+WKBReader::readBatch(const unsigned char* const* bufs, const size_t* sizes, size_t n,
+                     util::TaskPool* pool) const
+{
+    std::vector<std::unique_ptr<Geometry>> results(n);
+
+    auto readRange = [&](WKBReader& reader, std::size_t start, std::size_t end) {
+        for (std::size_t i = start; i < end; i++) {
+            results[i] = reader.read(bufs[i], sizes[i]);
+        }
+    };
+
+    // number of consecutive buffers read by a task, sharing a reader
+    const std::size_t grainSize = 64;
+    const std::size_t numChunks = (n + grainSize - 1) / grainSize;
+
+    util::parallelFor(pool, numChunks, [&](std::size_t c) {
+        WKBReader reader(factory);
+        reader.setFixStructure(fixStructure);
+        readRange(reader, c * grainSize, std::min(n, (c + 1) * grainSize));
+    });
+
+    return results;
+}
+
 static constexpr int MAX_PARSE_DEPTH = 100;
 
 std::unique_ptr<Geometry>
@@ -595,6 +622,34 @@ WKBReader::readCoordinateSequence(uint32_t size)
     minMemSize(GEOS_LINESTRING, size);
     auto seq = detail::make_unique<CoordinateSequence>(size, hasZ, hasM, false);
 
+    // When the sequence stores the ordinates in the input as the leading
+    // ordinates of each coordinate, the coordinates are read as one block.
+    // This covers XYZ and XYZM, and XY stored with a padded stride of 3.
+    const std::size_t stride = seq->stride();
+    if (stride == inputDimension || (!hasZ && !hasM)) {
+        if (stride == inputDimension) {
+            dis.readDoubles(seq->data(), static_cast<std::size_t>(size) * inputDimension);
+        } else {
+            dis.readDoubles(seq->data(), size, inputDimension, stride);
+            double* ords = seq->data();
+            for (std::size_t i = 0; i < size; i++) {
+                for (std::size_t j = inputDimension; j < stride; j++) {
+                    ords[i * stride + j] = DoubleNotANumber;
+                }
+            }
+        }
+
+        const PrecisionModel& pm = *factory.getPrecisionModel();
+        if (pm.getType() != PrecisionModel::FLOATING) {
+            double* ords = seq->data();
+            for (std::size_t i = 0; i < size; i++) {
+                ords[i * stride] = pm.makePrecise(ords[i * stride]);
+                ords[i * stride + 1] = pm.makePrecise(ords[i * stride + 1]);
+            }
+        }
+        return seq;
+    }
+
     CoordinateXYZM coord(0, 0, DoubleNotANumber, DoubleNotANumber);
     for(uint32_t i = 0; i < size; i++) {
         readCoordinate();
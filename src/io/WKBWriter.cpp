@@ -34,8 +34,10 @@
 #include <geos/geom/CoordinateSequence.h>
 #include <geos/geom/PrecisionModel.h>
 
+#include <cstring>
 #include <ostream>
 #include <sstream>
+#include <vector>
 #include <cassert>
 
 #include "geos/util.h"
@@ -58,7 +60,8 @@ WKBWriter::WKBWriter(uint8_t dims, int bo, bool srid, int flv)
     , byteOrder(bo)
     , flavor(flv)
     , includeSRID(srid)
-    , outStream(nullptr)
+    , outBuf(nullptr)
+    , outPos(0)
 {
     if(dims < 2 || dims > 4) {
         throw util::IllegalArgumentException("WKB output dimension must be 2, 3, or 4");
@@ -104,14 +107,50 @@ WKBWriter::writeHEX(const Geometry& g, std::ostream& os)
 
 void
 WKBWriter::write(const Geometry& g, std::ostream& os)
+{
+    std::vector<unsigned char> bytes(getWkbSize(g));
+    write(g, bytes.data(), bytes.size());
+    os.write(reinterpret_cast<const char*>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+}
+
+/* public */
+std::size_t
+WKBWriter::getWkbSize(const Geometry& g)
+{
+    // Run the writer without an output buffer to count the bytes
+    outBuf = nullptr;
+    outPos = 0;
+    writeGeometry(g);
+    return outPos;
+}
+
+/* public */
+std::size_t
+WKBWriter::write(const Geometry& g, unsigned char* buf, std::size_t bufSize)
+{
+    std::size_t size = getWkbSize(g);
+    if (buf == nullptr || bufSize < size) {
+        throw util::IllegalArgumentException("WKB output buffer is too small");
+    }
+
+    outBuf = buf;
+    outPos = 0;
+    writeGeometry(g);
+    outBuf = nullptr;
+
+    assert(outPos == size);
+    return size;
+}
+
+void
+WKBWriter::writeGeometry(const Geometry& g)
 {
     OrdinateSet inputOrdinates = OrdinateSet::createXY();
     inputOrdinates.setM(g.hasM());
     inputOrdinates.setZ(g.hasZ());
     outputOrdinates = getOutputOrdinates(inputOrdinates);
 
-    outStream = &os;
-
     switch(g.getGeometryTypeId()) {
         case GEOS_POINT: writePoint(static_cast<const Point&>(g)); break;
         case GEOS_LINESTRING:
@@ -251,11 +290,11 @@ WKBWriter::writeCurvePolygon(const CurvePolygon& g)
     writeInt(static_cast<int>(nholes + 1));
 
     const Curve* ring = g.getExteriorRing();
-    write(*ring, *outStream);
+    writeGeometry(*ring);
 
     for(std::size_t i = 0; i < nholes; i++) {
         ring = g.getInteriorRingN(i);
-        write(*ring, *outStream);
+        writeGeometry(*ring);
     }
 }
 
@@ -272,12 +311,11 @@ WKBWriter::writeGeometryCollection(const GeometryCollection& g)
     auto orig_includeSRID = includeSRID;
     includeSRID = false;
 
-    assert(outStream);
     for(std::size_t i = 0; i < ngeoms; i++) {
         const Geometry* elem = g.getGeometryN(i);
         assert(elem);
 
-        write(*elem, *outStream);
+        writeGeometry(*elem);
     }
     includeSRID = orig_includeSRID;
 }
@@ -285,15 +323,15 @@ WKBWriter::writeGeometryCollection(const GeometryCollection& g)
 void
 WKBWriter::writeByteOrder()
 {
-    if(byteOrder == ByteOrderValues::ENDIAN_LITTLE) {
-        buf[0] = WKBConstants::wkbNDR;
-    }
-    else {
-        buf[0] = WKBConstants::wkbXDR;
+    if(outBuf) {
+        if(byteOrder == ByteOrderValues::ENDIAN_LITTLE) {
+            outBuf[outPos] = WKBConstants::wkbNDR;
+        }
+        else {
+            outBuf[outPos] = WKBConstants::wkbXDR;
+        }
     }
-
-    assert(outStream);
-    outStream->write(reinterpret_cast<char*>(buf), 1);
+    outPos += 1;
 }
 
 /* public */
@@ -361,9 +399,24 @@ WKBWriter::writeSRID(int SRID)
 void
 WKBWriter::writeInt(int val)
 {
-    ByteOrderValues::putInt(val, buf, byteOrder);
-    outStream->write(reinterpret_cast<char*>(buf), 4);
-    //outStream->write(reinterpret_cast<char *>(&val), 4);
+    if(outBuf) {
+        ByteOrderValues::putInt(val, outBuf + outPos, byteOrder);
+    }
+    outPos += 4;
+}
+
+void
+WKBWriter::writeDouble(double val)
+{
+    if(outBuf) {
+        if(byteOrder == getMachineByteOrder()) {
+            std::memcpy(outBuf + outPos, &val, 8);
+        }
+        else {
+            ByteOrderValues::putDouble(val, outBuf + outPos, byteOrder);
+        }
+    }
+    outPos += 8;
 }
 
 void
@@ -375,6 +428,40 @@ WKBWriter::writeCoordinateSequence(const CoordinateSequence& cs,
     if(sized) {
         writeInt(static_cast<int>(size));
     }
+
+    std::size_t outDim = 2u + outputOrdinates.hasZ() + outputOrdinates.hasM();
+    if(!outBuf) {
+        outPos += size * outDim * 8;
+        return;
+    }
+
+    // When the stored ordinates are exactly those written and no byte
+    // swapping is needed, the sequence can be copied as a block.
+    bool sameOrdinates = cs.stride() == outDim &&
+                         (outDim != 3 || cs.hasM() == outputOrdinates.hasM());
+    if(sameOrdinates && byteOrder == getMachineByteOrder() && size > 0) {
+        std::size_t nbytes = size * outDim * 8;
+        std::memcpy(outBuf + outPos, cs.data(), nbytes);
+        outPos += nbytes;
+        return;
+    }
+
+    // When the ordinates written are the leading ordinates of each
+    // stored coordinate, such as XY stored with a padded stride of 3,
+    // each coordinate can be copied as a block.
+    bool leadingOrdinates = outDim == 2 ||
+                            (outDim == 3 && cs.hasZ() && outputOrdinates.hasZ());
+    if(leadingOrdinates && byteOrder == getMachineByteOrder() && size > 0) {
+        const double* src = cs.data();
+        std::size_t stride = cs.stride();
+        std::size_t nbytes = outDim * 8;
+        for(std::size_t i = 0; i < size; i++) {
+            std::memcpy(outBuf + outPos, src + i * stride, nbytes);
+            outPos += nbytes;
+        }
+        return;
+    }
+
     for(std::size_t i = 0; i < size; i++) {
         writeCoordinate(cs, i);
     }
@@ -386,22 +473,16 @@ WKBWriter::writeCoordinate(const CoordinateSequence& cs, std::size_t idx)
 #if DEBUG_WKB_WRITER
     std::cout << "writeCoordinate: X:" << cs.getX(idx) << " Y:" << cs.getY(idx) << std::endl;
 #endif
-    assert(outStream);
-
     CoordinateXYZM coord(DoubleNotANumber, DoubleNotANumber, DoubleNotANumber, DoubleNotANumber);
     cs.getAt(idx, coord);
 
-    ByteOrderValues::putDouble(coord.x, buf, byteOrder);
-    outStream->write(reinterpret_cast<char*>(buf), 8);
-    ByteOrderValues::putDouble(coord.y, buf, byteOrder);
-    outStream->write(reinterpret_cast<char*>(buf), 8);
+    writeDouble(coord.x);
+    writeDouble(coord.y);
     if(outputOrdinates.hasZ()) {
-        ByteOrderValues::putDouble(coord.z, buf, byteOrder);
-        outStream->write(reinterpret_cast<char*>(buf), 8);
+        writeDouble(coord.z);
     }
     if(outputOrdinates.hasM()) {
-        ByteOrderValues::putDouble(coord.m, buf, byteOrder);
-        outStream->write(reinterpret_cast<char*>(buf), 8);
+        writeDouble(coord.m);
     }
 }
 
@@ -18,9 +18,9 @@
 #include <iostream>
 #include <sstream>
 #include <memory> // for unique_ptr
-#include <algorithm>
 
 #include <geos/io/WKTFileReader.h>
+#include <geos/io/WKTStreamReader.h>
 
 using namespace geos::geom;
 
@@ -41,47 +41,19 @@ std::vector<std::unique_ptr<Geometry>>
 WKTFileReader::read(std::string fname)
 {
     std::ifstream f( fname );
-    std::vector<std::unique_ptr<Geometry>> geoms;
-    geos::io::WKTReader rdr;
+    WKTStreamReader rdr(f);
 
+    std::vector<std::unique_ptr<Geometry>> geoms;
     while (true) {
-        auto g = readGeom( f, rdr );
+        auto g = rdr.next();
         if (g == nullptr) {
             break;
         }
         geoms.push_back(std::move(g));
     }
-    f.close();
 
     return geoms;
 }
 
-/*
-Return: nullptr if at EOF
-*/
-std::unique_ptr<Geometry>
-WKTFileReader::readGeom(std::ifstream& f, geos::io::WKTReader& rdr)
-{
-    std::string wkt = "";
-
-    std::string::difference_type lParen = 0;
-    std::string::difference_type rParen = 0;
-    do {
-        std::string line;
-        std::getline(f, line);
-        if (! f) {
-            return nullptr;
-        }
-
-        lParen += std::count(line.begin(), line.end(), '(');
-        rParen += std::count(line.begin(), line.end(), ')');
-
-        wkt += line;
-    } while (lParen == 0 || lParen != rParen);
-
-    auto g = rdr.read( wkt.c_str() );
-    return g;
-}
-
 }
 }
@@ -69,6 +69,24 @@ WKTReader::read(const std::string& wellKnownText) const
 }
 
 
+std::unique_ptr<Geometry>
+WKTReader::readNext(const std::string& text, std::size_t& pos) const
+{
+    parseDepth_ = 0;
+    CLocalizer clocale;
+    StringTokenizer tokenizer(text, pos);
+    if (tokenizer.peekNextToken() == StringTokenizer::TT_EOF) {
+        pos = text.size();
+        return nullptr;
+    }
+
+    OrdinateSet ordinateFlags = OrdinateSet::createXY();
+    auto ret = readGeometryTaggedText(&tokenizer, ordinateFlags);
+    pos = tokenizer.getPosition();
+
+    return ret;
+}
+
 std::unique_ptr<CoordinateSequence>
 WKTReader::readCoordinates(const std::string& wellKnownText) const
 {
@@ -99,11 +117,21 @@ WKTReader::getCoordinates(StringTokenizer* tokenizer, OrdinateSet& ordinateFlags
     auto coordinates = detail::make_unique<CoordinateSequence>(0u, ordinateFlags.hasZ(), ordinateFlags.hasM());
     coordinates->add(coord);
 
-    nextToken = getNextCloserOrComma(tokenizer);
-    while(nextToken == ",") {
+    for (;;) {
+        // check the separator without building a string
+        int type = tokenizer->peekNextToken();
+        if (type == ',') {
+            tokenizer->nextToken();
+        }
+        else if (type == ')') {
+            tokenizer->nextToken();
+            break;
+        }
+        else {
+            getNextCloserOrComma(tokenizer); // throws
+        }
         getPreciseCoordinate(tokenizer, ordinateFlags, coord);
         coordinates->add(coord);
-        nextToken = getNextCloserOrComma(tokenizer);
     }
 
     return coordinates;
@@ -18,7 +18,8 @@
 #include <iostream>
 #include <sstream>
 #include <memory> // for unique_ptr
-#include <algorithm>
+#include <cctype>
+#include <string>
 
 #include <geos/io/WKTStreamReader.h>
 
@@ -27,8 +28,12 @@ using namespace geos::geom;
 namespace geos {
 namespace io {
 
-WKTStreamReader::WKTStreamReader(std::istream& p_instr)
+WKTStreamReader::WKTStreamReader(std::istream& p_instr, std::size_t p_chunkSize)
     : instr(p_instr)
+    , chunkSize(p_chunkSize > 0 ? p_chunkSize : DEFAULT_CHUNK_SIZE)
+    , pos(0)
+    , scanPos(0)
+    , depth(0)
 {
 }
 
@@ -36,8 +41,89 @@ WKTStreamReader::~WKTStreamReader() {
 
 }
 
-/*public*/
+/*
+Return: false if at EOF
+*/
+bool
+WKTStreamReader::readChunk()
+{
+    //-- drop the text already parsed
+    if (pos > 0) {
+        buffer.erase(0, pos);
+        scanPos -= pos;
+        pos = 0;
+    }
+
+    std::size_t size = buffer.size();
+    buffer.resize(size + chunkSize);
+    instr.read(&buffer[size], static_cast<std::streamsize>(chunkSize));
+    std::size_t count = static_cast<std::size_t>(instr.gcount());
+    buffer.resize(size + count);
+    return count > 0;
+}
+
+static bool
+isWordChar(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '-' || c == '+' || c == '_';
+}
+
+static bool
+isEmptyWord(const std::string& text, std::size_t start, std::size_t end)
+{
+    static const char EMPTY[] = "EMPTY";
+    if (end - start != 5) {
+        return false;
+    }
+    for (std::size_t i = 0; i < 5; i++) {
+        if (std::toupper(static_cast<unsigned char>(text[start + i])) != EMPTY[i]) {
+            return false;
+        }
+    }
+    return true;
+}
 
+/*
+Return: the offset following the geometry starting at pos,
+or npos if the buffer does not hold all of it.
+
+A geometry ends with the parenthesis closing its first one,
+or with an EMPTY outside parentheses. A word at the end of the
+buffer may continue in the next chunk, so it is scanned again
+once more text is read.
+*/
+std::size_t
+WKTStreamReader::scanGeometryEnd()
+{
+    const std::size_t size = buffer.size();
+    while (scanPos < size) {
+        char c = buffer[scanPos];
+        if (isWordChar(c)) {
+            std::size_t wordStart = scanPos;
+            std::size_t wordEnd = wordStart;
+            while (wordEnd < size && isWordChar(buffer[wordEnd])) {
+                wordEnd++;
+            }
+            if (wordEnd == size) {
+                return std::string::npos;
+            }
+            scanPos = wordEnd;
+            if (depth == 0 && isEmptyWord(buffer, wordStart, wordEnd)) {
+                return wordEnd;
+            }
+            continue;
+        }
+
+        scanPos++;
+        if (c == '(') {
+            depth++;
+        }
+        else if (c == ')' && --depth <= 0) {
+            return scanPos;
+        }
+    }
+    return std::string::npos;
+}
 
 /*
 Return: nullptr if at EOF
@@ -45,27 +131,21 @@ Return: nullptr if at EOF
 std::unique_ptr<Geometry>
 WKTStreamReader::next()
 {
-    std::string wkt = "";
-
-    std::string::difference_type lParen = 0;
-    std::string::difference_type rParen = 0;
-    do {
-        std::string line;
-        std::getline(instr, line);
-        if (! instr) {
-            return nullptr;
+    // Read chunks until the buffer holds the whole next geometry.
+    // At the end of the stream the parser reports what remains.
+    while (scanGeometryEnd() == std::string::npos) {
+        if (!readChunk()) {
+            break;
         }
+    }
 
-        lParen += std::count(line.begin(), line.end(), '(');
-        rParen += std::count(line.begin(), line.end(), ')');
+    auto geom = rdr.readNext(buffer, pos);
 
-        wkt += line;
-    } while (lParen == 0 || lParen != rParen);
-
-    auto g = rdr.read( wkt.c_str() );
-    return g;
+    //-- the next geometry is scanned from where this one ended
+    scanPos = pos;
+    depth = 0;
+    return geom;
 }
 
-
 }
 }
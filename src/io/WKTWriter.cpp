@@ -401,18 +401,34 @@ WKTWriter::appendCoordinate(const CoordinateXYZM& coordinate,
                             OrdinateSet outputOrdinates,
                             Writer& writer) const
 {
-    writer.write(writeNumber(coordinate.x));
-    writer.write(" ");
-    writer.write(writeNumber(coordinate.y));
+    appendNumber(coordinate.x, writer);
+    writer.write(' ');
+    appendNumber(coordinate.y, writer);
 
     if(outputOrdinates.hasZ()) {
-        writer.write(" ");
-        writer.write(writeNumber(coordinate.z));
+        writer.write(' ');
+        appendNumber(coordinate.z, writer);
     }
 
     if(outputOrdinates.hasM()) {
-        writer.write(" ");
-        writer.write(writeNumber(coordinate.m));
+        writer.write(' ');
+        appendNumber(coordinate.m, writer);
+    }
+}
+
+/* protected */
+void
+WKTWriter::appendNumber(double d, Writer& writer) const
+{
+    if (trim) {
+        // format directly into a stack buffer, skipping the string
+        uint32_t precision = decimalPlaces >= 0 ? static_cast<std::uint32_t>(decimalPlaces) : 0;
+        char buf[28];
+        int len = writeTrimmedNumber(d, precision, buf);
+        writer.write(buf, static_cast<std::size_t>(len));
+    }
+    else {
+        writer.write(writeNumber(d));
     }
 }
 
@@ -39,6 +39,30 @@ Writer::write(const std::string& txt)
     str.append(txt);
 }
 
+void
+Writer::write(const char* txt)
+{
+    str.append(txt);
+}
+
+void
+Writer::write(const char* txt, std::size_t len)
+{
+    str.append(txt, len);
+}
+
+void
+Writer::write(char c)
+{
+    str.push_back(c);
+}
+
+void
+Writer::clear()
+{
+    str.clear();
+}
+
 const std::string&
 Writer::toString()
 {
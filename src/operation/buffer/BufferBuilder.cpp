@@ -29,12 +29,9 @@
 #include <geos/operation/buffer/BufferBuilder.h>
 #include <geos/operation/buffer/OffsetCurveBuilder.h>
 #include <geos/operation/buffer/BufferCurveSetBuilder.h>
-#include <geos/operation/buffer/BufferSubgraph.h>
-#include <geos/operation/buffer/SubgraphDepthLocater.h>
+#include <geos/operation/buffer/BufferGraph.h>
 #include <geos/operation/overlayng/OverlayNG.h>
 #include <geos/operation/overlay/snap/SnapOverlayOp.h>
-#include <geos/operation/buffer/PolygonBuilder.h>
-#include <geos/operation/buffer/BufferNodeFactory.h>
 #include <geos/operation/polygonize/Polygonizer.h>
 #include <geos/operation/union/UnaryUnionOp.h>
 #include <geos/operation/valid/RepeatedPointRemover.h>
@@ -45,10 +42,7 @@
 #include <geos/noding/MCIndexNoder.h>
 #include <geos/noding/NodedSegmentString.h>
 #include <geos/geom/Position.h>
-#include <geos/geomgraph/PlanarGraph.h>
 #include <geos/geomgraph/Label.h>
-#include <geos/geomgraph/Node.h>
-#include <geos/geomgraph/Edge.h>
 #include <geos/util/GEOSException.h>
 #include <geos/io/WKTWriter.h> // for debugging
 #include <geos/util/IllegalArgumentException.h>
@@ -415,6 +409,8 @@ BufferBuilder::buffer(const Geometry* g, double distance)
     // factory must be the same as the one used by the input
     geomFact = g->getFactory();
 
+    BufferGraph graph;
+
     {
         // This scope is here to force release of resources owned by
         // BufferCurveSetBuilder when we're doing with it
@@ -438,92 +434,45 @@ BufferBuilder::buffer(const Geometry* g, double distance)
         std::cerr << "BufferBuilder::buffer computing NodedEdges" << std::endl;
 #endif
 
-        computeNodedEdges(bufferSegStrList, precisionModel);
+        computeNodedEdges(bufferSegStrList, precisionModel, graph);
 
         GEOS_CHECK_FOR_INTERRUPTS();
 
     } // bufferSegStrList and contents are released here
 
-#if GEOS_DEBUG > 1
-    std::cerr << std::endl << edgeList << std::endl;
-#endif
-
-    std::unique_ptr<Geometry> resultGeom(nullptr);
     std::vector<std::unique_ptr<Geometry>> resultPolyList;
-    std::vector<BufferSubgraph*> subgraphList;
-
-    try {
-        PlanarGraph graph(BufferNodeFactory::instance());
-        graph.addEdges(edgeList.getEdges());
-
-        GEOS_CHECK_FOR_INTERRUPTS();
-
-        createSubgraphs(&graph, subgraphList);
-
-#if GEOS_DEBUG
-        std::cerr << "Created " << subgraphList.size() << " subgraphs" << std::endl;
-#if GEOS_DEBUG > 1
-        for(std::size_t i = 0, n = subgraphList.size(); i < n; i++) {
-            std::cerr << std::setprecision(10) << *(subgraphList[i]) << std::endl;
-        }
-#endif
-#endif
-
-        GEOS_CHECK_FOR_INTERRUPTS();
-
-        {
-            // scope for earlier PolygonBuilder cleanup
-            PolygonBuilder polyBuilder(geomFact);
-            buildSubgraphs(subgraphList, polyBuilder);
-
-            resultPolyList = polyBuilder.getPolygons();
-        }
-
-        // Get rid of the subgraphs, shouldn't be needed anymore
-        for(std::size_t i = 0, n = subgraphList.size(); i < n; i++) {
-            delete subgraphList[i];
-        }
-        subgraphList.clear();
+    for (auto& poly : graph.getPolygons(geomFact)) {
+        resultPolyList.push_back(std::move(poly));
+    }
 
 #if GEOS_DEBUG
-        std::cerr << "PolygonBuilder got " << resultPolyList.size()
-                  << " polygons" << std::endl;
+    std::cerr << "PolygonBuilder got " << resultPolyList.size()
+              << " polygons" << std::endl;
 #if GEOS_DEBUG > 1
-        for(std::size_t i = 0, n = resultPolyList.size(); i < n; i++) {
-            std::cerr << resultPolyList[i]->toString() << std::endl;
-        }
+    for(std::size_t i = 0, n = resultPolyList.size(); i < n; i++) {
+        std::cerr << resultPolyList[i]->toString() << std::endl;
+    }
 #endif
 #endif
 
-        // just in case ...
-        if(resultPolyList.empty()) {
-            return createEmptyResultGeometry();
-        }
-
-        //  Heuristic to remove artifacts caused by topology robustness problems
-        //  or buffer curve generation anomalies.
-        //  Uses fact that for distance > 0 single-element inputs must create single element buffers.
-        //  This does not hold if distance <= 0;
-        //  distance = 0 can create multipolygon results due to topology collapse,
-        //  and distance < 0 may erode polygons so they are disconnected.
-        if (distance > 0 && g->getNumGeometries() == 1 && resultPolyList.size() > 1) {
-            keepLargestArea(resultPolyList);
-        }
-
-        // resultPolyList ownership transferred here
-        resultGeom = geomFact->buildGeometry(std::move(resultPolyList));
+    // just in case ...
+    if(resultPolyList.empty()) {
+        return createEmptyResultGeometry();
     }
-    catch(const util::GEOSException& /* exc */) {
-
-        // In case they're still around
-        for(std::size_t i = 0, n = subgraphList.size(); i < n; i++) {
-            delete subgraphList[i];
-        }
-        subgraphList.clear();
 
-        throw;
+    //  Heuristic to remove artifacts caused by topology robustness problems
+    //  or buffer curve generation anomalies.
+    //  Uses fact that for distance > 0 single-element inputs must create single element buffers.
+    //  This does not hold if distance <= 0;
+    //  distance = 0 can create multipolygon results due to topology collapse,
+    //  and distance < 0 may erode polygons so they are disconnected.
+    if (distance > 0 && g->getNumGeometries() == 1 && resultPolyList.size() > 1) {
+        keepLargestArea(resultPolyList);
     }
 
+    // resultPolyList ownership transferred here
+    std::unique_ptr<Geometry> resultGeom = geomFact->buildGeometry(std::move(resultPolyList));
+
     // Cleanup single-sided buffer artifacts, if needed
     if ( bufParams.isSingleSided() )
     {
@@ -637,7 +586,8 @@ BufferBuilder::getNoder(const PrecisionModel* pm)
 /* private */
 void
 BufferBuilder::computeNodedEdges(SegmentString::NonConstVect& bufferSegStrList,
-                                 const PrecisionModel* precisionModel) // throw(GEOSException)
+                                 const PrecisionModel* precisionModel,
+                                 BufferGraph& graph) // throw(GEOSException)
 {
     Noder* noder = getNoder(precisionModel);
 
@@ -666,19 +616,15 @@ BufferBuilder::computeNodedEdges(SegmentString::NonConstVect& bufferSegStrList,
     for(auto& segStr : nodedSegStrings) {
         const Label* oldLabel = static_cast<const Label*>(segStr->getData());
 
-        auto cs = operation::valid::RepeatedPointRemover::removeRepeatedPoints(segStr->getCoordinates().get());
+        std::shared_ptr<const CoordinateSequence> cs = operation::valid::RepeatedPointRemover::removeRepeatedPoints(segStr->getCoordinates().get());
         segStr.reset();
         if(cs->size() < 2) {
             // don't insert collapsed edges
-            // we need to take care of the memory here as cs is a new sequence
             continue;
         }
 
-        // Edge takes ownership of the CoordinateSequence
-        Edge* edge = new Edge(cs.release(), *oldLabel);
-
-        // will take care of the Edge ownership
-        insertUniqueEdge(edge);
+        // coincident edges are merged by the graph
+        graph.addEdge(cs, depthDelta(*oldLabel));
     }
 
     if(noder != workingNoder) {
@@ -686,126 +632,6 @@ BufferBuilder::computeNodedEdges(SegmentString::NonConstVect& bufferSegStrList,
     }
 }
 
-/*private*/
-void
-BufferBuilder::insertUniqueEdge(Edge* e)
-{
-    //<FIX> MD 8 Oct 03  speed up identical edge lookup
-    // fast lookup
-    Edge* existingEdge = edgeList.findEqualEdge(e);
-    // If an identical edge already exists, simply update its label
-    if(existingEdge != nullptr) {
-        Label& existingLabel = existingEdge->getLabel();
-        Label labelToMerge = e->getLabel();
-
-        // check if new edge is in reverse direction to existing edge
-        // if so, must flip the label before merging it
-        if(! existingEdge->isPointwiseEqual(e)) {
-            labelToMerge = e->getLabel();
-            labelToMerge.flip();
-        }
-
-        existingLabel.merge(labelToMerge);
-
-        // compute new depth delta of sum of edges
-        int mergeDelta = depthDelta(labelToMerge);
-        int existingDelta = existingEdge->getDepthDelta();
-        int newDelta = existingDelta + mergeDelta;
-        existingEdge->setDepthDelta(newDelta);
-
-        // we have memory release responsibility
-        delete e;
-
-    }
-    else {     // no matching existing edge was found
-
-        // add this new edge to the list of edges in this graph
-        edgeList.add(e);
-
-        e->setDepthDelta(depthDelta(e->getLabel()));
-    }
-}
-
-bool
-BufferSubgraphGT(BufferSubgraph* first, BufferSubgraph* second)
-{
-    if(first->compareTo(second) > 0) {
-        return true;
-    }
-    else {
-        return false;
-    }
-}
-
-/*private*/
-void
-BufferBuilder::createSubgraphs(PlanarGraph* graph, std::vector<BufferSubgraph*>& subgraphList)
-{
-    std::vector<Node*> nodes;
-    graph->getNodes(nodes);
-    for(std::size_t i = 0, n = nodes.size(); i < n; i++) {
-        Node* node = nodes[i];
-        if(!node->isVisited()) {
-            BufferSubgraph* subgraph = new BufferSubgraph();
-            subgraph->create(node);
-            subgraphList.push_back(subgraph);
-        }
-    }
-
-    /*
-     * Sort the subgraphs in descending order of their rightmost coordinate
-     * This ensures that when the Polygons for the subgraphs are built,
-     * subgraphs for shells will have been built before the subgraphs for
-     * any holes they contain
-     */
-    std::sort(subgraphList.begin(), subgraphList.end(), BufferSubgraphGT);
-}
-
-/*private*/
-void
-BufferBuilder::buildSubgraphs(const std::vector<BufferSubgraph*>& subgraphList,
-                              PolygonBuilder& polyBuilder)
-{
-
-#if GEOS_DEBUG
-    std::cerr << __FUNCTION__ << " got " << subgraphList.size() << " subgraphs" << std::endl;
-#endif
-    std::vector<BufferSubgraph*> processedGraphs;
-    for(std::size_t i = 0, n = subgraphList.size(); i < n; i++) {
-        BufferSubgraph* subgraph = subgraphList[i];
-        Coordinate* p = subgraph->getRightmostCoordinate();
-        assert(p);
-
-#if GEOS_DEBUG
-        std::cerr << " " << i << ") Subgraph[" << subgraph << "]" << std::endl;
-        std::cerr << "  rightmost Coordinate " << *p;
-#endif
-        SubgraphDepthLocater locater(&processedGraphs);
-#if GEOS_DEBUG
-        std::cerr << " after SubgraphDepthLocater processedGraphs contain "
-                  << processedGraphs.size()
-                  << " elements" << std::endl;
-#endif
-        int outsideDepth = locater.getDepth(*p);
-#if GEOS_DEBUG
-        std::cerr << " Depth of rightmost coordinate: " << outsideDepth << std::endl;
-#endif
-        subgraph->computeDepth(outsideDepth);
-        subgraph->findResultEdges();
-#if GEOS_DEBUG
-        std::cerr << " after computeDepth and findResultEdges subgraph contain:" << std::endl
-                  << "   " << subgraph->getDirectedEdges()->size() << " DirecteEdges " << std::endl
-                  << "   " << subgraph->getNodes()->size() << " Nodes " << std::endl;
-#endif
-        processedGraphs.push_back(subgraph);
-#if GEOS_DEBUG
-        std::cerr << " added " << subgraph << " to processedGraphs, new size is "
-                  << processedGraphs.size() << std::endl;
-#endif
-        polyBuilder.add(subgraph->getDirectedEdges(), subgraph->getNodes());
-    }
-}
-
 /*private*/
 std::unique_ptr<geom::Geometry>
 BufferBuilder::createEmptyResultGeometry() const
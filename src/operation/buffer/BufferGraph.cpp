@@ -0,0 +1,587 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/buffer/BufferGraph.h>
+#include <geos/algorithm/Orientation.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/geom/Position.h>
+#include <geos/geom/Quadrant.h>
+#include <geos/geom/Surface.h>
+#include <geos/operation/overlayng/EdgeMerger.h>
+#include <geos/operation/overlayng/EdgeSourceInfo.h>
+#include <geos/operation/overlayng/OverlayEdge.h>
+#include <geos/operation/overlayng/OverlayGraph.h>
+#include <geos/operation/overlayng/PolygonBuilder.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/TopologyException.h>
+
+#include <algorithm>
+#include <cassert>
+
+using geos::algorithm::Orientation;
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Envelope;
+using geos::geom::LineSegment;
+using geos::geom::Position;
+using geos::geom::Quadrant;
+using geos::operation::overlayng::OverlayEdge;
+
+namespace geos {
+namespace operation { // geos.operation
+namespace buffer { // geos.operation.buffer
+
+namespace {
+
+/*
+ * A segment from a forward edge which has been assigned a depth value
+ * for its sides.
+ */
+class DepthSegment {
+private:
+
+    LineSegment upwardSeg;
+
+    /*
+     * Compares a point to a segment for left/right position,
+     * as long as the point lies within the segment Y extent.
+     * Otherwise the point is not comparable.
+     * If the point is not comparable or it lies on the segment
+     * returns 0.
+     */
+    static int
+    comparePointInYExtent(const geom::Coordinate& p, const LineSegment& seg)
+    {
+        //-- if point is comparable to segment
+        if (p.y >= seg.minY() && p.y <= seg.maxY()) {
+            //-- flip sign, since orientation and order relation are opposite
+            int orient = seg.orientationIndex(p);
+            switch (orient) {
+            case Orientation::LEFT: return -1;
+            case Orientation::RIGHT: return 1;
+            }
+            //-- collinear, so indeterminate
+        }
+        //-- not computable
+        return 0;
+    }
+
+public:
+
+    int leftDepth;
+
+    /// @param seg the segment, pointing upwards
+    DepthSegment(const LineSegment& seg, int depth)
+        : upwardSeg(seg)
+        , leftDepth(depth)
+    {}
+
+    /*
+     * A comparison operation which orders segments left to right
+     * along some horizontal line.
+     * If segments don't touch the same line,
+     * or touch at the same point,
+     * they are compared in their Y extent.
+     *
+     * DS1 < DS2   if   DS1.seg is left of DS2.seg
+     * DS1 > DS2   if   DS1.seg is right of DS2.seg
+     */
+    int
+    compareTo(const DepthSegment& other) const
+    {
+        // If segments are disjoint in X, X values provides ordering.
+        // This is the most common case.
+        if (upwardSeg.minX() > other.upwardSeg.maxX())
+            return 1;
+        if (upwardSeg.maxX() < other.upwardSeg.minX())
+            return -1;
+
+        // The segments Y ranges should intersect since they lie on same stabbing line.
+        // But check for this and provide a result based on Y ordering
+        if (upwardSeg.minY() > other.upwardSeg.maxY())
+            return 1;
+        if (upwardSeg.maxY() < other.upwardSeg.minY())
+            return -1;
+
+        // Check if some segment point is left or right
+        // of the other segment in its Y extent.
+        int comp00 = comparePointInYExtent(upwardSeg.p0, other.upwardSeg);
+        if (comp00 != 0) return comp00;
+        int comp01 = comparePointInYExtent(upwardSeg.p1, other.upwardSeg);
+        if (comp01 != 0) return comp01;
+        //-- negate orientation for other/this checks
+        int comp10 = -comparePointInYExtent(other.upwardSeg.p0, upwardSeg);
+        if (comp10 != 0) return comp10;
+        int comp11 = -comparePointInYExtent(other.upwardSeg.p1, upwardSeg);
+        if (comp11 != 0) return comp11;
+
+        // If point checks in Y range are indeterminate,
+        // segments touch at a point
+        // and lie above and below that point, or are horizontal.
+        // Order according to their Y values.
+        // (The ordering in this case doesn't matter, it just has to be consistent)
+        if (upwardSeg.maxY() > other.upwardSeg.maxY())
+            return 1;
+        if (upwardSeg.maxY() < other.upwardSeg.maxY())
+            return -1;
+
+        // If both are horizontal order by X
+        if (upwardSeg.isHorizontal() && other.upwardSeg.isHorizontal()) {
+            if (upwardSeg.minX() < other.upwardSeg.minX())
+                return -1;
+            if (upwardSeg.minX() > other.upwardSeg.minX())
+                return 1;
+        }
+
+        // assert: segments are equal
+        return 0;
+    }
+};
+
+/*
+ * Records the segments of a forward edge
+ * which are crossed by a ray running right from the given point,
+ * given the depths to the right and left of the edge.
+ */
+void
+findStabbedSegments(const CoordinateXY& stabbingRayLeftPt, const OverlayEdge* de,
+                    int rightDepth, int leftDepth,
+                    std::vector<DepthSegment>& stabbedSegments)
+{
+    const CoordinateSequence* pts = de->getCoordinatesRO();
+    for (std::size_t i = 0, n = pts->size() - 1; i < n; i++) {
+        const CoordinateXY* low = &pts->getAt<CoordinateXY>(i);
+        const CoordinateXY* high = &pts->getAt<CoordinateXY>(i + 1);
+        // ensure segment always points upwards
+        bool isFlipped = false;
+        if (low->y > high->y) {
+            std::swap(low, high);
+            isFlipped = true;
+        }
+
+        // skip segment if it is left of the stabbing line
+        if (std::max(low->x, high->x) < stabbingRayLeftPt.x) {
+            continue;
+        }
+        // skip horizontal segments (there will be a non-horizontal
+        // one carrying the same depth info)
+        if (low->y == high->y) {
+            continue;
+        }
+        // skip if segment is above or below stabbing line
+        if (stabbingRayLeftPt.y < low->y || stabbingRayLeftPt.y > high->y) {
+            continue;
+        }
+        // skip if stabbing ray is right of the segment
+        if (Orientation::index(*low, *high, stabbingRayLeftPt) == Orientation::RIGHT) {
+            continue;
+        }
+
+        // stabbing line cuts this segment, so record it.
+        // if segment direction was flipped, use RHS depth instead
+        int depth = isFlipped ? rightDepth : leftDepth;
+        stabbedSegments.emplace_back(LineSegment(low->x, low->y, high->x, high->y), depth);
+    }
+}
+
+/*
+ * Finds the rightmost edge of the star around a node, as the first or
+ * last edge in angular order starting from the positive X axis.
+ */
+OverlayEdge*
+getRightmostEdgeAtNode(OverlayEdge* nodeEdge)
+{
+    OverlayEdge* de0 = nodeEdge;
+    OverlayEdge* deLast = nodeEdge;
+    for (OverlayEdge* e = nodeEdge->oNextOE(); e != nodeEdge; e = e->oNextOE()) {
+        if (e->compareTo(de0) < 0) {
+            de0 = e;
+        }
+        if (e->compareTo(deLast) > 0) {
+            deLast = e;
+        }
+    }
+    if (de0 == deLast) {
+        return de0;
+    }
+
+    int quad0 = Quadrant::quadrant(de0->directionX(), de0->directionY());
+    int quad1 = Quadrant::quadrant(deLast->directionX(), deLast->directionY());
+    if (Quadrant::isNorthern(quad0) && Quadrant::isNorthern(quad1)) {
+        return de0;
+    }
+    if (!Quadrant::isNorthern(quad0) && !Quadrant::isNorthern(quad1)) {
+        return deLast;
+    }
+    // edges are in different hemispheres - make sure we return one that is non-horizontal
+    if (de0->directionY() != 0) {
+        return de0;
+    }
+    if (deLast->directionY() != 0) {
+        return deLast;
+    }
+    throw util::TopologyException("found two horizontal edges incident on node", nodeEdge->orig());
+}
+
+/*
+ * Finds the rightmost vertex of the forward edges,
+ * only checking vertices which are the start point of a segment.
+ */
+void
+checkForRightmostCoordinate(OverlayEdge* de, OverlayEdge*& minDe,
+                            std::size_t& minIndex, CoordinateXY& minCoord)
+{
+    const CoordinateSequence* pts = de->getCoordinatesRO();
+    for (std::size_t i = 0, n = pts->size() - 1; i < n; i++) {
+        const CoordinateXY& p = pts->getAt<CoordinateXY>(i);
+        if (minCoord.isNull() || p.x > minCoord.x) {
+            minDe = de;
+            minIndex = i;
+            minCoord = p;
+        }
+    }
+}
+
+/*
+ * Returns the side of a segment of a forward edge which faces right,
+ * or -1 if the segment does not exist or is horizontal.
+ */
+int
+getRightmostSideOfSegment(const OverlayEdge* de, std::size_t i)
+{
+    const CoordinateSequence* pts = de->getCoordinatesRO();
+    if (i + 1 >= pts->size()) {
+        return -1;
+    }
+    const CoordinateXY& p0 = pts->getAt<CoordinateXY>(i);
+    const CoordinateXY& p1 = pts->getAt<CoordinateXY>(i + 1);
+    // indicates edge is parallel to x-axis
+    if (p0.y == p1.y) {
+        return -1;
+    }
+    return p0.y < p1.y ? Position::RIGHT : Position::LEFT;
+}
+
+} // anonymous namespace
+
+/*public*/
+void
+BufferGraph::addEdge(const std::shared_ptr<const CoordinateSequence>& pts, int depthDelta)
+{
+    // the Edge copies the source info, so it need not outlive this call
+    overlayng::EdgeSourceInfo info(0, depthDelta, false);
+    edgeQue.emplace_back(pts, &info, false);
+}
+
+/*public*/
+std::vector<std::unique_ptr<geom::Surface>>
+BufferGraph::getPolygons(const geom::GeometryFactory* geomFact)
+{
+    std::vector<overlayng::Edge*> edges;
+    edges.reserve(edgeQue.size());
+    for (overlayng::Edge& e : edgeQue) {
+        edges.push_back(&e);
+    }
+    // the depth deltas of coincident edges are summed
+    std::vector<overlayng::Edge*> mergedEdges = overlayng::EdgeMerger::merge(edges);
+
+    overlayng::OverlayGraph graph(mergedEdges.size());
+    edgeDepths.clear();
+    edgeDepths.reserve(2 * mergedEdges.size());
+    for (overlayng::Edge* e : mergedEdges) {
+        int depthDelta = e->getDepthDelta(0);
+        OverlayEdge* oe = graph.addEdge(e);
+        edgeDepths[oe].depthDelta = depthDelta;
+        edgeDepths[oe->symOE()].depthDelta = -depthDelta;
+    }
+
+    GEOS_CHECK_FOR_INTERRUPTS();
+
+    std::vector<Subgraph> subgraphs = createSubgraphs(graph.getEdges());
+    std::stable_sort(subgraphs.begin(), subgraphs.end(),
+        [](const Subgraph& a, const Subgraph& b) {
+            return a.rightmostCoord.x > b.rightmostCoord.x;
+        });
+
+    std::vector<const Subgraph*> processed;
+    std::vector<OverlayEdge*> resultAreaEdges;
+    for (const Subgraph& subgraph : subgraphs) {
+        int outsideDepth = getOutsideDepth(subgraph.rightmostCoord, processed);
+        computeDepths(subgraph.rightmostEdge, outsideDepth);
+        markResultAreaEdges(subgraph, resultAreaEdges);
+        processed.push_back(&subgraph);
+
+        GEOS_CHECK_FOR_INTERRUPTS();
+    }
+
+    overlayng::PolygonBuilder polyBuilder(resultAreaEdges, geomFact);
+    return polyBuilder.getPolygons();
+}
+
+/*private static*/
+std::vector<BufferGraph::Subgraph>
+BufferGraph::createSubgraphs(const std::vector<OverlayEdge*>& graphEdges)
+{
+    std::vector<Subgraph> subgraphs;
+    std::vector<OverlayEdge*> stack;
+    for (OverlayEdge* startEdge : graphEdges) {
+        if (startEdge->isVisited()) {
+            continue;
+        }
+        subgraphs.emplace_back();
+        Subgraph& subgraph = subgraphs.back();
+
+        stack.push_back(startEdge);
+        while (!stack.empty()) {
+            OverlayEdge* e = stack.back();
+            stack.pop_back();
+            if (e->isVisited()) {
+                continue;
+            }
+            e->markVisitedBoth();
+
+            OverlayEdge* fwd = e->isForward() ? e : e->symOE();
+            Envelope env = fwd->getCoordinatesRO()->getEnvelope();
+            subgraph.edges.push_back(fwd);
+            subgraph.edgeEnvs.push_back(env);
+            subgraph.env.expandToInclude(env);
+
+            // the edges around both end nodes
+            stack.push_back(e->oNextOE());
+            stack.push_back(e->symOE()->oNextOE());
+        }
+        findRightmostEdge(subgraph);
+    }
+    return subgraphs;
+}
+
+/*private static*/
+void
+BufferGraph::findRightmostEdge(Subgraph& subgraph)
+{
+    OverlayEdge* minDe = nullptr;
+    std::size_t minIndex = 0;
+    CoordinateXY minCoord;
+    minCoord.setNull();
+
+    // checking forward edges only is still general,
+    // because each edge has a forward half-edge
+    for (OverlayEdge* de : subgraph.edges) {
+        checkForRightmostCoordinate(de, minDe, minIndex, minCoord);
+    }
+    if (minDe == nullptr) {
+        throw util::TopologyException("No forward edges found in buffer subgraph");
+    }
+
+    if (minIndex == 0) {
+        // the rightmost point is a node, so find which
+        // of the incident edges is rightmost
+        minDe = getRightmostEdgeAtNode(minDe);
+        if (!minDe->isForward()) {
+            minDe = minDe->symOE();
+            minIndex = minDe->getCoordinatesRO()->size() - 1;
+        }
+    }
+    else {
+        // The rightmost point is an interior vertex, so it has
+        // a segment on either side of it.
+        // If these segments are both above or below the rightmost
+        // point, we need to determine their relative orientation
+        // to decide which is rightmost.
+        const CoordinateSequence* pts = minDe->getCoordinatesRO();
+        const CoordinateXY& pPrev = pts->getAt<CoordinateXY>(minIndex - 1);
+        const CoordinateXY& pNext = pts->getAt<CoordinateXY>(minIndex + 1);
+        int orientation = Orientation::index(minCoord, pNext, pPrev);
+        bool usePrev = false;
+        // both segments are below min point
+        if (pPrev.y < minCoord.y && pNext.y < minCoord.y
+                && orientation == Orientation::COUNTERCLOCKWISE) {
+            usePrev = true;
+        }
+        else if (pPrev.y > minCoord.y && pNext.y > minCoord.y
+                 && orientation == Orientation::CLOCKWISE) {
+            usePrev = true;
+        }
+        // if both segments are on the same side, do nothing - either is safe
+        // to select as a rightmost segment
+        if (usePrev) {
+            minIndex = minIndex - 1;
+        }
+    }
+
+    // check that the extreme side is the right side,
+    // if not use the sym instead
+    OverlayEdge* orientedDe = minDe;
+    int rightmostSide = getRightmostSideOfSegment(minDe, minIndex);
+    if (rightmostSide < 0 && minIndex > 0) {
+        rightmostSide = getRightmostSideOfSegment(minDe, minIndex - 1);
+    }
+    if (rightmostSide < 0) {
+        // reaching here can indicate that segment is horizontal
+        minCoord.setNull();
+        checkForRightmostCoordinate(minDe, minDe, minIndex, minCoord);
+    }
+    if (rightmostSide == Position::LEFT) {
+        orientedDe = minDe->symOE();
+    }
+
+    subgraph.rightmostEdge = orientedDe;
+    subgraph.rightmostCoord = minCoord;
+}
+
+/*private*/
+BufferGraph::EdgeDepth&
+BufferGraph::getEdgeDepth(const OverlayEdge* e)
+{
+    auto it = edgeDepths.find(e);
+    assert(it != edgeDepths.end());
+    return it->second;
+}
+
+/*private*/
+int
+BufferGraph::getOutsideDepth(const CoordinateXY& p, const std::vector<const Subgraph*>& processed)
+{
+    std::vector<DepthSegment> stabbedSegments;
+    for (const Subgraph* subgraph : processed) {
+        // don't bother checking subgraphs which the ray does not intersect
+        const Envelope& env = subgraph->env;
+        if (p.y < env.getMinY() || p.y > env.getMaxY() || p.x > env.getMaxX()) {
+            continue;
+        }
+        for (std::size_t i = 0; i < subgraph->edges.size(); i++) {
+            const Envelope& edgeEnv = subgraph->edgeEnvs[i];
+            if (p.y < edgeEnv.getMinY() || p.y > edgeEnv.getMaxY() || p.x > edgeEnv.getMaxX()) {
+                continue;
+            }
+            const OverlayEdge* de = subgraph->edges[i];
+            findStabbedSegments(p, de, getDepth(de), getDepth(de->symOE()), stabbedSegments);
+        }
+    }
+
+    // if no segments on stabbing line subgraph must be outside all others
+    if (stabbedSegments.empty()) {
+        return 0;
+    }
+    auto it = std::min_element(stabbedSegments.begin(), stabbedSegments.end(),
+        [](const DepthSegment& a, const DepthSegment& b) {
+            return a.compareTo(b) < 0;
+        });
+    return it->leftDepth;
+}
+
+/*private*/
+void
+BufferGraph::computeDepths(OverlayEdge* startEdge, int outsideDepth)
+{
+    // the right side of the rightmost edge is on the outside
+    setEdgeDepths(startEdge, outsideDepth);
+
+    // Visit the nodes breadth-first, so that each node is reached
+    // from one whose depths are known. A node may be queued more
+    // than once before it is visited.
+    std::deque<OverlayEdge*> nodeQueue;
+    nodeQueue.push_back(startEdge);
+    while (!nodeQueue.empty()) {
+        OverlayEdge* nodeEdge = nodeQueue.front();
+        nodeQueue.pop_front();
+        if (getEdgeDepth(nodeEdge).isVisited) {
+            continue;
+        }
+        computeNodeDepth(nodeEdge);
+
+        OverlayEdge* e = nodeEdge;
+        do {
+            OverlayEdge* sym = e->symOE();
+            if (!getEdgeDepth(sym).isVisited) {
+                nodeQueue.push_back(sym);
+            }
+            e = e->oNextOE();
+        } while (e != nodeEdge);
+    }
+}
+
+/*private*/
+void
+BufferGraph::computeNodeDepth(OverlayEdge* nodeEdge)
+{
+    OverlayEdge* startEdge = nullptr;
+    OverlayEdge* e = nodeEdge;
+    do {
+        if (getDepth(e) != NO_DEPTH) {
+            startEdge = e;
+            break;
+        }
+        e = e->oNextOE();
+    } while (e != nodeEdge);
+
+    if (startEdge == nullptr) {
+        throw util::TopologyException("unable to find edge to compute depths at", nodeEdge->orig());
+    }
+
+    // the depth to the left of an edge is the depth
+    // to the right of the next edge CCW around the node
+    int currDepth = getDepth(startEdge->symOE());
+    for (e = startEdge->oNextOE(); e != startEdge; e = e->oNextOE()) {
+        setEdgeDepths(e, currDepth);
+        currDepth = getDepth(e->symOE());
+    }
+    if (currDepth != getDepth(startEdge)) {
+        throw util::TopologyException("depth mismatch at ", startEdge->orig());
+    }
+
+    e = nodeEdge;
+    do {
+        getEdgeDepth(e).isVisited = true;
+        e = e->oNextOE();
+    } while (e != nodeEdge);
+}
+
+/*private*/
+void
+BufferGraph::setEdgeDepths(OverlayEdge* e, int depth)
+{
+    setDepth(e, depth);
+    setDepth(e->symOE(), depth + getEdgeDepth(e).depthDelta);
+}
+
+/*private*/
+void
+BufferGraph::setDepth(const OverlayEdge* e, int depth)
+{
+    EdgeDepth& ed = getEdgeDepth(e);
+    if (ed.depth != NO_DEPTH && ed.depth != depth) {
+        throw util::TopologyException("assigned depths do not match", e->orig());
+    }
+    ed.depth = depth;
+}
+
+/*private*/
+void
+BufferGraph::markResultAreaEdges(const Subgraph& subgraph, std::vector<OverlayEdge*>& resultAreaEdges)
+{
+    for (OverlayEdge* fwd : subgraph.edges) {
+        for (OverlayEdge* e : { fwd, fwd->symOE() }) {
+            if (getDepth(e) >= 1 && getDepth(e->symOE()) <= 0) {
+                e->markInResultArea();
+                resultAreaEdges.push_back(e);
+            }
+        }
+    }
+}
+
+} // namespace geos.operation.buffer
+} // namespace geos.operation
+} // namespace geos
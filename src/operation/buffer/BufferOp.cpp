@@ -40,6 +40,7 @@
 #include <geos/algorithm/LineIntersector.h>
 #include <geos/noding/MCIndexNoder.h>
 #include <geos/noding/IntersectionAdder.h>
+#include <geos/util/TaskPool.h>
 
 
 
@@ -107,6 +108,34 @@ BufferOp::bufferOp(const geom::Geometry* g, double dist,
 }
 
 
+/*public static*/
+std::vector<std::unique_ptr<Geometry>>
+BufferOp::bufferBatch(const Geometry* const* geoms, std::size_t n,
+                      double dist, const BufferParameters& bufParms,
+                      geos::util::TaskPool* pool)
+{
+    std::vector<std::unique_ptr<Geometry>> results(n);
+
+    auto bufferRange = [&](BufferBuilder& builder, std::size_t start, std::size_t end) {
+        for (std::size_t i = start; i < end; i++) {
+            BufferOp bufOp(geoms[i], bufParms);
+            bufOp.reusableBuilder = &builder;
+            results[i] = bufOp.getResultGeometry(dist);
+        }
+    };
+
+    // number of consecutive inputs buffered by a task, sharing a builder
+    const std::size_t grainSize = 16;
+    const std::size_t numChunks = (n + grainSize - 1) / grainSize;
+
+    geos::util::parallelFor(pool, numChunks, [&](std::size_t c) {
+        BufferBuilder builder(bufParms);
+        bufferRange(builder, c * grainSize, std::min(n, (c + 1) * grainSize));
+    });
+
+    return results;
+}
+
 /*public*/
 std::unique_ptr<Geometry>
 BufferOp::getResultGeometry(double nDistance)
@@ -181,11 +210,16 @@ BufferOp::bufferReducedPrecision()
 void
 BufferOp::bufferOriginalPrecision()
 {
-    BufferBuilder bufBuilder(bufParams);
-    bufBuilder.setInvertOrientation(isInvertOrientation);
+    std::unique_ptr<BufferBuilder> ownBuilder;
+    BufferBuilder* bufBuilder = reusableBuilder;
+    if (bufBuilder == nullptr) {
+        ownBuilder.reset(new BufferBuilder(bufParams));
+        bufBuilder = ownBuilder.get();
+    }
+    bufBuilder->setInvertOrientation(isInvertOrientation);
 
     try {
-        resultGeometry = bufBuilder.buffer(argGeom, distance);
+        resultGeometry = bufBuilder->buffer(argGeom, distance);
     }
     catch(const util::TopologyException& ex) {
         // don't propagate the exception - it will be detected by
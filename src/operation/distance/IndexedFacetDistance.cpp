@@ -105,6 +105,46 @@ IndexedFacetDistance::isWithinDistance(const Geometry* g, double maxDistance) co
     return cachedTree->isWithinDistance<FacetDistance>(*tree2, maxDistance);
 }
 
+double
+IndexedFacetDistance::distance(const CoordinateXY& pt) const
+{
+    CoordinateSequence seq(1u, false, false);
+    seq.setAt(pt, 0);
+    FacetSequence fs(&seq, 0, 1);
+
+    FacetDistance fd;
+    auto nearest = cachedTree->nearestNeighbour(*fs.getEnvelope(), &fs, fd);
+    if (!nearest) {
+        throw util::GEOSException("Cannot calculate IndexedFacetDistance on empty geometries.");
+    }
+    return nearest->distance(fs);
+}
+
+bool
+IndexedFacetDistance::isWithinDistance(const CoordinateXY& pt, double maxDistance) const
+{
+    CoordinateSequence seq(1u, false, false);
+    seq.setAt(pt, 0);
+    FacetSequence fs(&seq, 0, 1);
+
+    FacetDistance fd;
+    return cachedTree->isWithinDistance(*fs.getEnvelope(), &fs, maxDistance, fd);
+}
+
+CoordinateXY
+IndexedFacetDistance::nearestPoint(const CoordinateXY& pt) const
+{
+    CoordinateSequence seq(1u, false, false);
+    seq.setAt(pt, 0);
+    FacetSequence fs(&seq, 0, 1);
+
+    FacetDistance fd;
+    auto nearest = cachedTree->nearestNeighbour(*fs.getEnvelope(), &fs, fd);
+    if (!nearest) {
+        throw util::GEOSException("Cannot calculate IndexedFacetDistance on empty geometries.");
+    }
+    return nearest->nearestLocations(fs)[0];
+}
 
 }
 }
@@ -0,0 +1,94 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/constants.h>
+#include <geos/geom/Geometry.h>
+#include <geos/operation/distance/FacetSequenceTreeBuilder.h>
+#include <geos/operation/distance/MultiIndexedFacetDistance.h>
+#include <geos/util.h>
+
+using namespace geos::geom;
+using namespace geos::index::strtree;
+
+namespace geos {
+namespace operation {
+namespace distance {
+
+MultiIndexedFacetDistance::MultiIndexedFacetDistance(const std::vector<const Geometry*>& geoms)
+    : numGeoms(geoms.size())
+{
+    for (std::size_t i = 0; i < geoms.size(); i++) {
+        util::ensureNoCurvedComponents(geoms[i]);
+
+        auto geomFacets = FacetSequenceTreeBuilder::computeFacetSequences(geoms[i]);
+        for (auto& fs : geomFacets) {
+            facets.push_back(fs);
+            facetGeom.push_back(i);
+        }
+    }
+
+    // facets must not be moved after their addresses are inserted
+    tree = detail::make_unique<TemplateSTRtree<const FacetSequence*>>(
+               FacetSequenceTreeBuilder::STR_TREE_NODE_CAPACITY, facets.size());
+    for (auto& fs : facets) {
+        tree->insert(fs.getEnvelope(), &fs);
+    }
+    tree->build();
+}
+
+std::vector<MultiIndexedFacetDistance::Neighbour>
+MultiIndexedFacetDistance::nearest(const Geometry* g, std::size_t k) const
+{
+    return query(g, k, DoubleInfinity);
+}
+
+std::vector<MultiIndexedFacetDistance::Neighbour>
+MultiIndexedFacetDistance::withinDistance(const Geometry* g, double maxDistance) const
+{
+    return query(g, numGeoms, maxDistance);
+}
+
+std::vector<MultiIndexedFacetDistance::Neighbour>
+MultiIndexedFacetDistance::query(const Geometry* g, std::size_t k, double maxDistance) const
+{
+    std::vector<Neighbour> result;
+    if (k == 0 || maxDistance < 0) {
+        return result;
+    }
+
+    auto queryTree = FacetSequenceTreeBuilder::build(g);
+    std::vector<bool> isFound(numGeoms, false);
+
+    /*
+     * Facet pairs are visited in order of increasing distance,
+     * so the first pair found for a geometry is its nearest.
+     */
+    FacetDistance facetDist;
+    tree->visitPairsByDistance(*queryTree, facetDist, maxDistance,
+    [&](const FacetSequence* fs, const FacetSequence*, double dist) {
+        std::size_t geomIndex = facetGeom[static_cast<std::size_t>(fs - facets.data())];
+        if (!isFound[geomIndex]) {
+            isFound[geomIndex] = true;
+            result.push_back({geomIndex, dist});
+        }
+        return result.size() < k;
+    });
+
+    return result;
+}
+
+
+}
+}
+}
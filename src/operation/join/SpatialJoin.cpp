@@ -0,0 +1,196 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/join/SpatialJoin.h>
+
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+#include <geos/operation/relateng/IMPatternMatcher.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/TaskPool.h>
+
+#include <algorithm>
+
+using geos::geom::Envelope;
+using geos::geom::Geometry;
+using geos::geom::prep::PreparedGeometryFactory;
+
+namespace geos {
+namespace operation { // geos::operation
+namespace join {      // geos::operation::join
+
+SpatialJoin::SpatialJoin(const std::vector<const Geometry*>& left,
+                         const std::vector<const Geometry*>& right)
+    : leftGeoms(left)
+    , rightGeoms(right)
+    , taskPool(nullptr)
+{}
+
+/* private */
+template<typename Predicate>
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::join(double distance, Predicate&& predicate) const
+{
+    std::vector<IndexPair> result;
+    if (leftGeoms.empty() || rightGeoms.empty()) {
+        return result;
+    }
+
+    // Envelopes are cached lazily, so compute them before any
+    // geometry is shared between threads.
+    index::strtree::TemplateSTRtree<std::size_t> tree(10, rightGeoms.size());
+    for (std::size_t i = 0; i < rightGeoms.size(); i++) {
+        const Geometry* g = rightGeoms[i];
+        if (g != nullptr && !g->isEmpty()) {
+            tree.insert(*g->getEnvelopeInternal(), i);
+        }
+    }
+    for (const Geometry* g : leftGeoms) {
+        if (g != nullptr) {
+            g->getEnvelopeInternal();
+        }
+    }
+    tree.build(taskPool);
+
+    std::size_t n = leftGeoms.size();
+    std::size_t numChunks = 1;
+    if (taskPool != nullptr && taskPool->getNumWorkers() > 0) {
+        numChunks = std::min(n, taskPool->getConcurrency() * 8);
+    }
+
+    std::vector<std::vector<IndexPair>> chunkResults(numChunks);
+
+    util::parallelFor(taskPool, numChunks, [this, n, numChunks, distance, &tree, &predicate, &chunkResults](std::size_t c) {
+        std::size_t start = n * c / numChunks;
+        std::size_t end = n * (c + 1) / numChunks;
+
+        std::vector<IndexPair>& pairs = chunkResults[c];
+        std::vector<std::size_t> candidates;
+
+        for (std::size_t i = start; i < end; i++) {
+            GEOS_CHECK_FOR_INTERRUPTS();
+
+            const Geometry* g = leftGeoms[i];
+            if (g == nullptr || g->isEmpty()) {
+                continue;
+            }
+
+            Envelope env(*g->getEnvelopeInternal());
+            if (distance > 0) {
+                env.expandBy(distance);
+            }
+
+            candidates.clear();
+            tree.query(env, candidates);
+            if (candidates.empty()) {
+                continue;
+            }
+            std::sort(candidates.begin(), candidates.end());
+
+            if (candidates.size() == 1) {
+                if (predicate(*g, *rightGeoms[candidates[0]])) {
+                    pairs.emplace_back(i, candidates[0]);
+                }
+                continue;
+            }
+
+            auto prep = PreparedGeometryFactory::prepare(g);
+            for (std::size_t j : candidates) {
+                if (predicate(*prep, *rightGeoms[j])) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+    });
+
+    std::size_t total = 0;
+    for (const auto& pairs : chunkResults) {
+        total += pairs.size();
+    }
+    result.reserve(total);
+    for (const auto& pairs : chunkResults) {
+        result.insert(result.end(), pairs.begin(), pairs.end());
+    }
+
+    return result;
+}
+
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::intersects() const
+{
+    return join(0, [](const auto& a, const Geometry& b) {
+        return a.intersects(&b);
+    });
+}
+
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::contains() const
+{
+    return join(0, [](const auto& a, const Geometry& b) {
+        return a.contains(&b);
+    });
+}
+
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::within() const
+{
+    return join(0, [](const auto& a, const Geometry& b) {
+        return a.within(&b);
+    });
+}
+
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::isWithinDistance(double distance) const
+{
+    if (!(distance >= 0)) {
+        throw util::IllegalArgumentException("Distance must be non-negative");
+    }
+
+    return join(distance, [distance](const auto& a, const Geometry& b) {
+        return a.isWithinDistance(&b, distance);
+    });
+}
+
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::relate(const std::string& pattern) const
+{
+    // Candidates come from envelope intersection, which would miss
+    // disjoint pairs matching a pattern without interaction.
+    if (!relateng::IMPatternMatcher(pattern).requireInteraction()) {
+        throw util::IllegalArgumentException("Pattern does not require the geometries to intersect: " + pattern);
+    }
+
+    return join(0, [&pattern](const auto& a, const Geometry& b) {
+        return a.relate(&b, pattern);
+    });
+}
+
+/* public static */
+std::vector<SpatialJoin::IndexPair>
+SpatialJoin::intersects(const std::vector<const Geometry*>& left,
+                        const std::vector<const Geometry*>& right,
+                        util::TaskPool* pool)
+{
+    SpatialJoin sj(left, right);
+    sj.setTaskPool(pool);
+    return sj.intersects();
+}
+
+} // namespace geos::operation::join
+} // namespace geos::operation
+} // namespace geos
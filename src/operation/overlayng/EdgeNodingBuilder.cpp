@@ -49,12 +49,7 @@ using geos::noding::NodedSegmentString;
 using geos::noding::PathString;
 
 
-EdgeNodingBuilder::~EdgeNodingBuilder()
-{
-    for (auto* ss: inputEdges) {
-        delete ss;
-    }
-}
+EdgeNodingBuilder::~EdgeNodingBuilder() = default;
 
 /*private*/
 Noder*
@@ -107,6 +102,31 @@ EdgeNodingBuilder::createFloatingPrecisionNoder(bool doValidation)
     return ret;
 }
 
+/*public*/
+void
+EdgeNodingBuilder::reset(const PrecisionModel* p_pm, Noder* p_customNoder)
+{
+    pm = p_pm;
+    customNoder = p_customNoder;
+    hasEdges = {{false, false}};
+    clipEnv = nullptr;
+    clipper.reset();
+    limiter.reset();
+    // the validating noder refers to the spare noder,
+    // and both refer to the input segment strings
+    internalNoder.reset();
+    spareInternalNoder.reset();
+    intAdder.reset();
+    inputEdges.clear();
+    edgeQue.clear();
+    edgeSourceInfoQue.clear();
+    inputSegStringQue.clear();
+    inputArcStringQue.clear();
+    inputHasZ = false;
+    inputHasM = false;
+    inputHasCurves = false;
+}
+
 /*public*/
 void
 EdgeNodingBuilder::setClipEnvelope(const Envelope* p_clipEnv)
@@ -345,18 +365,18 @@ EdgeNodingBuilder::createEdgeSourceInfo(uint8_t index, int depthDelta, bool isHo
 void
 EdgeNodingBuilder::addEdge(const std::shared_ptr<const CoordinateSequence>& cas, const EdgeSourceInfo* info)
 {
-    // TODO: manage these internally to EdgeNodingBuilder in a std::deque,
-    // since they do not have a life span longer than the EdgeNodingBuilder
-    // in OverlayNG::buildGraph()
-    NodedSegmentString* ss = new NodedSegmentString(cas, inputHasZ, inputHasM, reinterpret_cast<const void*>(info));
-    inputEdges.push_back(ss);
+    // Concentrate small memory allocations via std::deque, since
+    // the input edges do not have a life span longer than the
+    // EdgeNodingBuilder in OverlayNG::buildGraph()
+    inputSegStringQue.emplace_back(cas, inputHasZ, inputHasM, reinterpret_cast<const void*>(info));
+    inputEdges.push_back(&(inputSegStringQue.back()));
 }
 
 void
 EdgeNodingBuilder::addCurvedEdge(const std::shared_ptr<const CoordinateSequence>& cas, const std::vector<CircularArc>& arcs, const EdgeSourceInfo* info)
 {
-    NodableArcString* as = new NodableArcString(arcs, cas, inputHasZ, inputHasM, reinterpret_cast<const void*>(info));
-    inputEdges.push_back(as);
+    inputArcStringQue.emplace_back(arcs, cas, inputHasZ, inputHasM, reinterpret_cast<const void*>(info));
+    inputEdges.push_back(&(inputArcStringQue.back()));
 }
 
 /*private*/
@@ -0,0 +1,69 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/operation/overlayng/OverlayContext.h>
+
+#include <geos/geom/Geometry.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace overlayng { // geos.operation.overlayng
+
+using namespace geos::geom;
+
+/*public*/
+OverlayContext::OverlayContext()
+    : nodingBuilder(nullptr, nullptr)
+{}
+
+/*public*/
+std::unique_ptr<Geometry>
+OverlayContext::overlay(const Geometry* geom0, const Geometry* geom1,
+                        int opCode, const PrecisionModel* pm)
+{
+    OverlayNG ov(geom0, geom1, pm, opCode);
+    ov.setContext(this);
+    return ov.getResult();
+}
+
+/*public*/
+std::unique_ptr<Geometry>
+OverlayContext::overlayRobust(const Geometry* geom0, const Geometry* geom1, int opCode)
+{
+    return OverlayNGRobust::Overlay(geom0, geom1, opCode, this);
+}
+
+/*public*/
+EdgeNodingBuilder&
+OverlayContext::getNodingBuilder(const PrecisionModel* pm, noding::Noder* noder)
+{
+    nodingBuilder.reset(pm, noder);
+    return nodingBuilder;
+}
+
+/*public*/
+OverlayGraph&
+OverlayContext::getGraph(std::size_t numEdges)
+{
+    graph.reset(numEdges);
+    return graph;
+}
+
+
+} // namespace geos.operation.overlayng
+} // namespace geos.operation
+} // namespace geos
@@ -37,6 +37,25 @@ using namespace geos::geom;
 OverlayGraph::OverlayGraph()
 {}
 
+OverlayGraph::OverlayGraph(std::size_t numEdges)
+{
+    // Each edge adds two OverlayEdges and at most two nodes
+    edges.reserve(2 * numEdges);
+    nodeMap.reserve(2 * numEdges);
+}
+
+/*public*/
+void
+OverlayGraph::reset(std::size_t numEdges)
+{
+    nodeMap.clear();
+    edges.clear();
+    ovEdgeQue.clear();
+    ovLabelQue.clear();
+    edges.reserve(2 * numEdges);
+    nodeMap.reserve(2 * numEdges);
+}
+
 /*public*/
 std::vector<OverlayEdge*>&
 OverlayGraph::getEdges()
@@ -25,6 +25,7 @@
 #include <geos/operation/overlayng/InputGeometry.h>
 #include <geos/operation/overlayng/IntersectionPointBuilder.h>
 #include <geos/operation/overlayng/LineBuilder.h>
+#include <geos/operation/overlayng/OverlayContext.h>
 #include <geos/operation/overlayng/OverlayEdge.h>
 #include <geos/operation/overlayng/OverlayLabeller.h>
 #include <geos/operation/overlayng/OverlayMixedPoints.h>
@@ -39,6 +40,7 @@
 #include <geos/util/TopologyException.h>
 
 #include <algorithm>
+#include <optional>
 
 #ifndef GEOS_DEBUG
 #define GEOS_DEBUG 0
@@ -210,7 +212,10 @@ OverlayNG::computeEdgeOverlay()
      * Node the edges, using whatever noder is being used
      * Formerly in nodeEdges())
      */
-    EdgeNodingBuilder nodingBuilder(pm, noder);
+    std::optional<EdgeNodingBuilder> localNodingBuilder;
+    EdgeNodingBuilder& nodingBuilder = context != nullptr
+        ? context->getNodingBuilder(pm, noder)
+        : localNodingBuilder.emplace(pm, noder);
     // clipEnv not always used, but needs to remain in scope
     // as long as nodingBuilder when it is.
     Envelope clipEnv;
@@ -245,7 +250,10 @@ OverlayNG::computeEdgeOverlay()
     */
     // Sort the edges first, for comparison with JTS results
     // std::sort(edges.begin(), edges.end(), EdgeComparator);
-    OverlayGraph graph;
+    std::optional<OverlayGraph> localGraph;
+    OverlayGraph& graph = context != nullptr
+        ? context->getGraph(edges.size())
+        : localGraph.emplace(edges.size());
     for (Edge* e : edges) {
         // Write out edge coordinates
         // std::cout << *e->getCoordinatesRO() << std::endl;
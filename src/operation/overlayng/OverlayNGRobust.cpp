@@ -83,6 +83,14 @@ OverlayNGRobust::Union(const Geometry* a)
 /*public static*/
 std::unique_ptr<Geometry>
 OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCode)
+{
+    return Overlay(geom0, geom1, opCode, nullptr);
+}
+
+/*public static*/
+std::unique_ptr<Geometry>
+OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCode,
+                         OverlayContext* context)
 {
     std::unique_ptr<Geometry> result;
     std::runtime_error exOriginal("");
@@ -95,7 +103,9 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
 #if GEOS_DEBUG
         std::cerr << "Using fixed precision overlay." << std::endl;
 #endif
-        return OverlayNG::overlay(geom0, geom1, opCode, geom0->getPrecisionModel());
+        OverlayNG ov(geom0, geom1, geom0->getPrecisionModel(), opCode);
+        ov.setContext(context);
+        return ov.getResult();
     }
 
     /**
@@ -110,7 +120,9 @@ OverlayNGRobust::Overlay(const Geometry* geom0, const Geometry* geom1, int opCod
 #if GEOS_DEBUG
         std::cerr << "Using floating point overlay." << std::endl;
 #endif
-        result = OverlayNG::overlay(geom0, geom1, opCode, &PM_FLOAT);
+        OverlayNG ov(geom0, geom1, &PM_FLOAT, opCode);
+        ov.setContext(context);
+        result = ov.getResult();
 
         // Simple noding with no validation
         // There are cases where this succeeds with invalid noding (e.g. STMLF 1608).
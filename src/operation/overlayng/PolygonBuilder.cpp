@@ -60,7 +60,7 @@ void
 PolygonBuilder::buildRings(const std::vector<OverlayEdge*>& resultAreaEdges)
 {
     linkResultAreaEdgesMax(resultAreaEdges);
-    std::vector<std::unique_ptr<MaximalEdgeRing>> maxRings = buildMaximalRings(resultAreaEdges);
+    std::vector<MaximalEdgeRing*> maxRings = buildMaximalRings(resultAreaEdges);
     buildMinimalRings(maxRings);
     placeFreeHoles(shellList, freeHoleList);
 }
@@ -76,42 +76,30 @@ PolygonBuilder::linkResultAreaEdgesMax(const std::vector<OverlayEdge*>& resultEd
 }
 
 /*private*/
-std::vector<std::unique_ptr<MaximalEdgeRing>>
+std::vector<MaximalEdgeRing*>
 PolygonBuilder::buildMaximalRings(const std::vector<OverlayEdge*>& edges)
 {
-    std::vector<std::unique_ptr<MaximalEdgeRing>> edgeRings;
+    std::vector<MaximalEdgeRing*> edgeRings;
     for (OverlayEdge* e : edges) {
         if (e->isInResultArea() && e->getLabel()->isBoundaryEither()) {
             // if this edge has not yet been processed
             if (e->getEdgeRingMax() == nullptr) {
-                // Add a MaximalEdgeRing to the vector
-                edgeRings.emplace_back(new MaximalEdgeRing(e));
+                // Add a MaximalEdgeRing to the local storage
+                maxRingQue.emplace_back(e);
+                edgeRings.push_back(&(maxRingQue.back()));
             }
         }
     }
     return edgeRings;
 }
 
-/*private*/
-std::vector<OverlayEdgeRing*>
-PolygonBuilder::storeMinimalRings(std::vector<std::unique_ptr<OverlayEdgeRing>>& minRings)
-{
-    std::vector<OverlayEdgeRing*> minRingPtrs;
-    for (auto& mr: minRings) {
-        minRingPtrs.push_back(mr.get());
-        vecOER.push_back(std::move(mr));
-    }
-    return minRingPtrs;
-}
-
 /*private*/
 void
-PolygonBuilder::buildMinimalRings(const std::vector<std::unique_ptr<MaximalEdgeRing>>& maxRings)
+PolygonBuilder::buildMinimalRings(const std::vector<MaximalEdgeRing*>& maxRings)
 {
-    for (auto& erMax : maxRings) {
-        auto minRings = erMax->buildMinimalRings(geometryFactory);
-        std::vector<OverlayEdgeRing*> minRingPtrs = storeMinimalRings(minRings);
-        assignShellsAndHoles(minRingPtrs);
+    for (MaximalEdgeRing* erMax : maxRings) {
+        std::vector<OverlayEdgeRing*> minRings = erMax->buildMinimalRings(geometryFactory, minRingQue);
+        assignShellsAndHoles(minRings);
     }
 }
 
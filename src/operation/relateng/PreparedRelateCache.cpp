@@ -0,0 +1,146 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/geom/Envelope.h>
+#include <geos/geom/Geometry.h>
+#include <geos/operation/relateng/PreparedRelateCache.h>
+#include <geos/operation/relateng/RelateNG.h>
+
+
+using geos::geom::Geometry;
+
+
+namespace geos {      // geos
+namespace operation { // geos.operation
+namespace relateng {  // geos.operation.relateng
+
+
+/* private */
+PreparedRelateCache::Fingerprint::Fingerprint(const Geometry* geom)
+    : typeId(geom->getGeometryTypeId())
+    , numPoints(geom->getNumPoints())
+    , env(*geom->getEnvelopeInternal())
+{}
+
+
+/* public */
+PreparedRelateCache::PreparedRelateCache(std::size_t p_maxMemory)
+    : maxMemory(p_maxMemory)
+{}
+
+
+/* public static */
+std::size_t
+PreparedRelateCache::estimateMemory(const Geometry* geom)
+{
+    /*
+     * A prepared instance holds the segment index, point locators
+     * and a copy of the segment strings of the geometry,
+     * all of which are roughly linear in the number of vertices.
+     */
+    static constexpr std::size_t BASE_SIZE = 1024;
+    static constexpr std::size_t VERTEX_SIZE = 64;
+    return BASE_SIZE + VERTEX_SIZE * geom->getNumPoints();
+}
+
+
+/* public */
+void
+PreparedRelateCache::add(const Geometry* geom)
+{
+    added.insert(geom);
+}
+
+
+/* public */
+RelateNG*
+PreparedRelateCache::get(const Geometry* geom)
+{
+    if (! contains(geom))
+        return nullptr;
+
+    Fingerprint fingerprint(geom);
+
+    auto found = entryMap.find(geom);
+    if (found != entryMap.end()) {
+        auto it = found->second;
+        if (it->fingerprint == fingerprint) {
+            hits++;
+            entries.splice(entries.begin(), entries, it);
+            return it->prepared.get();
+        }
+        //-- geometry has been modified without being removed
+        evict(it);
+    }
+
+    misses++;
+    return insert(geom, fingerprint);
+}
+
+
+/* private */
+RelateNG*
+PreparedRelateCache::insert(const Geometry* geom, const Fingerprint& fingerprint)
+{
+    std::size_t memory = estimateMemory(geom);
+    if (memory > maxMemory)
+        return nullptr;
+
+    while (memoryUsed + memory > maxMemory && ! entries.empty()) {
+        evict(std::prev(entries.end()));
+    }
+
+    entries.push_front(Entry{geom, fingerprint, RelateNG::prepare(geom), memory});
+    entryMap[geom] = entries.begin();
+    memoryUsed += memory;
+    return entries.front().prepared.get();
+}
+
+
+/* private */
+void
+PreparedRelateCache::evict(std::list<Entry>::iterator it)
+{
+    memoryUsed -= it->memory;
+    entryMap.erase(it->geom);
+    entries.erase(it);
+}
+
+
+/* public */
+void
+PreparedRelateCache::remove(const Geometry* geom)
+{
+    added.erase(geom);
+    auto found = entryMap.find(geom);
+    if (found != entryMap.end()) {
+        evict(found->second);
+    }
+}
+
+
+/* public */
+void
+PreparedRelateCache::clear()
+{
+    entries.clear();
+    entryMap.clear();
+    added.clear();
+    memoryUsed = 0;
+}
+
+
+} // namespace geos.operation.relateng
+} // namespace geos.operation
+} // namespace geos
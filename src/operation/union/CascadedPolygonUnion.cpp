@@ -28,11 +28,13 @@
 #include <geos/operation/overlayng/OverlayNGRobust.h>
 #include <geos/operation/union/CascadedPolygonUnion.h>
 #include <geos/operation/valid/IsValidOp.h>
+#include <geos/util/TaskPool.h>
 #include <geos/util/TopologyException.h>
 
 // std
 #include <cassert>
 #include <cstddef>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -52,9 +54,10 @@ CascadedPolygonUnion::Union(const std::vector<const geom::Surface*>& polys)
 }
 
 std::unique_ptr<geom::Geometry>
-CascadedPolygonUnion::Union(const std::vector<const geom::Surface*>& polys, UnionStrategy* unionFun, geos::util::ProgressFunction* progressFunction)
+CascadedPolygonUnion::Union(const std::vector<const geom::Surface*>& polys, UnionStrategy* unionFun, geos::util::ProgressFunction* progressFunction, geos::util::TaskPool* taskPool)
 {
     CascadedPolygonUnion op(polys, unionFun);
+    op.setTaskPool(taskPool);
     return op.Union(progressFunction);
 }
 
@@ -95,9 +98,12 @@ CascadedPolygonUnion::Union(geos::util::ProgressFunction* progressFunction)
     // TODO avoid creating this vector and run binaryUnion off the iterators directly
     std::vector<const geom::Geometry*> geoms(index.items().begin(), index.items().end());
 
+    // Leaves may be reached from several threads when a task pool is used
     size_t inc = 0;
-    std::function<void()> UnitProgress = [progressFunction, &inc, &geoms]()
+    std::mutex progressMutex;
+    std::function<void()> UnitProgress = [progressFunction, &inc, &progressMutex, &geoms]()
     {
+        std::lock_guard<std::mutex> lock(progressMutex);
         ++inc;
         (*progressFunction)(static_cast<double>(inc)/static_cast<double>(geoms.size()), "");
     };
@@ -130,8 +136,22 @@ CascadedPolygonUnion::binaryUnion(const std::vector<const geom::Geometry*> & geo
     else {
         // recurse on both halves of the list
         std::size_t mid = (end + start) / 2;
-        std::unique_ptr<geom::Geometry> g0(binaryUnion(geoms, start, mid, unitProgress));
-        std::unique_ptr<geom::Geometry> g1(binaryUnion(geoms, mid, end, unitProgress));
+        std::unique_ptr<geom::Geometry> g0;
+        std::unique_ptr<geom::Geometry> g1;
+        if (taskPool) {
+            // the halves are independent, so one can be stolen by
+            // another thread while this one works on the other
+            util::TaskGroup tasks(taskPool);
+            tasks.run([&]() {
+                g1 = binaryUnion(geoms, mid, end, unitProgress);
+            });
+            g0 = binaryUnion(geoms, start, mid, unitProgress);
+            tasks.wait();
+        }
+        else {
+            g0 = binaryUnion(geoms, start, mid, unitProgress);
+            g1 = binaryUnion(geoms, mid, end, unitProgress);
+        }
         return unionSafe(std::move(g0), std::move(g1));
     }
 }
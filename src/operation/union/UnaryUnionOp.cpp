@@ -108,7 +108,7 @@ UnaryUnionOp::Union(geos::util::ProgressFunction* progressFunction)
 
     GeomPtr unionPolygons;
     if(!polygons.empty()) {
-        unionPolygons = CascadedPolygonUnion::Union(polygons.begin(), polygons.end(), unionFunction, progressFunction);
+        unionPolygons = CascadedPolygonUnion::Union(polygons.begin(), polygons.end(), unionFunction, progressFunction, taskPool);
     }
 
     /*
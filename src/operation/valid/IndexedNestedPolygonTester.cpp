@@ -25,6 +25,10 @@
 #include <geos/index/strtree/STRtree.h>
 #include <geos/operation/valid/PolygonTopologyAnalyzer.h>
 #include <geos/operation/valid/IndexedNestedPolygonTester.h>
+#include <geos/util/TaskPool.h>
+
+#include <atomic>
+#include <mutex>
 
 
 namespace geos {      // geos
@@ -58,19 +62,19 @@ IndexedNestedPolygonTester::loadIndex()
 
 /* private */
 IndexedPointInAreaLocator&
-IndexedNestedPolygonTester::getLocator(const Polygon* poly)
+IndexedNestedPolygonTester::getLocator(LocatorMap& locatorMap, const Polygon* poly)
 {
-    auto search = locators.find(poly);
+    auto search = locatorMap.find(poly);
 
     // Entry not found
-    if (search == locators.end())
+    if (search == locatorMap.end())
     {
         // uses pair's piecewise constructor to emplace into
         // std::map<const Polygon*, IndexedPointInAreaLocator> locators;
-        locators.emplace(std::piecewise_construct,
+        locatorMap.emplace(std::piecewise_construct,
             std::forward_as_tuple(poly),
             std::forward_as_tuple(*poly));
-        auto search2 = locators.find(poly);
+        auto search2 = locatorMap.find(poly);
         return search2->second;
     }
 
@@ -84,26 +88,93 @@ bool
 IndexedNestedPolygonTester::isNested()
 {
     for (std::size_t i = 0; i < multiPoly->getNumGeometries(); i++) {
-        const Polygon* poly = multiPoly->getGeometryN(i);
-        const LinearRing* shell = poly->getExteriorRing();
+        if (findNestedPoint(multiPoly->getGeometryN(i), locators, nestedPt))
+            return true;
+    }
+    return false;
+}
+
+
+/* public */
+bool
+IndexedNestedPolygonTester::isNested(util::TaskPool* pool)
+{
+    if (pool == nullptr || pool->getNumWorkers() == 0)
+        return isNested();
+    return isNestedParallel(pool);
+}
 
-        std::vector<const Polygon*> results;
-        index.query(*(poly->getEnvelopeInternal()), results);
 
-        for (const Polygon* possibleOuterPoly: results) {
+/* private */
+bool
+IndexedNestedPolygonTester::isNestedParallel(util::TaskPool* pool)
+{
+    std::size_t n = multiPoly->getNumGeometries();
+    std::size_t numTasks = pool->getConcurrency();
+    std::size_t chunkSize = (n + numTasks - 1) / numTasks;
 
-            if (poly == possibleOuterPoly)
-                continue;
-            /**
-             * If polygon is not fully covered by candidate polygon it cannot be nested
-             */
-            if (! possibleOuterPoly->getEnvelopeInternal()->covers(poly->getEnvelopeInternal()))
-                continue;
+    // build the index before it is queried concurrently
+    index.build();
 
-            bool gotNestedPt = findNestedPoint(shell, possibleOuterPoly, getLocator(possibleOuterPoly), nestedPt);
-            if (gotNestedPt)
-                return true;
-        }
+    /**
+    * Each task tests a contiguous range of polygons with its own
+    * locators, since these build their index lazily.
+    * The nested point of the lowest-indexed nested polygon is kept,
+    * so the result is the same as testing sequentially.
+    */
+    std::atomic<std::size_t> firstNested{n};
+    std::mutex resultMutex;
+    util::TaskGroup group(pool);
+    for (std::size_t start = 0; start < n; start += chunkSize) {
+        std::size_t end = std::min(n, start + chunkSize);
+        group.run([this, start, end, &group, &firstNested, &resultMutex]() {
+            LocatorMap chunkLocators;
+            for (std::size_t i = start; i < end; i++) {
+                if (i > firstNested.load(std::memory_order_relaxed) || group.isCancelled())
+                    return;
+                CoordinateXY pt;
+                if (findNestedPoint(multiPoly->getGeometryN(i), chunkLocators, pt)) {
+                    std::lock_guard<std::mutex> lock(resultMutex);
+                    if (i < firstNested) {
+                        firstNested = i;
+                        nestedPt = pt;
+                    }
+                    return;
+                }
+            }
+        });
+    }
+    group.wait();
+
+    return firstNested < n;
+}
+
+
+/* private */
+bool
+IndexedNestedPolygonTester::findNestedPoint(
+    const Polygon* poly,
+    LocatorMap& locatorMap,
+    CoordinateXY& coordNested)
+{
+    const LinearRing* shell = poly->getExteriorRing();
+
+    std::vector<const Polygon*> results;
+    index.query(*(poly->getEnvelopeInternal()), results);
+
+    for (const Polygon* possibleOuterPoly: results) {
+
+        if (poly == possibleOuterPoly)
+            continue;
+        /**
+         * If polygon is not fully covered by candidate polygon it cannot be nested
+         */
+        if (! possibleOuterPoly->getEnvelopeInternal()->covers(poly->getEnvelopeInternal()))
+            continue;
+
+        bool gotNestedPt = findNestedPoint(shell, possibleOuterPoly, getLocator(locatorMap, possibleOuterPoly), coordNested);
+        if (gotNestedPt)
+            return true;
     }
     return false;
 }
@@ -29,8 +29,11 @@
 #include <geos/operation/valid/IndexedNestedPolygonTester.h>
 #include <geos/util/UnsupportedOperationException.h>
 #include <geos/util/IllegalArgumentException.h>
+#include <geos/util/TaskPool.h>
 
+#include <atomic>
 #include <cmath>
+#include <vector>
 
 using namespace geos::geom;
 using geos::algorithm::locate::IndexedPointInAreaLocator;
@@ -211,34 +214,19 @@ IsValidOp::isValid(const Polygon* g)
 bool
 IsValidOp::isValid(const MultiPolygon* g)
 {
-    for (std::size_t i = 0; i < g->getNumGeometries(); i++) {
-        const Polygon* p = g->getGeometryN(i);
-        checkCoordinatesValid(p);
-        if (hasInvalidError()) return false;
-
-        checkRingsClosed(p);
-        if (hasInvalidError()) return false;
-
-        checkRingsPointSize(p);
-        if (hasInvalidError()) return false;
-    }
+    checkPolygons(g, &IsValidOp::checkRingsValid);
+    if (hasInvalidError()) return false;
 
     PolygonTopologyAnalyzer areaAnalyzer(g, isInvertedRingValid);
 
     checkAreaIntersections(areaAnalyzer);
     if (hasInvalidError()) return false;
 
-    for (std::size_t i = 0; i < g->getNumGeometries(); i++) {
-        const Polygon* p = g->getGeometryN(i);
-        checkHolesInShell(p);
-        if (hasInvalidError()) return false;
-    }
+    checkPolygons(g, &IsValidOp::checkHolesInShell);
+    if (hasInvalidError()) return false;
 
-    for (std::size_t i = 0; i < g->getNumGeometries(); i++) {
-        const Polygon* p = g->getGeometryN(i);
-        checkHolesNotNested(p);
-        if (hasInvalidError()) return false;
-    }
+    checkPolygons(g, &IsValidOp::checkHolesNotNested);
+    if (hasInvalidError()) return false;
 
     checkShellsNotNested(g);
     if (hasInvalidError()) return false;
@@ -254,14 +242,76 @@ IsValidOp::isValid(const MultiPolygon* g)
 bool
 IsValidOp::isValid(const GeometryCollection* gc)
 {
-    for (std::size_t i = 0; i < gc->getNumGeometries(); i++) {
-        if (! isValidGeometry(gc->getGeometryN(i)))
-            return false;
+    std::size_t n = gc->getNumGeometries();
+    if (taskPool == nullptr || n < 2) {
+        for (std::size_t i = 0; i < n; i++) {
+            if (! isValidGeometry(gc->getGeometryN(i)))
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * Validate the elements concurrently, each with its own
+     * validator, and report the error of the first invalid one.
+     */
+    std::vector<std::unique_ptr<TopologyValidationError>> errors(n);
+    std::atomic<std::size_t> firstInvalid{n};
+    util::parallelFor(taskPool, n, [&](std::size_t i) {
+        if (i > firstInvalid.load(std::memory_order_relaxed))
+            return;
+        IsValidOp op(gc->getGeometryN(i));
+        op.setSelfTouchingRingFormingHoleValid(isInvertedRingValid);
+        op.setTaskPool(taskPool);
+        if (op.isValid())
+            return;
+        errors[i] = std::move(op.validErr);
+        std::size_t first = firstInvalid.load(std::memory_order_relaxed);
+        while (i < first && ! firstInvalid.compare_exchange_weak(first, i)) {}
+    });
+
+    if (firstInvalid < n) {
+        validErr = std::move(errors[firstInvalid]);
+        return false;
     }
     return true;
 }
 
 
+/* private */
+void
+IsValidOp::checkPolygons(const MultiPolygon* mp, void (IsValidOp::*check)(const Polygon*))
+{
+    std::size_t n = mp->getNumGeometries();
+    if (taskPool == nullptr) {
+        for (std::size_t i = 0; i < n; i++) {
+            (this->*check)(mp->getGeometryN(i));
+            if (hasInvalidError()) return;
+        }
+        return;
+    }
+
+    std::vector<std::unique_ptr<TopologyValidationError>> errors(n);
+    std::atomic<std::size_t> firstInvalid{n};
+    util::parallelFor(taskPool, n, [&](std::size_t i) {
+        if (i > firstInvalid.load(std::memory_order_relaxed))
+            return;
+        IsValidOp op(mp->getGeometryN(i));
+        op.isInvertedRingValid = isInvertedRingValid;
+        (op.*check)(mp->getGeometryN(i));
+        if (! op.hasInvalidError())
+            return;
+        errors[i] = std::move(op.validErr);
+        std::size_t first = firstInvalid.load(std::memory_order_relaxed);
+        while (i < first && ! firstInvalid.compare_exchange_weak(first, i)) {}
+    }, POLYGON_GRAIN_SIZE);
+
+    if (firstInvalid < n) {
+        validErr = std::move(errors[firstInvalid]);
+    }
+}
+
+
 /* private */
 void
 IsValidOp::checkCoordinatesValid(const CoordinateSequence* coords)
@@ -330,6 +380,20 @@ IsValidOp::checkRingsPointSize(const Polygon* poly)
 }
 
 
+/* private */
+void
+IsValidOp::checkRingsValid(const Polygon* poly)
+{
+    checkCoordinatesValid(poly);
+    if (hasInvalidError()) return;
+
+    checkRingsClosed(poly);
+    if (hasInvalidError()) return;
+
+    checkRingsPointSize(poly);
+}
+
+
 /* private */
 void
 IsValidOp::checkRingPointSize(const LinearRing* ring)
@@ -465,7 +529,7 @@ IsValidOp::checkShellsNotNested(const MultiPolygon* mp)
         return;
 
     IndexedNestedPolygonTester nestedTester(mp);
-    if (nestedTester.isNested()) {
+    if (nestedTester.isNested(taskPool)) {
         logInvalid(TopologyValidationError::eNestedShells,
                    nestedTester.getNestedPoint());
     }
@@ -35,6 +35,7 @@
 #include <geos/geom/MultiLineString.h>
 #include <geos/geom/MultiPolygon.h>
 #include <geos/util/Interrupt.h>
+#include <geos/util/TaskPool.h>
 #include <geos/util/UniqueCoordinateArrayFilter.h>
 #include <geos/util/UnsupportedOperationException.h>
 
@@ -294,12 +295,15 @@ static std::unique_ptr<geom::Geometry> MakeValidPoly(const geom::Geometry* geom)
     return factory->createGeometryCollection(std::move(vgeoms));
 }
 
-static std::unique_ptr<geom::Geometry> MakeValidCollection(const geom::GeometryCollection* coll)
+static std::unique_ptr<geom::Geometry> MakeValidCollection(const geom::GeometryCollection* coll,
+                                                           util::TaskPool* taskPool)
 {
-    std::vector<std::unique_ptr<Geometry>> validGeoms;
-    for(const auto& geom: *coll) {
-        validGeoms.push_back(MakeValid().build(geom.get()));
-    }
+    std::vector<std::unique_ptr<Geometry>> validGeoms(coll->getNumGeometries());
+    util::parallelFor(taskPool, validGeoms.size(), [&](std::size_t i) {
+        MakeValid makeValid;
+        makeValid.setTaskPool(taskPool);
+        validGeoms[i] = makeValid.build(coll->getGeometryN(i));
+    });
     return coll->getFactory()->createGeometryCollection(std::move(validGeoms));
 }
 
@@ -308,6 +312,7 @@ std::unique_ptr<geom::Geometry> MakeValid::build(const geom::Geometry* geom)
 {
 
     IsValidOp ivo(geom);
+    ivo.setTaskPool(taskPool);
     if( ivo.getValidationError() == nullptr ) {
         return std::unique_ptr<geom::Geometry>(geom->clone());
     }
@@ -327,7 +332,7 @@ std::unique_ptr<geom::Geometry> MakeValid::build(const geom::Geometry* geom)
     }
     if( typeId == GEOS_GEOMETRYCOLLECTION ) {
         auto coll = detail::down_cast<const GeometryCollection*>(geom);
-        return MakeValidCollection(coll);
+        return MakeValidCollection(coll, taskPool);
     }
 
     throw util::UnsupportedOperationException();
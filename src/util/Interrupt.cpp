@@ -15,11 +15,13 @@
 #include <geos/util/Interrupt.h>
 #include <geos/util/GEOSException.h> // for inheritance
 
+#include <atomic>
+
 namespace {
 
 // Callback and request status for interruption of any single thread
 geos::util::Interrupt::Callback* callback = nullptr;
-bool requested = false;
+std::atomic<bool> requested(false);
 
 // Callback for interruption of the current thread
 thread_local geos::util::CurrentThreadInterrupt::ThreadCallback* callback_thread = nullptr;
@@ -89,6 +91,14 @@ CurrentThreadInterrupt::registerCallback(ThreadCallback *cb, void *data) {
     return prev;
 }
 
+CurrentThreadInterrupt::ThreadCallback*
+CurrentThreadInterrupt::getCallback(void** data) {
+    if (data) {
+        *data = callback_thread_data;
+    }
+    return callback_thread;
+}
+
 void
 CurrentThreadInterrupt::process() {
     if (callback_thread && (*callback_thread)(callback_thread_data)) {
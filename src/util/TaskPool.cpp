@@ -0,0 +1,285 @@
+/**********************************************************************
+ *
+ * GEOS - Geometry Engine Open Source
+ * http://geos.osgeo.org
+ *
+ * Copyright (C) 2026 GEOS contributors
+ *
+ * This is free software; you can redistribute and/or modify it under
+ * the terms of the GNU Lesser General Public Licence as published
+ * by the Free Software Foundation.
+ * See the COPYING file for more information.
+ *
+ **********************************************************************/
+
+#include <geos/util/TaskPool.h>
+#include <geos/util/Interrupt.h>
+
+#include <chrono>
+
+namespace geos {
+namespace util { // geos::util
+
+namespace {
+
+// Pool and queue index of the worker running on the current thread, if any
+thread_local TaskPool* currentPool = nullptr;
+thread_local std::size_t currentIndex = 0;
+
+}
+
+TaskPool::TaskPool(std::size_t numWorkers)
+    : numPending(0)
+    , stopping(false)
+{
+    for (std::size_t i = 0; i <= numWorkers; i++) {
+        queues.emplace_back(new WorkQueue());
+    }
+
+    workers.reserve(numWorkers);
+    for (std::size_t i = 0; i < numWorkers; i++) {
+        workers.emplace_back(&TaskPool::workerLoop, this, i);
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCond.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+std::size_t
+TaskPool::hardwareConcurrency()
+{
+    auto n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+void
+TaskPool::submit(Task&& task)
+{
+    std::size_t index = currentPool == this ? currentIndex : workers.size();
+
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mtx);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    numPending.fetch_add(1);
+
+    // Acquiring the mutex ensures that a worker that saw no pending
+    // tasks is already waiting, so the notification is not lost.
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    sleepCond.notify_one();
+}
+
+bool
+TaskPool::popTask(Task& task)
+{
+    if (numPending.load() == 0) {
+        return false;
+    }
+
+    const std::size_t numQueues = queues.size();
+    const bool isWorker = currentPool == this;
+
+    // Most recently submitted task from our own queue
+    if (isWorker) {
+        WorkQueue& own = *queues[currentIndex];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            numPending.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Oldest task from the other queues
+    std::size_t start = isWorker ? currentIndex + 1 : workers.size();
+    for (std::size_t i = 0; i < numQueues; i++) {
+        std::size_t index = (start + i) % numQueues;
+        if (isWorker && index == currentIndex) {
+            continue;
+        }
+        WorkQueue& q = *queues[index];
+        std::lock_guard<std::mutex> lock(q.mtx);
+        if (!q.tasks.empty()) {
+            task = std::move(q.tasks.front());
+            q.tasks.pop_front();
+            numPending.fetch_sub(1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool
+TaskPool::runPendingTask()
+{
+    Task task;
+    if (!popTask(task)) {
+        return false;
+    }
+
+    TaskGroup* group = task.group;
+    group->execute(task.fn);
+    task.fn = nullptr;
+
+    // The group may be destroyed as soon as the count reaches zero,
+    // so it is decremented under the lock its waiter acquires last.
+    {
+        std::lock_guard<std::mutex> lock(group->stateMutex);
+        if (group->numOutstanding.fetch_sub(1) == 1) {
+            group->doneCond.notify_all();
+        }
+    }
+
+    return true;
+}
+
+void
+TaskPool::workerLoop(std::size_t index)
+{
+    currentPool = this;
+    currentIndex = index;
+
+    for (;;) {
+        if (runPendingTask()) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepCond.wait(lock, [this]() {
+            return stopping || numPending.load() > 0;
+        });
+        if (stopping && numPending.load() == 0) {
+            return;
+        }
+    }
+}
+
+/************************************************************************/
+
+TaskGroup::TaskGroup(TaskPool* p_pool)
+    : pool(p_pool != nullptr && p_pool->getNumWorkers() > 0 ? p_pool : nullptr)
+    , numOutstanding(0)
+    , cancelled(false)
+    , interruptCallback(nullptr)
+    , interruptData(nullptr)
+{
+    interruptCallback = CurrentThreadInterrupt::getCallback(&interruptData);
+    if (pool) {
+        CurrentThreadInterrupt::registerCallback(&TaskGroup::checkInterrupt, this);
+    }
+}
+
+TaskGroup::~TaskGroup()
+{
+    waitAll();
+    if (pool) {
+        CurrentThreadInterrupt::registerCallback(interruptCallback, interruptData);
+    }
+}
+
+int
+TaskGroup::checkInterrupt(void* data)
+{
+    auto* group = static_cast<TaskGroup*>(data);
+    std::lock_guard<std::mutex> lock(group->interruptMutex);
+    if (group->interruptCallback) {
+        return group->interruptCallback(group->interruptData);
+    }
+    return 0;
+}
+
+void
+TaskGroup::execute(std::function<void()>& fn)
+{
+    if (isCancelled()) {
+        return;
+    }
+
+    void* prevData;
+    auto* prevCallback = CurrentThreadInterrupt::getCallback(&prevData);
+    CurrentThreadInterrupt::registerCallback(&TaskGroup::checkInterrupt, this);
+
+    try {
+        fn();
+    }
+    catch (...) {
+        cancelled.store(true);
+        std::lock_guard<std::mutex> lock(stateMutex);
+        if (!error) {
+            error = std::current_exception();
+        }
+    }
+
+    CurrentThreadInterrupt::registerCallback(prevCallback, prevData);
+}
+
+void
+TaskGroup::run(std::function<void()> fn)
+{
+    if (!pool) {
+        execute(fn);
+        return;
+    }
+
+    numOutstanding.fetch_add(1);
+    pool->submit(TaskPool::Task{std::move(fn), this});
+}
+
+void
+TaskGroup::waitAll() noexcept
+{
+    if (!pool) {
+        return;
+    }
+
+    while (numOutstanding.load() > 0) {
+        if (pool->runPendingTask()) {
+            continue;
+        }
+
+        // Remaining tasks are running on other threads. Sleep until
+        // they complete, waking up periodically to help with any
+        // tasks they submit in the meantime.
+        std::unique_lock<std::mutex> lock(stateMutex);
+        doneCond.wait_for(lock, std::chrono::milliseconds(1), [this]() {
+            return numOutstanding.load() == 0;
+        });
+    }
+
+    // Synchronize with the thread that completed the last task
+    std::lock_guard<std::mutex> lock(stateMutex);
+}
+
+void
+TaskGroup::wait()
+{
+    waitAll();
+
+    std::exception_ptr e;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        std::swap(e, error);
+    }
+    cancelled.store(false);
+
+    if (e) {
+        std::rethrow_exception(e);
+    }
+}
+
+} // namespace geos::util
+} // namespace geos
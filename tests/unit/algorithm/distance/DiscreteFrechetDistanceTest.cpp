@@ -11,11 +11,13 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
 #include <geos/util.h>
 // std
 #include <cmath>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace geos {
 namespace geom {
@@ -58,6 +60,53 @@ struct test_frechetdistance_data {
         ensure_equals("checkDensifiedFrechet", distance, expectedDistance, TOLERANCE);
     }
 
+    void
+    checkWithinDistance(const std::string& wkt1, const std::string& wkt2)
+    {
+        std::unique_ptr<Geometry> g1(reader.read(wkt1));
+        std::unique_ptr<Geometry> g2(reader.read(wkt2));
+
+        double distance = DiscreteFrechetDistance::distance(*g1, *g2);
+        ensure("checkWithinDistance at distance",
+               DiscreteFrechetDistance::isWithinDistance(*g1, *g2, distance));
+        ensure("checkWithinDistance below distance",
+               !DiscreteFrechetDistance::isWithinDistance(*g1, *g2, distance * (1 - 1e-9)));
+    }
+
+    std::unique_ptr<Geometry>
+    wavyLine(std::size_t numPoints, double xScale, double amplitude, double freq, double phase)
+    {
+        std::string wkt = "LINESTRING (";
+        for (std::size_t i = 0; i < numPoints; i++) {
+            double x = static_cast<double>(i) * xScale;
+            double y = amplitude * std::sin(freq * x + phase);
+            if (i > 0) wkt += ", ";
+            wkt += std::to_string(x) + " " + std::to_string(y);
+        }
+        wkt += ")";
+        return reader.read(wkt);
+    }
+
+    // Full dynamic programming solution of the discrete Frechet distance
+    static double
+    frechetDP(const CoordinateSequence& p, const CoordinateSequence& q)
+    {
+        std::vector<double> prev(q.size()), cur(q.size());
+        for (std::size_t i = 0; i < p.size(); i++) {
+            for (std::size_t j = 0; j < q.size(); j++) {
+                double d = p.getAt<CoordinateXY>(i).distance(q.getAt<CoordinateXY>(j));
+                double m;
+                if (i == 0 && j == 0) m = d;
+                else if (i == 0) m = cur[j - 1];
+                else if (j == 0) m = prev[j];
+                else m = std::min(std::min(prev[j], prev[j - 1]), cur[j - 1]);
+                cur[j] = std::max(d, m);
+            }
+            std::swap(prev, cur);
+        }
+        return prev[q.size() - 1];
+    }
+
 };
 
 typedef test_group<test_frechetdistance_data> group;
@@ -177,4 +226,46 @@ void object::test<9> ()
     checkDensifiedFrechet("POINT(-11.1111111 40)", "POINT(-11.1111111 40)", 0.8, 0);
 }
 
+// isWithinDistance agrees with distance
+template<>
+template<>
+void object::test<10> ()
+{
+    checkWithinDistance("LINESTRING (0 0, 2 1)", "LINESTRING (0 0, 2 0)");
+    checkWithinDistance("LINESTRING (0 0, 2 0)", "LINESTRING (0 1, 1 2, 2 1)");
+    checkWithinDistance("LINESTRING (1 1, 2 2)", "MULTIPOINT ((0 1), (2 2))");
+    checkWithinDistance("LINESTRING (0 0, 100 0)", "LINESTRING (0 0, 50 50, 100 0)");
+}
+
+// Long lines use the banded computation
+template<>
+template<>
+void object::test<11> ()
+{
+    auto g1 = wavyLine(2000, 0.5, 10, 0.05, 0);
+    auto g2 = wavyLine(1500, 0.66, 12, 0.05, 0.3);
+
+    double expected = frechetDP(*g1->getCoordinates(), *g2->getCoordinates());
+    ensure_equals(DiscreteFrechetDistance::distance(*g1, *g2), expected);
+    ensure_equals(DiscreteFrechetDistance::distance(*g2, *g1), expected);
+
+    DiscreteFrechetDistance dist(*g1, *g2);
+    auto pts = dist.getCoordinates();
+    ensure_distance(pts[0].distance(pts[1]), expected, 1e-12);
+
+    ensure(DiscreteFrechetDistance::isWithinDistance(*g1, *g2, expected));
+    ensure(!DiscreteFrechetDistance::isWithinDistance(*g1, *g2, expected * 0.999));
+}
+
+// isWithinDistance on lines far apart
+template<>
+template<>
+void object::test<12> ()
+{
+    auto g1 = wavyLine(5000, 1, 10, 0.01, 0);
+    auto g2 = wavyLine(5000, 1, 10, 0.01, 3.14159);
+    ensure(!DiscreteFrechetDistance::isWithinDistance(*g1, *g2, 1));
+    ensure(DiscreteFrechetDistance::isWithinDistance(*g1, *g1, 0));
+}
+
 } // namespace tut
@@ -8,11 +8,16 @@
 #include <geos/constants.h>
 #include <geos/io/WKTReader.h>
 #include <geos/algorithm/distance/DiscreteHausdorffDistance.h>
+#include <geos/algorithm/distance/DistanceToPoint.h>
+#include <geos/algorithm/distance/PointPairDistance.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h> // required for use in unique_ptr
 #include <geos/geom/Coordinate.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/util/TaskPool.h>
 // std
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <memory>
@@ -76,6 +81,37 @@ struct test_DiscreteHausdorffDistance_data {
         ensure(diff <= TOLERANCE);
     }
 
+    GeomPtr
+    wavyLine(std::size_t numPoints, double amplitude, double phase)
+    {
+        std::string wkt = "LINESTRING (";
+        for (std::size_t i = 0; i < numPoints; i++) {
+            double x = static_cast<double>(i);
+            double y = amplitude * std::sin(0.1 * x + phase);
+            if (i > 0) wkt += ", ";
+            wkt += std::to_string(x) + " " + std::to_string(y);
+        }
+        wkt += ")";
+        return reader.read(wkt);
+    }
+
+    // Brute-force Hausdorff distance between the vertices and the facets
+    static double
+    bruteForce(const Geometry& g1, const Geometry& g2)
+    {
+        auto orientedDistance = [](const Geometry& discreteGeom, const Geometry& geom) {
+            PointPairDistance maxDist;
+            auto pts = discreteGeom.getCoordinates();
+            for (std::size_t i = 0; i < pts->size(); i++) {
+                PointPairDistance minDist;
+                DistanceToPoint::computeDistance(geom, pts->getAt<CoordinateXY>(i), minDist);
+                maxDist.setMaximum(minDist);
+            }
+            return maxDist.getDistance();
+        };
+        return std::max(orientedDistance(g1, g2), orientedDistance(g2, g1));
+    }
+
     PrecisionModel pm;
     GeometryFactory::Ptr gf;
     geos::io::WKTReader reader;
@@ -233,5 +269,43 @@ void object::test<8>
             2.8284271247461903);
 }
 
+// Large inputs are computed with a facet index
+template<>
+template<>
+void object::test<9>
+()
+{
+    auto g1 = wavyLine(3000, 10, 0);
+    auto g2 = wavyLine(2500, 11, 0.2);
+
+    double expected = bruteForce(*g1, *g2);
+    DiscreteHausdorffDistance dhd(*g1, *g2);
+    ensure_distance(dhd.distance(), expected, 1e-12);
+
+    const auto& pts = dhd.getCoordinates();
+    ensure_distance(pts[0].distance(pts[1]), expected, 1e-12);
+}
+
+// Parallel computation gives the same result
+template<>
+template<>
+void object::test<10>
+()
+{
+    auto g1 = wavyLine(5000, 10, 0);
+    auto g2 = reader.read("POLYGON ((0 -5, 4000 -5, 4000 5, 0 5, 0 -5))");
+
+    DiscreteHausdorffDistance seq(*g1, *g2);
+    seq.setDensifyFraction(0.25);
+    double expected = seq.distance();
+
+    geos::util::TaskPool pool(3);
+    DiscreteHausdorffDistance par(*g1, *g2);
+    par.setDensifyFraction(0.25);
+    par.setTaskPool(&pool);
+    ensure_equals(par.distance(), expected);
+    ensure(par.getCoordinates() == seq.getCoordinates());
+}
+
 } // namespace tut
 
@@ -524,4 +524,36 @@ void object::test<27>()
     ensure(!GEOSHasM(result_));
 }
 
+template<>
+template<>
+void object::test<28>()
+{
+    set_test_name("GEOSBufferWithParamsBatch");
+    useContext();
+
+    geom1_ = fromWKT("POINT (0 0)");
+    geom2_ = fromWKT("LINESTRING (0 0, 10 0)");
+    geom3_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    GEOSSetSRID_r(ctxt_, geom2_, 4326);
+
+    bp_ = GEOSBufferParams_create_r(ctxt_);
+    ensure_equals(GEOSBufferParams_setQuadrantSegments_r(ctxt_, bp_, 4), 1);
+
+    const GEOSGeometry* geoms[] = { geom1_, geom2_, geom3_ };
+    GEOSGeometry* results[3];
+
+    for (unsigned int numThreads : { 1u, 3u }) {
+        GEOSContext_setThreadCount_r(ctxt_, numThreads);
+
+        ensure_equals(GEOSBufferWithParamsBatch_r(ctxt_, geoms, 3, bp_, 2, results), 1);
+        for (std::size_t i = 0; i < 3; i++) {
+            GEOSGeometry* expected = GEOSBufferWithParams_r(ctxt_, geoms[i], bp_, 2);
+            ensure_equals(GEOSEqualsIdentical_r(ctxt_, results[i], expected), 1);
+            ensure_equals(GEOSGetSRID_r(ctxt_, results[i]), GEOSGetSRID_r(ctxt_, geoms[i]));
+            GEOSGeom_destroy_r(ctxt_, expected);
+            GEOSGeom_destroy_r(ctxt_, results[i]);
+        }
+    }
+}
+
 } // namespace tut
@@ -0,0 +1,292 @@
+//
+// Test Suite for C-API GEOSContext_setPreparedCacheParams_r and friends
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeoscontextpreparedcache_data : public capitest::utility
+{
+    GEOSContextHandle_t ctx_;
+
+    test_capigeoscontextpreparedcache_data()
+        : ctx_(GEOS_init_r())
+    {
+    }
+
+    ~test_capigeoscontextpreparedcache_data()
+    {
+        finishGEOS_r(ctx_);
+    }
+
+    GEOSGeometry* read(const char* wkt)
+    {
+        return GEOSGeomFromWKT_r(ctx_, wkt);
+    }
+};
+
+typedef test_group<test_capigeoscontextpreparedcache_data> group;
+typedef group::object object;
+
+group test_capigeoscontextpreparedcache_group("capi::GEOSContextPreparedCache");
+
+//
+// Test Cases
+//
+
+// Cache is disabled by default
+template<>
+template<>
+void object::test<1>
+()
+{
+    size_t hits = 0, misses = 0, mem = 0;
+    ensure_equals(GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem), 0);
+
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+    ensure_equals(GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem), 1);
+    ensure_equals(hits, 0u);
+    ensure_equals(misses, 0u);
+    ensure_equals(mem, 0u);
+
+    GEOSContext_setPreparedCacheParams_r(ctx_, 0);
+    ensure_equals(GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem), 0);
+}
+
+// Predicates give the same results with and without the cache
+template<>
+template<>
+void object::test<2>
+()
+{
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+
+    GEOSGeometry* a = read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    ensure_equals(GEOSContext_addToPreparedCache_r(ctx_, a), 1);
+    const char* wkts[] = {
+        "POINT (5 5)",
+        "POINT (20 20)",
+        "POINT (10 5)",
+        "LINESTRING (5 5, 15 5)",
+        "POLYGON ((2 2, 2 4, 4 4, 4 2, 2 2))",
+        "POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))",
+    };
+
+    for (int pass = 0; pass < 3; pass++) {
+        for (const char* wkt : wkts) {
+            GEOSGeometry* b = read(wkt);
+            ensure_equals(wkt, GEOSIntersects_r(ctx_, a, b), GEOSIntersects(a, b));
+            ensure_equals(wkt, GEOSDisjoint_r(ctx_, a, b), GEOSDisjoint(a, b));
+            ensure_equals(wkt, GEOSTouches_r(ctx_, a, b), GEOSTouches(a, b));
+            ensure_equals(wkt, GEOSCrosses_r(ctx_, a, b), GEOSCrosses(a, b));
+            ensure_equals(wkt, GEOSWithin_r(ctx_, a, b), GEOSWithin(a, b));
+            ensure_equals(wkt, GEOSContains_r(ctx_, a, b), GEOSContains(a, b));
+            ensure_equals(wkt, GEOSOverlaps_r(ctx_, a, b), GEOSOverlaps(a, b));
+            ensure_equals(wkt, GEOSCovers_r(ctx_, a, b), GEOSCovers(a, b));
+            ensure_equals(wkt, GEOSCoveredBy_r(ctx_, a, b), GEOSCoveredBy(a, b));
+            ensure_equals(wkt, GEOSEquals_r(ctx_, a, b), GEOSEquals(a, b));
+            ensure_equals(wkt, GEOSRelatePattern_r(ctx_, a, b, "T********"),
+                               GEOSRelatePattern(a, b, "T********"));
+
+            char* im1 = GEOSRelate_r(ctx_, a, b);
+            char* im2 = GEOSRelate(a, b);
+            ensure_equals(wkt, std::string(im1), std::string(im2));
+            GEOSFree_r(ctx_, im1);
+            GEOSFree(im2);
+
+            GEOSGeom_destroy_r(ctx_, b);
+        }
+    }
+
+    size_t hits = 0, misses = 0, mem = 0;
+    ensure_equals(GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem), 1);
+    ensure_equals(misses, 1u);
+    ensure(hits > 0);
+    ensure(mem > 0);
+
+    GEOSGeom_destroy_r(ctx_, a);
+    ensure_equals(GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem), 1);
+    ensure_equals(mem, 0u);
+}
+
+// Clearing the cache keeps the statistics
+template<>
+template<>
+void object::test<3>
+()
+{
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+
+    GEOSGeometry* a = read("LINESTRING (0 0, 10 10)");
+    GEOSGeometry* b = read("LINESTRING (0 10, 10 0)");
+    GEOSContext_addToPreparedCache_r(ctx_, a);
+
+    ensure_equals(GEOSCrosses_r(ctx_, a, b), 1);
+    ensure_equals(GEOSCrosses_r(ctx_, a, b), 1);
+
+    size_t hits = 0, misses = 0, mem = 0;
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem);
+    ensure_equals(hits, 1u);
+    ensure_equals(misses, 1u);
+    ensure(mem > 0);
+
+    GEOSContext_clearPreparedCache_r(ctx_);
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem);
+    ensure_equals(hits, 1u);
+    ensure_equals(mem, 0u);
+
+    GEOSGeom_destroy_r(ctx_, a);
+    GEOSGeom_destroy_r(ctx_, b);
+}
+
+// Geometries modified in place are not matched
+template<>
+template<>
+void object::test<4>
+()
+{
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+
+    GEOSGeometry* a = read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    GEOSGeometry* b = read("POINT (5 5)");
+    GEOSContext_addToPreparedCache_r(ctx_, a);
+
+    ensure_equals(GEOSContains_r(ctx_, a, b), 1);
+    ensure_equals(GEOSNormalize_r(ctx_, a), 0);
+    ensure_equals(GEOSContains_r(ctx_, a, b), 1);
+
+    // normalizing removed the geometry from the cache
+    size_t hits = 0, misses = 0;
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, nullptr);
+    ensure_equals(hits, 0u);
+    ensure_equals(misses, 1u);
+
+    GEOSGeom_destroy_r(ctx_, a);
+    GEOSGeom_destroy_r(ctx_, b);
+}
+
+// Only geometries added to the cache are prepared
+template<>
+template<>
+void object::test<5>
+()
+{
+    GEOSGeometry* a = read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    GEOSGeometry* b = read("POINT (5 5)");
+    GEOSGeometry* curve = read("CIRCULARSTRING (0 0, 1 1, 2 0)");
+
+    ensure_equals(GEOSContext_addToPreparedCache_r(ctx_, a), 0);
+
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+    ensure_equals(GEOSContext_addToPreparedCache_r(ctx_, curve), 0);
+    for (int i = 0; i < 3; i++) {
+        ensure_equals(GEOSContains_r(ctx_, a, b), 1);
+    }
+
+    size_t hits = 0, misses = 0, mem = 0;
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem);
+    ensure_equals(hits, 0u);
+    ensure_equals(misses, 0u);
+    ensure_equals(mem, 0u);
+
+    GEOSGeom_destroy_r(ctx_, a);
+    GEOSGeom_destroy_r(ctx_, b);
+    GEOSGeom_destroy_r(ctx_, curve);
+}
+
+// Removing a geometry from the cache
+template<>
+template<>
+void object::test<6>
+()
+{
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+
+    GEOSGeometry* a = read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    GEOSGeometry* b = read("POINT (5 5)");
+    ensure_equals(GEOSContext_addToPreparedCache_r(ctx_, a), 1);
+
+    ensure_equals(GEOSContains_r(ctx_, a, b), 1);
+    ensure_equals(GEOSContains_r(ctx_, a, b), 1);
+
+    size_t hits = 0, misses = 0, mem = 0;
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem);
+    ensure_equals(hits, 1u);
+    ensure(mem > 0);
+
+    GEOSContext_removeFromPreparedCache_r(ctx_, a);
+    GEOSContext_removeFromPreparedCache_r(ctx_, b);
+    ensure_equals(GEOSContains_r(ctx_, a, b), 1);
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem);
+    ensure_equals(hits, 1u);
+    ensure_equals(misses, 1u);
+    ensure_equals(mem, 0u);
+
+    // the geometry can now be destroyed in any context
+    GEOSGeom_destroy(a);
+    GEOSGeom_destroy_r(ctx_, b);
+}
+
+// Components are removed with the geometry owning them
+template<>
+template<>
+void object::test<7>
+()
+{
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+
+    GEOSGeometry* c = read("MULTIPOLYGON (((0 0, 0 10, 10 10, 10 0, 0 0)), ((20 0, 20 10, 30 10, 30 0, 20 0)))");
+    GEOSGeometry* b = read("POINT (5 5)");
+    const GEOSGeometry* part = GEOSGetGeometryN_r(ctx_, c, 0);
+    const GEOSGeometry* ring = GEOSGetExteriorRing_r(ctx_, GEOSGetGeometryN_r(ctx_, c, 1));
+    GEOSContext_addToPreparedCache_r(ctx_, part);
+    GEOSContext_addToPreparedCache_r(ctx_, ring);
+
+    ensure_equals(GEOSContains_r(ctx_, part, b), 1);
+    ensure_equals(GEOSIntersects_r(ctx_, ring, b), 0);
+
+    size_t mem = 0;
+    GEOSContext_getPreparedCacheStats_r(ctx_, nullptr, nullptr, &mem);
+    ensure(mem > 0);
+
+    GEOSGeom_destroy_r(ctx_, c);
+    GEOSContext_getPreparedCacheStats_r(ctx_, nullptr, nullptr, &mem);
+    ensure_equals(mem, 0u);
+
+    GEOSGeom_destroy_r(ctx_, b);
+}
+
+// Geometries passed to GEOS are removed from the cache
+template<>
+template<>
+void object::test<8>
+()
+{
+    GEOSContext_setPreparedCacheParams_r(ctx_, 1 << 20);
+
+    GEOSGeometry* a = read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    GEOSGeometry* b = read("POINT (5 5)");
+    GEOSContext_addToPreparedCache_r(ctx_, a);
+    ensure_equals(GEOSContains_r(ctx_, a, b), 1);
+
+    GEOSGeometry* geoms[] = { a };
+    GEOSGeometry* c = GEOSGeom_createCollection_r(ctx_, GEOS_MULTIPOLYGON, geoms, 1);
+
+    size_t hits = 0, misses = 0, mem = 0;
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem);
+    ensure_equals(mem, 0u);
+
+    ensure_equals(GEOSContains_r(ctx_, GEOSGetGeometryN_r(ctx_, c, 0), b), 1);
+    GEOSContext_getPreparedCacheStats_r(ctx_, &hits, &misses, &mem);
+    ensure_equals(misses, 1u);
+    ensure_equals(mem, 0u);
+
+    GEOSGeom_destroy(c);
+    GEOSGeom_destroy_r(ctx_, b);
+}
+
+} // namespace tut
@@ -929,4 +929,58 @@ void object::test<31>()
     ensure("hasM", GEOSCoordSeq_hasM(cs_));
 }
 
+template<>
+template<>
+void object::test<32>()
+{
+    set_test_name("borrowFromBuffer reads XYZ values in place");
+
+    std::vector<double> values{ 0, 0, 1, 10, 0, 2, 10, 10, 3, 0, 0, 1 };
+
+    cs_ = GEOSCoordSeq_borrowFromBuffer(values.data(), 4, true, false);
+    ensure(cs_);
+    ensure_equals(GEOSCoordSeq_isBorrowed(cs_), 1);
+
+    double x, y, z;
+    ensure(GEOSCoordSeq_getXYZ(cs_, 1, &x, &y, &z));
+    ensure_equals(x, 10.0);
+    ensure_equals(y, 0.0);
+    ensure_equals(z, 2.0);
+
+    // the sequence reflects the buffer while it is borrowed
+    values[3] = 11;
+    ensure(GEOSCoordSeq_getX(cs_, 1, &x));
+    ensure_equals(x, 11.0);
+
+    GEOSGeometry* ring = GEOSGeom_createLinearRing(GEOSCoordSeq_clone(cs_));
+    GEOSGeometry* poly = GEOSGeom_createPolygon(ring, nullptr, 0);
+    ensure_equals(GEOSCoordSeq_isBorrowed(GEOSGeom_getCoordSeq(ring)), 0);
+    GEOSGeom_destroy(poly);
+
+    // modification copies the values rather than writing to the buffer
+    ensure(GEOSCoordSeq_setX(cs_, 1, 12));
+    ensure_equals(GEOSCoordSeq_isBorrowed(cs_), 0);
+    ensure_equals(values[3], 11.0);
+    ensure(GEOSCoordSeq_getX(cs_, 1, &x));
+    ensure_equals(x, 12.0);
+}
+
+template<>
+template<>
+void object::test<33>()
+{
+    set_test_name("borrowFromBuffer copies XY values");
+
+    std::vector<double> values{ 1, 2, 3, 4 };
+
+    cs_ = GEOSCoordSeq_borrowFromBuffer(values.data(), 2, false, false);
+    ensure(cs_);
+    ensure_equals(GEOSCoordSeq_isBorrowed(cs_), 0);
+
+    values[2] = 30;
+    double x;
+    ensure(GEOSCoordSeq_getX(cs_, 1, &x));
+    ensure_equals(x, 3.0);
+}
+
 } // namespace tut
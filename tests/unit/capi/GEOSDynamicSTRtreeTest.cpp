@@ -0,0 +1,83 @@
+//
+// Test Suite for C-API GEOSDynamicSTRtree
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+// std
+#include <algorithm>
+#include <vector>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capidynamicstrtree_data : public capitest::utility {
+
+    static void
+    collect(void* item, void* userdata)
+    {
+        static_cast<std::vector<int*>*>(userdata)->push_back(static_cast<int*>(item));
+    }
+};
+
+typedef test_group<test_capidynamicstrtree_data> group;
+typedef group::object object;
+
+group test_capidynamicstrtree_group("capi::GEOSDynamicSTRtree");
+
+//
+// Test Cases
+//
+
+// Items may be inserted and removed after the tree is queried
+template<>
+template<>
+void object::test<1>
+()
+{
+    GEOSDynamicSTRtree* tree = GEOSDynamicSTRtree_create(10);
+    ensure(tree != nullptr);
+
+    std::vector<int> values(1000);
+    std::vector<GEOSGeometry*> geoms;
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = static_cast<int>(i);
+        geoms.push_back(GEOSGeom_createPointFromXY(static_cast<double>(i), 0));
+        GEOSDynamicSTRtree_insert(tree, geoms[i], &values[i]);
+    }
+
+    GEOSGeometry* q = fromWKT("POLYGON ((9.5 -1, 20.5 -1, 20.5 1, 9.5 1, 9.5 -1))");
+    std::vector<int*> hits;
+    GEOSDynamicSTRtree_query(tree, q, collect, &hits);
+    ensure_equals(hits.size(), 11u);
+
+    for (std::size_t i = 10; i < 15; i++) {
+        ensure_equals(GEOSDynamicSTRtree_remove(tree, geoms[i], &values[i]), 1);
+    }
+    ensure_equals(GEOSDynamicSTRtree_remove(tree, geoms[10], &values[10]), 0);
+
+    int extra = -1;
+    GEOSDynamicSTRtree_insert(tree, geoms[20], &extra);
+
+    hits.clear();
+    GEOSDynamicSTRtree_query(tree, q, collect, &hits);
+    ensure_equals(hits.size(), 7u);
+    ensure(std::find(hits.begin(), hits.end(), &extra) != hits.end());
+
+    hits.clear();
+    GEOSDynamicSTRtree_iterate(tree, collect, &hits);
+    ensure_equals(hits.size(), 996u);
+
+    GEOSGeom_destroy(q);
+    for (auto* g : geoms) {
+        GEOSGeom_destroy(g);
+    }
+    GEOSDynamicSTRtree_destroy(tree);
+}
+
+} // namespace tut
@@ -93,4 +93,17 @@ void object::test<5>()
     ensure_equals(GEOSFrechetDistanceDensify_r(ctxt_, geom2_, geom1_, 0.5, &dist), 1);
 }
 
+template<>
+template<>
+void object::test<6>()
+{
+    set_test_name("GEOSFrechetDistanceWithin");
+
+    geom1_ = fromWKT("LINESTRING (0 0, 100 0)");
+    geom2_ = fromWKT("LINESTRING (0 0, 50 50, 100 0)");
+
+    ensure_equals(GEOSFrechetDistanceWithin(geom1_, geom2_, 71), 1);
+    ensure_equals(GEOSFrechetDistanceWithin(geom1_, geom2_, 70), 0);
+}
+
 } // namespace tut
@@ -0,0 +1,94 @@
+//
+// Test Suite for C-API GEOSGeoJSONStreamReader and GEOSGeoJSONStreamWriter
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_capigeosgeojsonstream_data : public capitest::utility {
+    std::string fname_ = "GEOSGeoJSONStreamTest.geojson";
+
+    ~test_capigeosgeojsonstream_data()
+    {
+        std::remove(fname_.c_str());
+    }
+};
+
+typedef test_group<test_capigeosgeojsonstream_data> group;
+typedef group::object object;
+
+group test_capigeosgeojsonstream_group("capi::GEOSGeoJSONStream");
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    set_test_name("write and read back");
+
+    const char* wkts[] = { "POINT (1 2)", "LINESTRING (0 0, 5 5)", "POLYGON ((0 0, 1 0, 1 1, 0 0))" };
+
+    GEOSGeoJSONStreamWriter* writer = GEOSGeoJSONStreamWriter_create(fname_.c_str());
+    ensure(writer != nullptr);
+    for (const char* wkt : wkts) {
+        GEOSGeometry* g = fromWKT(wkt);
+        ensure_equals(GEOSGeoJSONStreamWriter_write(writer, g), 1);
+        GEOSGeom_destroy(g);
+    }
+    ensure_equals(GEOSGeoJSONStreamWriter_finish(writer), 1);
+
+    geom1_ = fromWKT("POINT (0 0)");
+    ensure_equals(GEOSGeoJSONStreamWriter_write(writer, geom1_), 0);
+    GEOSGeoJSONStreamWriter_destroy(writer);
+
+    GEOSGeoJSONStreamReader* reader = GEOSGeoJSONStreamReader_create(fname_.c_str());
+    ensure(reader != nullptr);
+    for (const char* wkt : wkts) {
+        GEOSGeometry* g = nullptr;
+        ensure_equals(GEOSGeoJSONStreamReader_next(reader, &g), 1);
+        GEOSGeometry* expected = fromWKT(wkt);
+        ensure_geometry_equals(g, expected);
+        GEOSGeom_destroy(g);
+        GEOSGeom_destroy(expected);
+    }
+    GEOSGeometry* g = nullptr;
+    ensure_equals(GEOSGeoJSONStreamReader_next(reader, &g), 0);
+    ensure(g == nullptr);
+    GEOSGeoJSONStreamReader_destroy(reader);
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    set_test_name("invalid input");
+
+    ensure(GEOSGeoJSONStreamReader_create("does-not-exist.geojson") == nullptr);
+
+    {
+        std::ofstream f(fname_);
+        f << R"({"type":"FeatureCollection","features":[{"type":"Feature","geometry":{"type":"Point","coordinates":[1,1]}},{"type":)";
+    }
+
+    GEOSGeoJSONStreamReader* reader = GEOSGeoJSONStreamReader_create(fname_.c_str());
+    ensure(reader != nullptr);
+    GEOSGeometry* g = nullptr;
+    ensure_equals(GEOSGeoJSONStreamReader_next(reader, &g), 1);
+    GEOSGeom_destroy(g);
+    ensure_equals(GEOSGeoJSONStreamReader_next(reader, &g), 2);
+    GEOSGeoJSONStreamReader_destroy(reader);
+}
+
+} // namespace tut
@@ -0,0 +1,57 @@
+//
+// Test Suite for C-API GEOSGeom_transformAffine
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+struct test_capi_geosgeom_transformaffine : public capitest::utility {};
+
+typedef test_group<test_capi_geosgeom_transformaffine> group;
+typedef group::object object;
+
+group test_capi_geosgeom_transformaffine_group("capi::GEOSGeom_transformAffine");
+
+template <>
+template <>
+void object::test<1>() {
+    set_test_name("identity and translation");
+
+    input_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (1 1, 2 1, 2 2, 1 1))");
+
+    result_ = GEOSGeom_transformAffine(input_, 1, 0, 0, 1, 0, 0);
+    ensure_equals(GEOSEqualsExact(result_, input_, 0), 1);
+    GEOSGeom_destroy(result_);
+
+    result_ = GEOSGeom_transformAffine(input_, 1, 0, 0, 1, 5, -5);
+    expected_ = fromWKT("POLYGON ((5 -5, 15 -5, 15 5, 5 5, 5 -5), (6 -4, 7 -4, 7 -3, 6 -4))");
+    ensure_geometry_equals_identical(result_, expected_);
+
+    // the envelope is recomputed
+    GEOSGeometry* env = GEOSEnvelope(result_);
+    double xmin;
+    GEOSGeom_getXMin(env, &xmin);
+    ensure_equals(xmin, 5.0);
+    GEOSGeom_destroy(env);
+}
+
+template <>
+template <>
+void object::test<2>() {
+    set_test_name("rotation and shear keep Z and M");
+
+    input_ = fromWKT("GEOMETRYCOLLECTION (POINT ZM (1 2 3 4), LINESTRING Z (0 0 7, 1 1 8, 2 0 9), POINT EMPTY)");
+
+    // x' = -y, y' = x + 2y
+    result_ = GEOSGeom_transformAffine(input_, 0, -1, 1, 2, 0, 0);
+    expected_ = fromWKT("GEOMETRYCOLLECTION (POINT ZM (-2 5 3 4), LINESTRING Z (0 0 7, -1 3 8, 0 2 9), POINT EMPTY)");
+    ensure_equals(GEOSGetNumGeometries(result_), 3);
+    for (int i = 0; i < 3; i++) {
+        ensure_geometry_equals_identical(GEOSGetGeometryN(result_, i), GEOSGetGeometryN(expected_, i));
+    }
+}
+
+} // namespace tut
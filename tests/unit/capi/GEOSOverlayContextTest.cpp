@@ -0,0 +1,98 @@
+//
+// Test Suite for C-API GEOSOverlayContext_*
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used in test cases.
+struct test_capigeosoverlaycontext_data : public capitest::utility
+{
+    GEOSOverlayContext* context_;
+
+    test_capigeosoverlaycontext_data()
+        : context_(GEOSOverlayContext_create())
+    {
+    }
+
+    ~test_capigeosoverlaycontext_data()
+    {
+        GEOSOverlayContext_destroy(context_);
+    }
+};
+
+typedef test_group<test_capigeosoverlaycontext_data> group;
+typedef group::object object;
+
+group test_capigeosoverlaycontext_group("capi::GEOSOverlayContext");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    ensure(context_ != nullptr);
+
+    geom1_ = fromWKT("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    GEOSSetSRID(geom1_, 4326);
+
+    for (int i = 0; i < 10; i++) {
+        GEOSGeometry* tile = fromWKT("POLYGON ((5 5, 5 15, 15 15, 15 5, 5 5))");
+        GEOSGeometry* result = GEOSOverlayContext_intersection(context_, geom1_, tile);
+        ensure(result != nullptr);
+        ensure_geometry_equals(result, "POLYGON ((5 10, 10 10, 10 5, 5 5, 5 10))");
+        ensure_equals(GEOSGetSRID(result), 4326);
+        GEOSGeom_destroy(result);
+        GEOSGeom_destroy(tile);
+    }
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    geom1_ = fromWKT("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    geom2_ = fromWKT("POLYGON ((5 0, 5 10, 15 10, 15 0, 5 0))");
+
+    GEOSGeometry* expected = GEOSDifference(geom1_, geom2_);
+    geom3_ = GEOSOverlayContext_difference(context_, geom1_, geom2_);
+    ensure_geometry_equals_identical(geom3_, expected);
+    GEOSGeom_destroy(expected);
+    GEOSGeom_destroy(geom3_);
+
+    expected = GEOSUnion(geom1_, geom2_);
+    geom3_ = GEOSOverlayContext_union(context_, geom1_, geom2_);
+    ensure_geometry_equals_identical(geom3_, expected);
+    GEOSGeom_destroy(expected);
+    GEOSGeom_destroy(geom3_);
+
+    expected = GEOSSymDifference(geom1_, geom2_);
+    geom3_ = GEOSOverlayContext_symDifference(context_, geom1_, geom2_);
+    ensure_geometry_equals_identical(geom3_, expected);
+    GEOSGeom_destroy(expected);
+}
+
+// Collections are handled as by GEOSIntersection
+template<>
+template<>
+void object::test<3>
+()
+{
+    geom1_ = fromWKT("GEOMETRYCOLLECTION (POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0)), LINESTRING (20 0, 20 10))");
+    geom2_ = fromWKT("POLYGON ((5 -5, 5 15, 25 15, 25 -5, 5 -5))");
+
+    geom3_ = GEOSOverlayContext_intersection(context_, geom1_, geom2_);
+    GEOSGeometry* expected = GEOSIntersection(geom1_, geom2_);
+    ensure_geometry_equals_identical(geom3_, expected);
+    GEOSGeom_destroy(expected);
+}
+
+} // namespace tut
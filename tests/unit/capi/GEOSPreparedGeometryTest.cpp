@@ -9,6 +9,7 @@
 #include <geos/geom/GeometryFactory.h>
 // std
 #include <memory>
+#include <vector>
 
 #include "capi_test_utils.h"
 
@@ -568,5 +569,68 @@ void object::test<19>()
     ensure(str_);
 }
 
+template<>
+template<>
+void object::test<20>()
+{
+    set_test_name("GEOSPreparedContainsXYBatch and GEOSPreparedIntersectsXYBatch");
+    useContext();
+
+    geom1_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    prepGeom1_ = GEOSPrepare_r(ctxt_, geom1_);
+
+    std::vector<double> x, y;
+    for (int i = 0; i < 500; i++) {
+        x.push_back(-2 + 0.03 * i);
+        y.push_back(i % 11);
+    }
+
+    for (unsigned int numThreads : { 1u, 4u }) {
+        GEOSContext_setThreadCount_r(ctxt_, numThreads);
+
+        std::vector<unsigned char> contains(x.size()), intersects(x.size());
+        ensure_equals(GEOSPreparedContainsXYBatch_r(ctxt_, prepGeom1_, x.data(), y.data(), x.size(), contains.data()), 1);
+        ensure_equals(GEOSPreparedIntersectsXYBatch_r(ctxt_, prepGeom1_, x.data(), y.data(), x.size(), intersects.data()), 1);
+
+        for (std::size_t i = 0; i < x.size(); i++) {
+            ensure_equals(contains[i], GEOSPreparedContainsXY_r(ctxt_, prepGeom1_, x[i], y[i]));
+            ensure_equals(intersects[i], GEOSPreparedIntersectsXY_r(ctxt_, prepGeom1_, x[i], y[i]));
+        }
+    }
+}
+
+template<>
+template<>
+void object::test<21>()
+{
+    set_test_name("GEOSPreparedContainsBatch and GEOSPreparedIntersectsBatch");
+    useContext();
+
+    geom1_ = fromWKT("POLYGON ((0 0, 2 0, 2 8, 8 8, 8 0, 10 0, 10 10, 0 10, 0 0))");
+    geom2_ = fromWKT("CURVEPOLYGON (COMPOUNDCURVE(CIRCULARSTRING (5 1, 6 2, 7 1), (7 1, 5 1)))");
+    geom3_ = fromWKT("LINESTRING (1 1, 1 9)");
+
+    prepGeom1_ = GEOSPrepare_r(ctxt_, geom1_);
+
+    const GEOSGeometry* geoms[] = { geom3_, geom2_ };
+    unsigned char result[2];
+
+    // curved input without curve-to-line params
+    ensure_equals(GEOSPreparedContainsBatch_r(ctxt_, prepGeom1_, geoms, 2, result), 0);
+
+    GEOSContext_setCurveToLineParams_r(ctxt_, curveToLineParams_);
+    GEOSContext_setThreadCount_r(ctxt_, 2);
+
+    ensure_equals(GEOSPreparedContainsBatch_r(ctxt_, prepGeom1_, geoms, 2, result), 1);
+    ensure_equals(result[0], 1);
+    ensure_equals(result[1], 0);
+
+    ensure_equals(GEOSPreparedIntersectsBatch_r(ctxt_, prepGeom1_, geoms, 2, result), 1);
+    ensure_equals(result[0], 1);
+    ensure_equals(result[1], 0);
+
+    ensure_equals(GEOSPreparedIntersectsBatch_r(ctxt_, prepGeom1_, geoms, 0, result), 1);
+}
+
 } // namespace tut
 
@@ -8,8 +8,10 @@
 // std
 #include <cstdio>
 #include <cstring>
+#include <algorithm>
 #include <cmath>
 #include <thread>
+#include <vector>
 
 #include "capi_test_utils.h"
 
@@ -515,6 +517,53 @@ void object::test<15>()
     ensure(tree == nullptr);
 }
 
+template<>
+template<>
+void object::test<16>()
+{
+    set_test_name("GEOSSTRtree_queryBatch");
+    useContext();
+
+    GEOSContext_setThreadCount_r(ctxt_, 3);
+
+    GEOSSTRtree* tree = GEOSSTRtree_create_r(ctxt_, 4);
+    std::vector<std::size_t> ids(100);
+    for (std::size_t i = 0; i < ids.size(); i++) {
+        ids[i] = i;
+        GEOSGeometry* pt = GEOSGeom_createPointFromXY_r(ctxt_, static_cast<double>(i % 10), static_cast<double>(i / 10));
+        GEOSSTRtree_insert_r(ctxt_, tree, pt, &ids[i]);
+        GEOSGeom_destroy_r(ctxt_, pt);
+    }
+    ensure_equals(GEOSSTRtree_build_r(ctxt_, tree), 1);
+
+    double xmin[] = { 0.5, 20, 8.5 };
+    double ymin[] = { 0.5, 20, 8.5 };
+    double xmax[] = { 2.5, 30, 20 };
+    double ymax[] = { 1.5, 30, 20 };
+
+    std::size_t* offsets = nullptr;
+    void** items = nullptr;
+    ensure_equals(GEOSSTRtree_queryBatch_r(ctxt_, tree, xmin, ymin, xmax, ymax, 3, &offsets, &items), 1);
+
+    ensure_equals(offsets[0], 0u);
+    ensure_equals(offsets[1], 2u);
+    ensure_equals(offsets[2], 2u);
+    ensure_equals(offsets[3], 3u);
+
+    std::vector<std::size_t> found;
+    for (std::size_t i = 0; i < offsets[3]; i++) {
+        found.push_back(*static_cast<std::size_t*>(items[i]));
+    }
+    std::sort(found.begin(), found.begin() + 2);
+    ensure_equals(found[0], 11u);
+    ensure_equals(found[1], 12u);
+    ensure_equals(found[2], 99u);
+
+    GEOSFree_r(ctxt_, offsets);
+    GEOSFree_r(ctxt_, items);
+    GEOSSTRtree_destroy_r(ctxt_, tree);
+}
+
 
 
 } // namespace tut
@@ -0,0 +1,143 @@
+//
+// Test Suite for C-API GEOSSpatialJoin
+
+#include <tut/tut.hpp>
+// geos
+#include <geos_c.h>
+
+#include "capi_test_utils.h"
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_capigeosspatialjoin_data : public capitest::utility {
+    std::vector<GEOSGeometry*> left;
+    std::vector<GEOSGeometry*> right;
+
+    ~test_capigeosspatialjoin_data()
+    {
+        for (auto* g : left) {
+            GEOSGeom_destroy(g);
+        }
+        for (auto* g : right) {
+            GEOSGeom_destroy(g);
+        }
+    }
+};
+
+typedef test_group<test_capigeosspatialjoin_data> group;
+typedef group::object object;
+
+group test_capigeosspatialjoin_group("capi::GEOSSpatialJoin");
+
+template<>
+template<>
+void object::test<1>()
+{
+    set_test_name("intersects and dwithin");
+
+    left.push_back(fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))"));
+    left.push_back(fromWKT("POINT (20 20)"));
+    right.push_back(fromWKT("POINT (30 30)"));
+    right.push_back(fromWKT("LINESTRING (5 5, 25 25)"));
+    right.push_back(fromWKT("POINT (5 5)"));
+
+    size_t* li = nullptr;
+    size_t* ri = nullptr;
+    size_t n = 0;
+
+    ensure_equals(GEOSSpatialJoin(left.data(), left.size(), right.data(), right.size(),
+                                  GEOS_JOIN_INTERSECTS, 0, nullptr, &li, &ri, &n), 1);
+    ensure_equals(n, 3u);
+    ensure_equals(li[0], 0u);
+    ensure_equals(ri[0], 1u);
+    ensure_equals(li[1], 0u);
+    ensure_equals(ri[1], 2u);
+    ensure_equals(li[2], 1u);
+    ensure_equals(ri[2], 1u);
+    GEOSFree(li);
+    GEOSFree(ri);
+
+    ensure_equals(GEOSSpatialJoin(left.data(), left.size(), right.data(), right.size(),
+                                  GEOS_JOIN_DWITHIN, 15, nullptr, &li, &ri, &n), 1);
+    ensure_equals(n, 4u);
+    ensure_equals(li[3], 1u);
+    ensure_equals(ri[3], 1u);
+    ensure_equals(li[2], 1u);
+    ensure_equals(ri[2], 0u);
+    GEOSFree(li);
+    GEOSFree(ri);
+}
+
+template<>
+template<>
+void object::test<2>()
+{
+    set_test_name("relate pattern on multiple threads");
+
+    useContext();
+    GEOSContext_setThreadCount_r(ctxt_, 4);
+
+    for (int i = 0; i < 50; i++) {
+        for (int j = 0; j < 50; j++) {
+            left.push_back(GEOSGeom_createPointFromXY_r(ctxt_, i + 0.5, j + 0.5));
+        }
+    }
+    for (int i = 0; i < 5; i++) {
+        right.push_back(GEOSGeom_createRectangle_r(ctxt_, i * 10, 0, i * 10 + 5, 50));
+    }
+
+    size_t* li = nullptr;
+    size_t* ri = nullptr;
+    size_t n = 0;
+
+    ensure_equals(GEOSSpatialJoin_r(ctxt_, left.data(), left.size(), right.data(), right.size(),
+                                    GEOS_JOIN_RELATE_PATTERN, 0, "T*F**F***", &li, &ri, &n), 1);
+    ensure_equals(n, 5u * 5u * 50u);
+    for (size_t k = 0; k < n; k++) {
+        size_t i = li[k] / 50;
+        ensure_equals(ri[k], i / 10);
+        ensure(i % 10 < 5);
+        if (k > 0) {
+            ensure(li[k] > li[k - 1]);
+        }
+    }
+    GEOSFree_r(ctxt_, li);
+    GEOSFree_r(ctxt_, ri);
+
+    for (auto* g : left) {
+        GEOSGeom_destroy_r(ctxt_, g);
+    }
+    for (auto* g : right) {
+        GEOSGeom_destroy_r(ctxt_, g);
+    }
+    left.clear();
+    right.clear();
+}
+
+template<>
+template<>
+void object::test<3>()
+{
+    set_test_name("invalid arguments");
+
+    left.push_back(fromWKT("POINT (0 0)"));
+    right.push_back(fromWKT("POINT (0 0)"));
+
+    size_t* li = nullptr;
+    size_t* ri = nullptr;
+    size_t n = 0;
+
+    ensure_equals(GEOSSpatialJoin(left.data(), left.size(), right.data(), right.size(),
+                                  99, 0, nullptr, &li, &ri, &n), 0);
+    ensure_equals(GEOSSpatialJoin(left.data(), left.size(), right.data(), right.size(),
+                                  GEOS_JOIN_RELATE_PATTERN, 0, nullptr, &li, &ri, &n), 0);
+    ensure_equals(GEOSSpatialJoin(left.data(), left.size(), right.data(), right.size(),
+                                  GEOS_JOIN_RELATE_PATTERN, 0, "FF*FF****", &li, &ri, &n), 0);
+    ensure_equals(GEOSSpatialJoin(left.data(), left.size(), right.data(), right.size(),
+                                  GEOS_JOIN_DWITHIN, -1, nullptr, &li, &ri, &n), 0);
+}
+
+} // namespace tut
@@ -7,6 +7,7 @@
 // std
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include "capi_test_utils.h"
 
@@ -21,6 +22,27 @@ struct test_capiunaryunion_data : public capitest::utility {
     test_capiunaryunion_data() {
     }
 
+    // Collection of overlapping discs on a grid
+    GEOSGeometry*
+    createDiscs(int num, double radius)
+    {
+        std::vector<GEOSGeometry*> discs;
+        for (int i = 0; i < num; i++) {
+            for (int j = 0; j < num; j++) {
+                GEOSGeometry* pt = GEOSGeom_createPointFromXY_r(ctxt_, i, j);
+                discs.push_back(GEOSBuffer_r(ctxt_, pt, radius, 8));
+                GEOSGeom_destroy_r(ctxt_, pt);
+            }
+        }
+        return GEOSGeom_createCollection_r(ctxt_, GEOS_MULTIPOLYGON, discs.data(), static_cast<unsigned int>(discs.size()));
+    }
+
+    static int
+    interruptAfterMaxCalls(void* data)
+    {
+        return ++*static_cast<int*>(data) >= 50;
+    }
+
 };
 
 typedef test_group<test_capiunaryunion_data> group;
@@ -333,6 +355,51 @@ void object::test<17>()
     ensure_geometry_equals(result_, input_, 1e-8);
 }
 
-} // namespace tut
+template<>
+template<>
+void object::test<18>()
+{
+    set_test_name("union using multiple threads matches sequential union");
+    useContext();
+
+    input_ = createDiscs(12, 0.7);
+    expected_ = GEOSUnaryUnion_r(ctxt_, input_);
+
+    std::vector<double> fracs;
+    auto progress = [](double f, const char*, void* userData) {
+        static_cast<std::vector<double>*>(userData)->push_back(f);
+    };
+    GEOSContext_setProgressCallback_r(ctxt_, progress, &fracs);
+
+    ensure_equals(GEOSContext_setThreadCount_r(ctxt_, 4), 1u);
+    result_ = GEOSUnaryUnion_r(ctxt_, input_);
+    ensure(result_);
 
+    ensure_equals(fracs.size(), 144u);
+    ensure(std::is_sorted(fracs.begin(), fracs.end()));
+    ensure_equals(fracs.back(), 1.0);
 
+    ensure_equals(GEOSEqualsExact_r(ctxt_, result_, expected_, 0), 1);
+
+    ensure_equals(GEOSContext_setThreadCount_r(ctxt_, 1), 4u);
+}
+
+template<>
+template<>
+void object::test<19>()
+{
+    set_test_name("context interrupt callback stops a multithreaded union");
+    useContext();
+
+    input_ = createDiscs(12, 0.7);
+
+    int numCalls = 0;
+    GEOSContext_setInterruptCallback_r(ctxt_, interruptAfterMaxCalls, &numCalls);
+    GEOSContext_setThreadCount_r(ctxt_, 4);
+
+    result_ = GEOSUnaryUnion_r(ctxt_, input_);
+    ensure(result_ == nullptr);
+    ensure(numCalls >= 50);
+}
+
+} // namespace tut
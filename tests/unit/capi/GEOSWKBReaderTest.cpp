@@ -4,6 +4,9 @@
 
 #include "capi_test_utils.h"
 
+#include <string>
+#include <vector>
+
 namespace tut {
 //
 // Test Group
@@ -70,5 +73,43 @@ void object::test<2>()
     ensure_geometry_equals(geom1_, expected_);
 }
 
+template<>
+template<>
+void object::test<3>()
+{
+    set_test_name("GEOSWKBReader_readBatch");
+
+    // POINT (3 8), POLYGON ((0 0, 1 0, 1 1, 0 1)) <-- not closed
+    std::vector<std::string> hex = {
+        "010100000000000000000008400000000000002040",
+        "0103000000010000000400000000000000000000000000000000000000000000000000f03f0000000000000000000000000000f03f000000000000f03f0000000000000000000000000000f03f"
+    };
+    std::vector<std::vector<unsigned char>> wkbs;
+    for (const auto& h : hex) {
+        std::vector<unsigned char> wkb;
+        for (std::size_t i = 0; i < h.size(); i += 2) {
+            wkb.push_back(static_cast<unsigned char>(std::stoi(h.substr(i, 2), nullptr, 16)));
+        }
+        wkbs.push_back(wkb);
+    }
+    const unsigned char* bufs[] = { wkbs[0].data(), wkbs[1].data() };
+    std::size_t sizes[] = { wkbs[0].size(), wkbs[1].size() };
+    GEOSGeometry* results[2] = { nullptr, nullptr };
+
+    ensure_equals(GEOSWKBReader_readBatch(wkbreader_, bufs, sizes, 2, results), 0);
+    ensure(results[0] == nullptr);
+
+    GEOSWKBReader_setFixStructure(wkbreader_, 1);
+    ensure_equals(GEOSWKBReader_readBatch(wkbreader_, bufs, sizes, 2, results), 1);
+    geom1_ = results[0];
+    geom2_ = results[1];
+
+    expected_ = fromWKT("POINT (3 8)");
+    ensure_geometry_equals(geom1_, expected_);
+    GEOSGeom_destroy(expected_);
+    expected_ = fromWKT("POLYGON ((0 0, 1 0, 1 1, 0 1, 0 0))");
+    ensure_geometry_equals(geom2_, expected_);
+}
+
 } // namespace tut
 
@@ -5,6 +5,9 @@
 
 #include "capi_test_utils.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace tut {
 //
 // Test Group
@@ -186,5 +189,30 @@ void object::test<9>()
     ensure_equals(hexstr, "010100008000000000000008400000000000002040000000000000F03F");
 }
 
+template<>
+template<>
+void object::test<10>()
+{
+    set_test_name("GEOSWKBWriter_writeToBuffer");
+
+    geom1_ = fromWKT("MULTILINESTRING Z ((0 0 1, 1 1 2), (2 2 3, 3 3 4, 4 4 5))");
+
+    std::size_t wkb_size = 0;
+    buf_ = GEOSWKBWriter_write(wkbwriter_, geom1_, &wkb_size);
+
+    std::size_t size = 0;
+    ensure_equals(GEOSWKBWriter_getWKBSize(wkbwriter_, geom1_, &size), 1);
+    ensure_equals(size, wkb_size);
+
+    std::vector<unsigned char> out(size);
+    std::size_t written = 0;
+    ensure_equals(GEOSWKBWriter_writeToBuffer(wkbwriter_, geom1_, out.data(), out.size(), &written), 1);
+    ensure_equals(written, size);
+    ensure(std::equal(out.begin(), out.end(), buf_));
+
+    // buffer too small
+    ensure_equals(GEOSWKBWriter_writeToBuffer(wkbwriter_, geom1_, out.data(), size - 1, &written), 0);
+}
+
 } // namespace tut
 
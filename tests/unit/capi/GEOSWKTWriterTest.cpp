@@ -162,5 +162,35 @@ void object::test<7>()
 
 }
 
+template<>
+template<>
+void object::test<8>()
+{
+    set_test_name("GEOSWKTWriter_writeBatch");
+
+    geom1_ = fromWKT("POINT (1 2)");
+    geom2_ = fromWKT("LINESTRING (0 0, 1.5 1)");
+    geom3_ = fromWKT("POLYGON EMPTY");
+    const GEOSGeometry* geoms[] = { geom1_, geom2_, geom3_ };
+
+    std::size_t offsets[3];
+    std::size_t size = 0;
+    char* wkt = GEOSWKTWriter_writeBatch(wktwriter_, geoms, 3, offsets, &size);
+    ensure(wkt != nullptr);
+
+    ensure_equals(std::string(wkt + offsets[0]), "POINT (1 2)");
+    ensure_equals(std::string(wkt + offsets[1]), "LINESTRING (0 0, 1.5 1)");
+    ensure_equals(std::string(wkt + offsets[2]), "POLYGON EMPTY");
+    ensure_equals(size, offsets[2] + std::string("POLYGON EMPTY").size() + 1);
+    ensure_equals(wkt[size - 1], '\0');
+
+    GEOSFree(wkt);
+
+    wkt = GEOSWKTWriter_writeBatch(wktwriter_, geoms, 0, offsets, &size);
+    ensure(wkt != nullptr);
+    ensure_equals(size, std::size_t(0));
+    GEOSFree(wkt);
+}
+
 } // namespace tut
 
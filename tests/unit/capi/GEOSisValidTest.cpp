@@ -79,4 +79,34 @@ void object::test<5>()
     ensure_equals(GEOSisValid_r(ctxt_, input_), 1);
 }
 
+template<>
+template<>
+void object::test<6>()
+{
+    set_test_name("GEOSisValidBatch");
+    useContext();
+
+    geom1_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    geom2_ = fromWKT("POLYGON ((0 0, 1 0, 0 1, 1 1, 0 0))");
+    // inverted shell
+    geom3_ = fromWKT("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0, 2 5, 5 2, 0 0))");
+
+    const GEOSGeometry* geoms[] = { geom1_, geom2_, geom3_ };
+    unsigned char result[3];
+
+    for (unsigned int numThreads : { 1u, 3u }) {
+        GEOSContext_setThreadCount_r(ctxt_, numThreads);
+
+        ensure_equals(GEOSisValidBatch_r(ctxt_, geoms, 3, 0, result), 1);
+        ensure_equals(result[0], 1);
+        ensure_equals(result[1], 0);
+        ensure_equals(result[2], 0);
+
+        ensure_equals(GEOSisValidBatch_r(ctxt_, geoms, 3, GEOSVALID_ALLOW_SELFTOUCHING_RING_FORMING_HOLE, result), 1);
+        ensure_equals(result[0], 1);
+        ensure_equals(result[1], 0);
+        ensure_equals(result[2], 1);
+    }
+}
+
 } // namespace tut
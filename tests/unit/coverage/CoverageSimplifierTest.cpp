@@ -8,10 +8,14 @@
 #include <geos/coverage/CoverageSimplifier.h>
 #include <geos/geom/Polygon.h> // Added for Polygon
 #include <geos/geom/SimpleCurve.h> // Added for SimpleCurve
+#include <geos/coverage/CoverageValidator.h>
+#include <geos/util/TaskPool.h>
 
+#include <cmath>
 
 
 using geos::coverage::CoverageSimplifier;
+using geos::coverage::CoverageValidator;
 
 namespace tut {
 //
@@ -92,6 +96,47 @@ struct test_coveragesimplifier_data {
         }
     }
 
+    // WKT of a square grid of polygons whose shared edges
+    // have the same wavy vertices
+    static std::vector<std::string>
+    gridCoverage(int size, int numSegs)
+    {
+        auto wave = [](double x, double y) {
+            return 0.05 * std::sin(13 * x + 7 * y);
+        };
+        //-- grid nodes are not moved, other vertices move across their edge
+        auto point = [&](double x, double y, bool isNode, bool isHorizontal) {
+            if (!isNode && isHorizontal)
+                y += wave(x, y);
+            else if (!isNode)
+                x += wave(x, y);
+            return std::to_string(x) + " " + std::to_string(y);
+        };
+        std::vector<std::string> wkts;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                std::vector<std::string> pts;
+                for (int t = 0; t < numSegs; t++)
+                    pts.push_back(point(i + double(t) / numSegs, j, t == 0, true));
+                for (int t = 0; t < numSegs; t++)
+                    pts.push_back(point(i + 1, j + double(t) / numSegs, t == 0, false));
+                for (int t = numSegs; t > 0; t--)
+                    pts.push_back(point(i + double(t) / numSegs, j + 1, t == numSegs, true));
+                for (int t = numSegs; t > 0; t--)
+                    pts.push_back(point(i, j + double(t) / numSegs, t == numSegs, false));
+                pts.push_back(pts.front());
+
+                std::string wkt = "POLYGON ((";
+                for (std::size_t k = 0; k < pts.size(); k++) {
+                    if (k > 0) wkt += ", ";
+                    wkt += pts[k];
+                }
+                wkts.push_back(wkt + "))");
+            }
+        }
+        return wkts;
+    }
+
 };
 
 
@@ -530,4 +575,57 @@ void object::test<32> ()
 }
 
 
+// Parallel simplification gives the sequential result
+template<>
+template<>
+void object::test<33> ()
+{
+    auto input = readArray(gridCoverage(30, 8));
+    std::vector<const Geometry*> coverage;
+    std::size_t numInputPts = 0;
+    for (const auto& g : input) {
+        coverage.push_back(g.get());
+        numInputPts += g->getNumPoints();
+    }
+
+    CoverageSimplifier simp0(coverage);
+    auto result0 = simp0.simplify(0.1, nullptr);
+
+    geos::util::TaskPool pool1(1);
+    CoverageSimplifier simp1(coverage);
+    simp1.setTaskPool(&pool1);
+    auto result1 = simp1.simplify(0.1, nullptr);
+
+    geos::util::TaskPool pool3(3);
+    CoverageSimplifier simp3(coverage);
+    simp3.setTaskPool(&pool3);
+    auto result3 = simp3.simplify(0.1, nullptr);
+
+    ensure_equals(result3.size(), input.size());
+    std::vector<const Geometry*> simplified;
+    std::size_t numResultPts = 0;
+    for (std::size_t i = 0; i < result3.size(); i++) {
+        ensure(result0[i]->equalsExact(result1[i].get()));
+        ensure(result0[i]->equalsExact(result3[i].get()));
+        simplified.push_back(result3[i].get());
+        numResultPts += result3[i]->getNumPoints();
+    }
+    ensure(numResultPts < numInputPts);
+    ensure(CoverageValidator::isValid(simplified));
+
+    CoverageSimplifier simpInner0(coverage);
+    auto resultInner0 = simpInner0.simplifyInner(0.1, nullptr);
+
+    CoverageSimplifier simpInner(coverage);
+    simpInner.setTaskPool(&pool3);
+    auto resultInner = simpInner.simplifyInner(0.1, nullptr);
+    simplified.clear();
+    for (std::size_t i = 0; i < resultInner.size(); i++) {
+        ensure(resultInner0[i]->equalsExact(resultInner[i].get()));
+        simplified.push_back(resultInner[i].get());
+    }
+    ensure(CoverageValidator::isValid(simplified));
+}
+
+
 } // namespace tut
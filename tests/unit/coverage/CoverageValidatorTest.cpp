@@ -7,6 +7,9 @@
 // geos
 #include <geos/coverage/CoverageValidator.h>
 #include <geos/geom/util/PolygonExtracter.h>
+#include <geos/util/TaskPool.h>
+
+#include <cmath>
 
 using geos::geom::util::PolygonExtracter;
 using geos::coverage::CoverageValidator;
@@ -122,6 +125,47 @@ struct test_coveragevalidator_data {
         ensure( isValid );
     }
 
+    // WKT of a square grid of polygons whose shared edges
+    // have the same wavy vertices
+    static std::vector<std::string>
+    gridCoverage(int size, int numSegs)
+    {
+        auto wave = [](double x, double y) {
+            return 0.05 * std::sin(13 * x + 7 * y);
+        };
+        //-- grid nodes are not moved, other vertices move across their edge
+        auto point = [&](double x, double y, bool isNode, bool isHorizontal) {
+            if (!isNode && isHorizontal)
+                y += wave(x, y);
+            else if (!isNode)
+                x += wave(x, y);
+            return std::to_string(x) + " " + std::to_string(y);
+        };
+        std::vector<std::string> wkts;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                std::vector<std::string> pts;
+                for (int t = 0; t < numSegs; t++)
+                    pts.push_back(point(i + double(t) / numSegs, j, t == 0, true));
+                for (int t = 0; t < numSegs; t++)
+                    pts.push_back(point(i + 1, j + double(t) / numSegs, t == 0, false));
+                for (int t = numSegs; t > 0; t--)
+                    pts.push_back(point(i + double(t) / numSegs, j + 1, t == numSegs, true));
+                for (int t = numSegs; t > 0; t--)
+                    pts.push_back(point(i, j + double(t) / numSegs, t == numSegs, false));
+                pts.push_back(pts.front());
+
+                std::string wkt = "POLYGON ((";
+                for (std::size_t k = 0; k < pts.size(); k++) {
+                    if (k > 0) wkt += ", ";
+                    wkt += pts[k];
+                }
+                wkts.push_back(wkt + "))");
+            }
+        }
+        return wkts;
+    }
+
     std::vector<std::unique_ptr<Geometry>>
     readList(const std::vector<std::string> &wkt_geoms)
     {
@@ -349,7 +393,33 @@ void object::test<15> ()
     checkValid(coverage);
 }
 
-
-
+// Parallel validation gives the same result
+template<>
+template<>
+void object::test<16> ()
+{
+    std::vector<std::string> wkts = gridCoverage(30, 4);
+    wkts[100] = "POLYGON ((3.3 10.2, 4.6 10.2, 4.6 11.4, 3.3 11.4, 3.3 10.2))";
+    wkts[500] = "POLYGON ((16.5 20.5, 17.5 20.5, 17.5 21.5, 16.5 21.5, 16.5 20.5))";
+    std::vector<std::unique_ptr<Geometry>> geoms = readList(wkts);
+    std::vector<const Geometry*> coverage = toCoverage(geoms);
+
+    auto expected = CoverageValidator::validate(coverage, 0.01);
+    ensure(CoverageValidator::hasInvalidResult(expected));
+
+    geos::util::TaskPool pool(3);
+    CoverageValidator validator(coverage);
+    validator.setGapWidth(0.01);
+    validator.setTaskPool(&pool);
+    auto actual = validator.validate();
+
+    ensure_equals(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); i++) {
+        ensure_equals(actual[i] == nullptr, expected[i] == nullptr);
+        if (actual[i] != nullptr) {
+            ensure(actual[i]->equalsExact(expected[i].get()));
+        }
+    }
+}
 
 } // namespace tut
@@ -0,0 +1,196 @@
+//
+// Test Suite for geos::coverage::TiledCoverageUnion class.
+
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/coverage/CoverageUnion.h>
+#include <geos/coverage/TiledCoverageUnion.h>
+#include <geos/geom/Envelope.h>
+#include <geos/io/WKBStreamReader.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/util/IllegalArgumentException.h>
+
+// std
+#include <sstream>
+
+using geos::coverage::CoverageUnion;
+using geos::coverage::TiledCoverageUnion;
+using geos::geom::Envelope;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_tiledcoverageunion_data {
+
+    WKTReader r;
+    std::vector<std::unique_ptr<Geometry>> geoms;
+
+    // A size by size grid of unit squares, omitting the cells
+    // inside the given hole
+    void
+    gridCoverage(int size, const Envelope& hole)
+    {
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                if (hole.contains(i + 0.5, j + 0.5))
+                    continue;
+                std::ostringstream wkt;
+                wkt << "POLYGON ((" << i << " " << j << ", " << i + 1 << " " << j << ", "
+                    << i + 1 << " " << j + 1 << ", " << i << " " << j + 1 << ", "
+                    << i << " " << j << "))";
+                geoms.push_back(r.read(wkt.str()));
+            }
+        }
+    }
+
+    std::unique_ptr<Geometry>
+    expectedUnion()
+    {
+        std::vector<const Geometry*> coverage;
+        for (const auto& g : geoms) {
+            coverage.push_back(g.get());
+        }
+        return CoverageUnion::Union(coverage);
+    }
+
+    void
+    checkEqual(std::unique_ptr<Geometry>& actual, std::unique_ptr<Geometry>& expected)
+    {
+        ensure_equals(actual->getArea(), expected->getArea());
+        ensure(actual->equals(expected.get()));
+    }
+};
+
+typedef test_group<test_tiledcoverageunion_data> group;
+typedef group::object object;
+
+group test_tiledcoverageunion_group("geos::coverage::TiledCoverageUnion");
+
+// Tiled union gives the same result as the coverage union
+template<>
+template<>
+void object::test<1> ()
+{
+    gridCoverage(20, Envelope(7, 13, 3, 9));
+    auto expected = expectedUnion();
+
+    TiledCoverageUnion tcu(Envelope(0, 20, 0, 20), 4);
+    for (const auto& g : geoms) {
+        tcu.add(*g);
+    }
+    auto actual = tcu.getResult();
+    checkEqual(actual, expected);
+    ensure_equals(actual->getGeometryTypeId(), geos::geom::GEOS_POLYGON);
+    ensure_equals(static_cast<const Polygon*>(actual.get())->getNumInteriorRing(), 1u);
+}
+
+// Polygons spilled to a stream and read from a WKB stream
+template<>
+template<>
+void object::test<2> ()
+{
+    gridCoverage(25, Envelope(2, 5, 2, 5));
+    geoms.push_back(r.read("MULTIPOLYGON (((30 0, 31 0, 31 1, 30 1, 30 0)), ((30 2, 31 2, 31 3, 30 3, 30 2)))"));
+    auto expected = expectedUnion();
+
+    std::stringstream input;
+    geos::io::WKBWriter writer;
+    for (const auto& g : geoms) {
+        writer.writeHEX(*g, input);
+        input << std::endl;
+    }
+
+    std::stringstream spill(std::ios::in | std::ios::out | std::ios::binary);
+    geos::io::WKBStreamReader reader(input);
+    TiledCoverageUnion tcu(Envelope(0, 25, 0, 25), 3);
+    tcu.setSpillStream(&spill);
+    tcu.setMemoryLimit(1000);
+    ensure_equals(tcu.add(reader), geoms.size());
+    ensure(spill.tellp() > 0);
+
+    auto actual = tcu.getResult();
+    checkEqual(actual, expected);
+    ensure_equals(actual->getNumGeometries(), 3u);
+}
+
+// Polygons outside the extent are assigned to border tiles
+template<>
+template<>
+void object::test<3> ()
+{
+    gridCoverage(10, Envelope());
+    auto expected = expectedUnion();
+
+    TiledCoverageUnion tcu(Envelope(3, 4, 3, 4), 5);
+    for (const auto& g : geoms) {
+        tcu.add(*g);
+    }
+    auto actual = tcu.getResult();
+    checkEqual(actual, expected);
+}
+
+// Empty and invalid inputs
+template<>
+template<>
+void object::test<4> ()
+{
+    TiledCoverageUnion tcu(Envelope(0, 1, 0, 1), 2);
+    tcu.add(*r.read("POLYGON EMPTY"));
+    auto line = r.read("LINESTRING (0 0, 1 1)");
+    ensure_THROW(tcu.add(*line), geos::util::IllegalArgumentException);
+    auto result = tcu.getResult();
+    ensure(result->isEmpty());
+    ensure_equals(result->getDimension(), geos::geom::Dimension::A);
+
+    ensure_THROW(TiledCoverageUnion(Envelope(0, 1, 0, 1), 0), geos::util::IllegalArgumentException);
+}
+
+
+// Z values and SRID are kept through the spill stream
+template<>
+template<>
+void object::test<5> ()
+{
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 6; j++) {
+            std::ostringstream wkt;
+            wkt << "POLYGON Z ((" << i << " " << j << " " << i + j << ", "
+                << i + 1 << " " << j << " " << i + 1 + j << ", "
+                << i + 1 << " " << j + 1 << " " << i + j + 2 << ", "
+                << i << " " << j + 1 << " " << i + j + 1 << ", "
+                << i << " " << j << " " << i + j << "))";
+            geoms.push_back(r.read(wkt.str()));
+            geoms.back()->setSRID(4326);
+        }
+    }
+    auto expected = expectedUnion();
+
+    std::stringstream spill(std::ios::in | std::ios::out | std::ios::binary);
+    TiledCoverageUnion tcu(Envelope(0, 6, 0, 6), 3);
+    tcu.setSpillStream(&spill);
+    tcu.setMemoryLimit(100);
+    for (const auto& g : geoms) {
+        tcu.add(*g);
+    }
+    ensure(spill.tellp() > 0);
+
+    auto actual = tcu.getResult();
+    checkEqual(actual, expected);
+    ensure(actual->hasZ());
+    ensure_equals(actual->getSRID(), expected->getSRID());
+
+    //-- every vertex keeps its Z value of x + y
+    auto pts = actual->getCoordinates();
+    for (std::size_t i = 0; i < pts->size(); i++) {
+        const auto& p = pts->getAt(i);
+        ensure_equals(p.z, p.x + p.y);
+    }
+}
+
+} // namespace tut
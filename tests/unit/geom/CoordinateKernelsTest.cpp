@@ -0,0 +1,207 @@
+//
+// Test Suite for geos::geom::CoordinateKernels
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/algorithm/Area.h>
+#include <geos/algorithm/Length.h>
+#include <geos/geom/CoordinateKernels.h>
+#include <geos/geom/CoordinateSequence.h>
+// std
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using geos::geom::CoordinateKernels;
+using InstructionSet = geos::geom::CoordinateKernels::InstructionSet;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_coordinatekernels_data {
+    const std::vector<InstructionSet> allSets = {
+        InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::NEON
+    };
+    InstructionSet defaultSet;
+
+    test_coordinatekernels_data()
+        : defaultSet(CoordinateKernels::getInstructionSet())
+    {}
+
+    ~test_coordinatekernels_data()
+    {
+        CoordinateKernels::setInstructionSet(defaultSet);
+    }
+
+    static std::vector<double> randomOrdinates(std::size_t n, std::size_t stride, unsigned seed)
+    {
+        std::mt19937 gen(seed);
+        std::uniform_real_distribution<double> dist(-1000, 1000);
+        std::vector<double> v(n * stride);
+        for (auto& d : v) {
+            d = dist(gen);
+        }
+        return v;
+    }
+
+    static void ensureIdentical(const char* msg, double a, double b)
+    {
+        ensure(msg, std::memcmp(&a, &b, sizeof(double)) == 0 || (std::isnan(a) && std::isnan(b)));
+    }
+};
+
+typedef test_group<test_coordinatekernels_data> group;
+typedef group::object object;
+
+group test_coordinatekernels_group("geos::geom::CoordinateKernels");
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    set_test_name("envelope matches a loop over the coordinates");
+
+    std::vector<double> v = { 3, -0.0, 0.0, 5, -2, 0.0, 7, -0.0, -0.0, 1, 4, 9, 1, 2, -5, 6, 2, 8 };
+    v[6] = std::numeric_limits<double>::quiet_NaN();
+
+    for (InstructionSet is : allSets) {
+        if (!CoordinateKernels::setInstructionSet(is)) {
+            continue;
+        }
+        for (std::size_t n = 0; n <= v.size() / 2; n++) {
+            double minx = std::numeric_limits<double>::infinity();
+            double maxx = -minx, miny = minx, maxy = -minx;
+            for (std::size_t i = 0; i < n; i++) {
+                minx = std::min(minx, v[2 * i]);
+                maxx = std::max(maxx, v[2 * i]);
+                miny = std::min(miny, v[2 * i + 1]);
+                maxy = std::max(maxy, v[2 * i + 1]);
+            }
+            double ext[4];
+            CoordinateKernels::envelope(v.data(), n, 2, ext[0], ext[1], ext[2], ext[3]);
+            ensureIdentical("minx", ext[0], minx);
+            ensureIdentical("maxx", ext[1], maxx);
+            ensureIdentical("miny", ext[2], miny);
+            ensureIdentical("maxy", ext[3], maxy);
+        }
+    }
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    set_test_name("all instruction sets give identical results");
+
+    for (std::size_t stride = 2; stride <= 4; stride++) {
+        for (std::size_t n : std::vector<std::size_t>{ 0, 1, 2, 3, 4, 5, 7, 8, 9, 16, 17, 100, 1001 }) {
+            auto v = randomOrdinates(n, stride, static_cast<unsigned>(n * stride));
+
+            CoordinateKernels::setInstructionSet(InstructionSet::SCALAR);
+            double ext[4];
+            CoordinateKernels::envelope(v.data(), n, stride, ext[0], ext[1], ext[2], ext[3]);
+            double area = CoordinateKernels::signedArea(v.data(), n, stride);
+            double len = CoordinateKernels::length(v.data(), n, stride);
+            double maxY = CoordinateKernels::maxRisingY(v.data(), n, stride);
+            auto transformed = v;
+            CoordinateKernels::affine(transformed.data(), n, stride, 0.5, -2, 3, 0.25, 10, -7);
+
+            for (InstructionSet is : allSets) {
+                if (!CoordinateKernels::setInstructionSet(is)) {
+                    continue;
+                }
+                double ext2[4];
+                CoordinateKernels::envelope(v.data(), n, stride, ext2[0], ext2[1], ext2[2], ext2[3]);
+                for (std::size_t k = 0; k < 4; k++) {
+                    ensureIdentical("envelope", ext2[k], ext[k]);
+                }
+                ensureIdentical("area", CoordinateKernels::signedArea(v.data(), n, stride), area);
+                ensureIdentical("length", CoordinateKernels::length(v.data(), n, stride), len);
+                ensureIdentical("maxRisingY", CoordinateKernels::maxRisingY(v.data(), n, stride), maxY);
+
+                auto transformed2 = v;
+                CoordinateKernels::affine(transformed2.data(), n, stride, 0.5, -2, 3, 0.25, 10, -7);
+                ensure("affine", transformed2 == transformed);
+            }
+        }
+    }
+}
+
+template<>
+template<>
+void object::test<3>
+()
+{
+    set_test_name("known values");
+
+    // XYZ square, clockwise
+    std::vector<double> ring = { 0, 0, 1,  0, 10, 1,  10, 10, 1,  10, 0, 1,  0, 0, 1 };
+    std::vector<double> line = { 0, 0,  3, 4,  3, 4,  6, 8,  6, 0 };
+
+    for (InstructionSet is : allSets) {
+        if (!CoordinateKernels::setInstructionSet(is)) {
+            continue;
+        }
+        ensure_equals(CoordinateKernels::signedArea(ring.data(), 5, 3), 100.0);
+        ensure_equals(CoordinateKernels::length(ring.data(), 5, 3), 40.0);
+        ensure_equals(CoordinateKernels::maxRisingY(ring.data(), 5, 3), 10.0);
+        ensure_equals(CoordinateKernels::length(line.data(), 5, 2), 18.0);
+        ensure_equals(CoordinateKernels::maxRisingY(line.data(), 1, 2), -std::numeric_limits<double>::infinity());
+
+        auto moved = ring;
+        CoordinateKernels::affine(moved.data(), 5, 3, 1, 0, 0, 1, 5, -5);
+        ensure_equals(moved[6], 15.0);
+        ensure_equals(moved[7], 5.0);
+        ensure_equals(moved[8], 1.0);
+    }
+}
+
+template<>
+template<>
+void object::test<4>
+()
+{
+    set_test_name("Area and Length keep a single running sum");
+
+    using geos::geom::CoordinateSequence;
+    using geos::geom::CoordinateXY;
+
+    for (std::size_t n : std::vector<std::size_t>{ 4, 5, 17, 1001 }) {
+        auto v = randomOrdinates(n, 2, static_cast<unsigned>(n));
+        CoordinateSequence seq(n, false, false);
+        for (std::size_t i = 0; i < n; i++) {
+            seq.setAt(CoordinateXY(v[2 * i], v[2 * i + 1]), i);
+        }
+        seq.setAt(seq.getAt<CoordinateXY>(0), n - 1);
+
+        double x0 = seq.getX(0);
+        double area = 0.0;
+        for (std::size_t i = 1; i < n - 1; i++) {
+            area += (seq.getX(i) - x0) * (seq.getY(i - 1) - seq.getY(i + 1));
+        }
+        area /= 2.0;
+
+        double len = 0.0;
+        for (std::size_t i = 1; i < n; i++) {
+            double dx = seq.getX(i) - seq.getX(i - 1);
+            double dy = seq.getY(i) - seq.getY(i - 1);
+            len += std::sqrt(dx * dx + dy * dy);
+        }
+
+        for (InstructionSet is : allSets) {
+            if (!CoordinateKernels::setInstructionSet(is)) {
+                continue;
+            }
+            ensureIdentical("area", geos::algorithm::Area::ofRingSigned(&seq), area);
+            ensureIdentical("length", geos::algorithm::Length::ofLine(&seq), len);
+        }
+    }
+}
+
+} // namespace tut
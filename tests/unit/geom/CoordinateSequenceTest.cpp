@@ -6,6 +6,7 @@
 #include <geos/geom/Coordinate.h>
 #include <geos/geom/CoordinateFilter.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/Envelope.h>
 #include <geos/util.h>
 #include <geos/constants.h>
 #include <utility.h>
@@ -1674,5 +1675,69 @@ void object::test<64>()
     ensure_equals_xyz(seq.getAt<Coordinate>(1), Coordinate(3, 4, DoubleNotANumber));
 }
 
+template<>
+template<>
+void object::test<65>()
+{
+    set_test_name("borrowed sequence is copied on write");
+
+    std::vector<double> values{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    auto seq = CoordinateSequence::borrow(values.data(), 3, true, false);
+    const CoordinateSequence& cseq = seq;
+
+    ensure(seq.isBorrowed());
+    ensure_equals(cseq.size(), 3u);
+    ensure(cseq.hasZ());
+    ensure_not(cseq.hasM());
+    ensure(cseq.data() == values.data());
+    ensure_equals_xyz(cseq.getAt<Coordinate>(1), Coordinate(4, 5, 6));
+    ensure(cseq.getEnvelope() == geos::geom::Envelope(1, 7, 2, 8));
+    ensure(seq.isBorrowed());
+
+    CoordinateSequence copy(seq);
+    ensure_not(copy.isBorrowed());
+    ensure(copy.equalsIdentical(seq));
+
+    CoordinateSequence moved(std::move(seq));
+    ensure(moved.isBorrowed());
+
+    moved.reverse();
+    ensure_not(moved.isBorrowed());
+    ensure_equals_xyz(moved.getAt<Coordinate>(0), Coordinate(7, 8, 9));
+    ensure_equals_xyz(moved.getAt<Coordinate>(2), Coordinate(1, 2, 3));
+    ensure_equals(values[0], 1.0);
+
+    auto seq2 = CoordinateSequence::borrow(values.data(), 3, true, false);
+    seq2.add(CoordinateXY(10, 11));
+    ensure_not(seq2.isBorrowed());
+    ensure_equals(seq2.size(), 4u);
+    ensure_equals_xyz(seq2.getAt<Coordinate>(2), Coordinate(7, 8, 9));
+}
+
+template<>
+template<>
+void object::test<66>()
+{
+    set_test_name("only layouts matching the storage can be borrowed");
+
+    std::vector<double> values(8);
+
+    ensure(CoordinateSequence::canBorrow(true, false));
+    ensure(CoordinateSequence::canBorrow(true, true));
+    ensure_not(CoordinateSequence::canBorrow(false, false));
+    ensure_not(CoordinateSequence::canBorrow(false, true));
+
+    auto seq = CoordinateSequence::borrow(values.data(), 2, true, true);
+    ensure(seq.getCoordinateType() == geos::geom::CoordinateType::XYZM);
+
+    try {
+        CoordinateSequence::borrow(values.data(), 4, false, false);
+        fail("XY buffer borrowed");
+    } catch (const geos::util::IllegalArgumentException&) {}
+
+    auto empty = CoordinateSequence::borrow(nullptr, 0, true, false);
+    ensure(empty.isEmpty());
+    ensure_not(empty.isBorrowed());
+}
 
 } // namespace tut
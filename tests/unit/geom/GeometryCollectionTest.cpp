@@ -217,4 +217,21 @@ void object::test<11>() {
     ensure_equals_exact_geometry(curved.get(), expected.get(), 1e-4);
 }
 
+template<>
+template<>
+void object::test<12>() {
+    set_test_name("equalsIdentical() after geometryChanged()");
+
+    auto gc1 = readWKT("GEOMETRYCOLLECTION(POINT (3 7), LINESTRING (1 1, 2 3))");
+    auto gc2 = readWKT("GEOMETRYCOLLECTION(POINT (3 7), LINESTRING (1 1, 2 3))");
+    auto gc3 = readWKT("GEOMETRYCOLLECTION(POINT (3 7), LINESTRING (1 1, 2 4))");
+
+    // the cached envelope is cleared, and computed again when needed
+    gc2->geometryChanged();
+
+    ensure(gc1->equalsIdentical(gc2.get()));
+    ensure(gc2->equalsIdentical(gc1.get()));
+    ensure(!gc1->equalsIdentical(gc3.get()));
+}
+
 } // namespace tut
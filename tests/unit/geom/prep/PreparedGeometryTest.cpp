@@ -10,8 +10,10 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h>
 #include <geos/io/WKTReader.h>
+#include <geos/util/TaskPool.h>
 // std
 #include <memory>
+#include <vector>
 
 using namespace geos::geom;
 using geos::geom::prep::PreparedGeometry;
@@ -100,4 +102,81 @@ void object::test<3>
 }
 
 
+template<>
+template<>
+void object::test<4>
+()
+{
+    set_test_name("containsXY and intersectsXY match per-point predicates");
+
+    g1 = reader.read( "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (4 4, 6 4, 6 6, 4 6, 4 4))" );
+
+    std::vector<double> x, y;
+    for (int i = -2; i <= 12; i++) {
+        for (int j = -2; j <= 12; j++) {
+            x.push_back(i);
+            y.push_back(0.5 * j);
+        }
+    }
+    const std::size_t n = x.size();
+
+    geos::util::TaskPool pool(3);
+
+    for (auto* p : { static_cast<geos::util::TaskPool*>(nullptr), &pool }) {
+        pg1 = prep::PreparedGeometryFactory::prepare(g1.get());
+
+        std::vector<unsigned char> contains(n), intersects(n);
+        pg1->containsXY(x.data(), y.data(), n, contains.data(), p);
+        pg1->intersectsXY(x.data(), y.data(), n, intersects.data(), p);
+
+        for (std::size_t i = 0; i < n; i++) {
+            auto pt = factory->createPoint(CoordinateXY(x[i], y[i]));
+            ensure_equals(contains[i] != 0, g1->contains(pt.get()));
+            ensure_equals(intersects[i] != 0, g1->intersects(pt.get()));
+        }
+    }
+
+    // points against a non-areal geometry
+    g2 = reader.read( "LINESTRING (0 0, 10 10)" );
+    pg2 = prep::PreparedGeometryFactory::prepare(g2.get());
+
+    std::vector<unsigned char> intersects(n);
+    pg2->intersectsXY(x.data(), y.data(), n, intersects.data(), &pool);
+    for (std::size_t i = 0; i < n; i++) {
+        ensure_equals(intersects[i] != 0, x[i] == y[i] && x[i] >= 0 && x[i] <= 10);
+    }
+}
+
+template<>
+template<>
+void object::test<5>
+()
+{
+    set_test_name("containsEach and intersectsEach match per-geometry predicates");
+
+    g1 = reader.read( "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 0, 30 0, 30 10, 20 10, 20 0)))" );
+
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    for (int i = 0; i < 200; i++) {
+        double x = -5 + 0.2 * i;
+        geoms.push_back(reader.read("LINESTRING (" + std::to_string(x) + " 5, " + std::to_string(x + 3) + " 6)"));
+    }
+    std::vector<const Geometry*> ptrs;
+    for (const auto& g : geoms) {
+        ptrs.push_back(g.get());
+    }
+
+    geos::util::TaskPool pool(2);
+    pg1 = prep::PreparedGeometryFactory::prepare(g1.get());
+
+    std::vector<unsigned char> contains(ptrs.size()), intersects(ptrs.size());
+    pg1->containsEach(ptrs.data(), ptrs.size(), contains.data(), &pool);
+    pg1->intersectsEach(ptrs.data(), ptrs.size(), intersects.data(), &pool);
+
+    for (std::size_t i = 0; i < ptrs.size(); i++) {
+        ensure_equals(contains[i] != 0, g1->contains(ptrs[i]));
+        ensure_equals(intersects[i] != 0, g1->intersects(ptrs[i]));
+    }
+}
+
 } // namespace tut
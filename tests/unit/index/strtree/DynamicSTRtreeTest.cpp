@@ -0,0 +1,189 @@
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/geom/Envelope.h>
+#include <geos/index/strtree/DynamicSTRtree.h>
+#include <geos/util/IllegalArgumentException.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace geos;
+using geos::geom::Envelope;
+using geos::index::strtree::DynamicSTRtree;
+
+namespace tut {
+// dummy data, not used
+struct test_dynamicstrtree_data {
+
+    // Checks that a query of the tree returns the same items as
+    // a brute-force search of the expected items
+    static void checkQuery(DynamicSTRtree<std::size_t>& tree,
+                           const std::vector<std::pair<Envelope, std::size_t>>& expected,
+                           const Envelope& queryEnv)
+    {
+        std::vector<std::size_t> actual;
+        tree.query(queryEnv, actual);
+        std::sort(actual.begin(), actual.end());
+
+        std::vector<std::size_t> brute;
+        for (const auto& e : expected) {
+            if (e.first.intersects(queryEnv)) {
+                brute.push_back(e.second);
+            }
+        }
+        std::sort(brute.begin(), brute.end());
+
+        ensure_equals(actual.size(), brute.size());
+        ensure(actual == brute);
+    }
+};
+
+typedef test_group<test_dynamicstrtree_data> group;
+typedef group::object object;
+
+group test_dynamicstrtree_group("geos::index::strtree::DynamicSTRtree");
+
+// Interleaved insertion, removal and query agree with a brute-force search
+template<>
+template<>
+void object::test<1>()
+{
+    DynamicSTRtree<std::size_t> tree(10, 16);
+    std::vector<std::pair<Envelope, std::size_t>> expected;
+
+    std::default_random_engine e(12345);
+    std::uniform_real_distribution<> coord(0, 1000);
+    std::uniform_real_distribution<> size(0, 10);
+    std::uniform_int_distribution<> action(0, 3);
+
+    for (std::size_t i = 0; i < 3000; i++) {
+        double x = coord(e);
+        double y = coord(e);
+        Envelope env(x, x + size(e), y, y + size(e));
+
+        if (action(e) == 0 && !expected.empty()) {
+            std::size_t k = static_cast<std::size_t>(coord(e)) % expected.size();
+            ensure(tree.remove(expected[k].first, expected[k].second));
+            expected[k] = expected.back();
+            expected.pop_back();
+        } else {
+            tree.insert(env, i);
+            expected.emplace_back(env, i);
+        }
+
+        if (i % 100 == 0) {
+            checkQuery(tree, expected, Envelope(x, x + 100, y, y + 100));
+        }
+        ensure_equals(tree.size(), expected.size());
+    }
+
+    // the items are held in a logarithmic number of trees
+    ensure(tree.getNumTrees() <= 8);
+
+    for (std::size_t i = 0; i < 20; i++) {
+        double x = coord(e);
+        double y = coord(e);
+        checkQuery(tree, expected, Envelope(x, x + 200, y, y + 200));
+    }
+
+    tree.compact();
+    ensure_equals(tree.getNumTrees(), 1u);
+    ensure_equals(tree.size(), expected.size());
+    checkQuery(tree, expected, Envelope(0, 1010, 0, 1010));
+
+    // insertion continues to work after compaction
+    tree.insert(Envelope(2000, 2001, 2000, 2001), 99999);
+    std::vector<std::size_t> hits;
+    tree.query(Envelope(1999, 2002, 1999, 2002), hits);
+    ensure_equals(hits.size(), 1u);
+    ensure_equals(hits[0], 99999u);
+}
+
+// Removing items that are absent or already removed
+template<>
+template<>
+void object::test<2>()
+{
+    DynamicSTRtree<std::size_t> tree(4, 4);
+    for (std::size_t i = 0; i < 10; i++) {
+        double x = static_cast<double>(i);
+        tree.insert(Envelope(x, x, 0, 0), i);
+    }
+
+    ensure(!tree.remove(Envelope(100, 100, 0, 0), 100));
+    ensure(tree.remove(Envelope(3, 3, 0, 0), 3));
+    ensure(!tree.remove(Envelope(3, 3, 0, 0), 3));
+    ensure(tree.remove(Envelope(9, 9, 0, 0), 9));
+    ensure_equals(tree.size(), 8u);
+
+    // removing all items leaves an empty tree
+    for (std::size_t i = 0; i < 10; i++) {
+        double x = static_cast<double>(i);
+        tree.remove(Envelope(x, x, 0, 0), i);
+    }
+    ensure_equals(tree.size(), 0u);
+
+    std::vector<std::size_t> hits;
+    tree.query(Envelope(0, 10, 0, 0), hits);
+    ensure(hits.empty());
+}
+
+// Query can be stopped by the visitor, and iterate visits every item
+template<>
+template<>
+void object::test<3>()
+{
+    DynamicSTRtree<std::size_t> tree(10, 8);
+    for (std::size_t i = 0; i < 100; i++) {
+        double x = static_cast<double>(i);
+        tree.insert(Envelope(x, x + 1, 0, 1), i);
+    }
+    tree.remove(Envelope(50, 51, 0, 1), 50);
+
+    std::size_t visited = 0;
+    tree.query(Envelope(0, 100, 0, 1), [&visited](std::size_t) {
+        visited++;
+        return visited < 5;
+    });
+    ensure_equals(visited, 5u);
+
+    std::vector<std::size_t> items;
+    tree.iterate([&items](std::size_t item) {
+        items.push_back(item);
+    });
+    std::sort(items.begin(), items.end());
+    ensure_equals(items.size(), 99u);
+    ensure(!std::binary_search(items.begin(), items.end(), 50));
+}
+
+// Pointer items may be used through the SpatialIndex interface
+template<>
+template<>
+void object::test<4>()
+{
+    int a = 1;
+    int b = 2;
+    DynamicSTRtree<int*> tree;
+    index::SpatialIndex& index = tree;
+
+    Envelope envA(0, 1, 0, 1);
+    Envelope envB(5, 6, 5, 6);
+    index.insert(&envA, &a);
+    index.insert(&envB, &b);
+
+    std::vector<void*> hits;
+    Envelope queryEnv(0, 2, 0, 2);
+    index.query(&queryEnv, hits);
+    ensure_equals(hits.size(), 1u);
+    ensure(hits[0] == &a);
+
+    ensure(index.remove(&envA, &a));
+    hits.clear();
+    index.query(&queryEnv, hits);
+    ensure(hits.empty());
+
+    ensure_THROW(DynamicSTRtree<int*>(1), util::IllegalArgumentException);
+}
+
+} // namespace tut
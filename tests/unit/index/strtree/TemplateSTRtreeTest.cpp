@@ -7,6 +7,10 @@
 #include <geos/index/strtree/TemplateSTRtree.h>
 #include <geos/index/ItemVisitor.h>
 #include <geos/io/WKTReader.h>
+#include <geos/util/TaskPool.h>
+
+#include <algorithm>
+#include <random>
 
 using namespace geos;
 using geos::index::strtree::TemplateSTRtree;
@@ -472,6 +476,219 @@ void object::test<11>()
     ensure_equals("same number of pairs visited (void callback)", pairCount1, pairCount3);
 }
 
+template<>
+template<>
+void object::test<12>()
+{
+    set_test_name("parallel build and batch query");
+
+    std::default_random_engine e(12345);
+    std::uniform_real_distribution<> coord(0, 1000);
+    std::uniform_real_distribution<> extent(0, 5);
+
+    std::vector<geom::Envelope> envs;
+    for (std::size_t i = 0; i < 40000; i++) {
+        double x = coord(e);
+        double y = coord(e);
+        envs.emplace_back(x, x + extent(e), y, y + extent(e));
+    }
+
+    TemplateSTRtree<std::size_t> seqTree;
+    TemplateSTRtree<std::size_t> parTree;
+    for (std::size_t i = 0; i < envs.size(); i++) {
+        seqTree.insert(envs[i], i);
+        parTree.insert(envs[i], i);
+    }
+
+    util::TaskPool pool(3);
+    seqTree.build();
+    parTree.build(&pool);
+
+    std::vector<geom::Envelope> queries;
+    for (std::size_t i = 0; i < 500; i++) {
+        double x = coord(e);
+        double y = coord(e);
+        queries.emplace_back(x, x + 20, y, y + 20);
+    }
+    queries.emplace_back(-10, -5, -10, -5);
+
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> items;
+    parTree.queryBatch(queries.data(), queries.size(), offsets, items, &pool);
+
+    ensure_equals(offsets.size(), queries.size() + 1);
+    ensure_equals(offsets.front(), 0u);
+    ensure_equals(offsets.back(), items.size());
+
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        std::vector<std::size_t> expected;
+        seqTree.query(queries[i], expected);
+        std::vector<std::size_t> actual(items.begin() + static_cast<long>(offsets[i]),
+                                        items.begin() + static_cast<long>(offsets[i + 1]));
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        ensure(actual == expected);
+    }
+    ensure_equals(offsets[queries.size()], offsets[queries.size() - 1]);
+
+    // batch query without a pool, on an empty tree
+    TemplateSTRtree<std::size_t> emptyTree;
+    emptyTree.queryBatch(queries.data(), queries.size(), offsets, items);
+    ensure_equals(offsets.size(), queries.size() + 1);
+    ensure_equals(offsets.back(), 0u);
+    ensure(items.empty());
+}
+
+
+
+// Hilbert-packed tree gives the same query results as an STR-packed tree
+template<>
+template<>
+void object::test<13>()
+{
+    std::default_random_engine e(12345);
+    std::normal_distribution<> coord(500, 100);
+    std::uniform_real_distribution<> extent(0, 5);
+
+    // clustered items, with a few duplicates
+    std::vector<geom::Envelope> envs;
+    for (std::size_t i = 0; i < 30000; i++) {
+        double x = coord(e);
+        double y = coord(e);
+        envs.emplace_back(x, x + extent(e), y, y + extent(e));
+    }
+    for (std::size_t i = 0; i < 100; i++) {
+        envs.push_back(envs[i]);
+    }
+
+    TemplateSTRtree<std::size_t> strTree;
+    TemplateSTRtree<std::size_t> hilbertTree;
+    TemplateSTRtree<std::size_t> parHilbertTree;
+    hilbertTree.setHilbertPacking(true);
+    parHilbertTree.setHilbertPacking(true);
+    for (std::size_t i = 0; i < envs.size(); i++) {
+        strTree.insert(envs[i], i);
+        hilbertTree.insert(envs[i], i);
+        parHilbertTree.insert(envs[i], i);
+    }
+
+    util::TaskPool pool(3);
+    hilbertTree.build();
+    parHilbertTree.build(&pool);
+    ensure(hilbertTree.getRoot()->getBounds().equals(&strTree.getRoot()->getBounds()));
+
+    for (std::size_t i = 0; i < 500; i++) {
+        double x = coord(e);
+        double y = coord(e);
+        geom::Envelope queryEnv(x, x + 20, y, y + 20);
+
+        std::vector<std::size_t> expected;
+        std::vector<std::size_t> actual;
+        std::vector<std::size_t> actualPar;
+        strTree.query(queryEnv, expected);
+        hilbertTree.query(queryEnv, actual);
+        parHilbertTree.query(queryEnv, actualPar);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        std::sort(actualPar.begin(), actualPar.end());
+        ensure(actual == expected);
+        ensure(actualPar == expected);
+    }
+
+    ensure(hilbertTree.remove(envs[7], 7));
+    std::vector<std::size_t> hits;
+    hilbertTree.query(envs[7], hits);
+    ensure(std::find(hits.begin(), hits.end(), 7u) == hits.end());
+
+    // items with identical bounds, and a single item
+    TemplateSTRtree<std::size_t> sameTree;
+    sameTree.setHilbertPacking(true);
+    for (std::size_t i = 0; i < 50; i++) {
+        sameTree.insert(geom::Envelope(1, 2, 1, 2), i);
+    }
+    hits.clear();
+    sameTree.query(geom::Envelope(0, 3, 0, 3), hits);
+    ensure_equals(hits.size(), 50u);
+
+    TemplateSTRtree<std::size_t> oneTree;
+    oneTree.setHilbertPacking(true);
+    oneTree.insert(geom::Envelope(1, 2, 1, 2), 0);
+    hits.clear();
+    oneTree.query(geom::Envelope(0, 3, 0, 3), hits);
+    ensure_equals(hits.size(), 1u);
+}
+
+
+// Tree with flat bounds gives the same query results as one without
+template<>
+template<>
+void object::test<14>()
+{
+    std::default_random_engine e(12345);
+    std::uniform_real_distribution<> coord(0, 1000);
+    std::uniform_real_distribution<> extent(0, 5);
+
+    std::vector<geom::Envelope> envs;
+    for (std::size_t i = 0; i < 20000; i++) {
+        double x = coord(e);
+        double y = coord(e);
+        envs.emplace_back(x, x + extent(e), y, y + extent(e));
+    }
+
+    // node capacities needing more than one test per node
+    for (std::size_t nodeCapacity : { 2u, 10u, 100u }) {
+        TemplateSTRtree<std::size_t> tree(nodeCapacity);
+        TemplateSTRtree<std::size_t> flatTree(nodeCapacity);
+        flatTree.setFlatBounds(true);
+        for (std::size_t i = 0; i < envs.size(); i++) {
+            tree.insert(envs[i], i);
+            flatTree.insert(envs[i], i);
+        }
+        ensure(flatTree.remove(envs[3], 3));
+        ensure(tree.remove(envs[3], 3));
+
+        for (std::size_t i = 0; i < 300; i++) {
+            double x = coord(e);
+            double y = coord(e);
+            geom::Envelope queryEnv(x, x + 30, y, y + 30);
+
+            std::vector<std::size_t> expected;
+            std::vector<std::size_t> actual;
+            tree.query(queryEnv, expected);
+            flatTree.query(queryEnv, actual);
+
+            std::sort(expected.begin(), expected.end());
+            std::sort(actual.begin(), actual.end());
+            ensure(actual == expected);
+        }
+
+        // touching envelopes intersect
+        std::vector<std::size_t> hits;
+        flatTree.query(geom::Envelope(envs[5].getMaxX(), envs[5].getMaxX() + 1,
+                                      envs[5].getMaxY(), envs[5].getMaxY() + 1), hits);
+        ensure(std::find(hits.begin(), hits.end(), 5u) != hits.end());
+
+        // query stopped by the visitor
+        std::size_t visited = 0;
+        flatTree.query(geom::Envelope(0, 1000, 0, 1000), [&visited](std::size_t) {
+            return ++visited < 10;
+        });
+        ensure_equals(visited, 10u);
+    }
+
+    // no effect on one-dimensional bounds
+    TemplateSTRtree<std::size_t, index::strtree::IntervalTraits> intervalTree;
+    intervalTree.setFlatBounds(true);
+    for (std::size_t i = 0; i < 100; i++) {
+        double x = static_cast<double>(i);
+        intervalTree.insert(index::strtree::Interval(x, x + 1), i);
+    }
+    std::vector<std::size_t> hits;
+    intervalTree.query(index::strtree::Interval(10.5, 12.5), hits);
+    ensure_equals(hits.size(), 3u);
+}
 
 } // namespace tut
 
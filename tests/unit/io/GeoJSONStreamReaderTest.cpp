@@ -0,0 +1,196 @@
+//
+// Test Suite for geos::io::GeoJSONStreamReader and GeoJSONStreamWriter
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/WKTReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/IllegalStateException.h>
+// std
+#include <memory>
+#include <sstream>
+#include <string>
+
+using geos::io::GeoJSONStreamReader;
+using geos::io::GeoJSONStreamWriter;
+
+namespace tut {
+
+//
+// Test Group
+//
+
+struct test_geojsonstreamreader_data {
+    geos::io::WKTReader wktreader;
+
+    void checkGeometries(const std::string& geojson, const std::vector<std::string>& wkts)
+    {
+        std::istringstream is(geojson);
+        GeoJSONStreamReader reader(is);
+        for (const auto& wkt : wkts) {
+            auto g = reader.nextGeometry();
+            ensure("missing geometry", g != nullptr);
+            auto expected = wktreader.read(wkt);
+            ensure_equals_geometry(g.get(), expected.get());
+        }
+        ensure("unexpected geometry", reader.nextGeometry() == nullptr);
+        ensure("read past end", reader.nextGeometry() == nullptr);
+    }
+};
+
+typedef test_group<test_geojsonstreamreader_data> group;
+typedef group::object object;
+
+group test_geojsonstreamreader_group("geos::io::GeoJSONStreamReader");
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    set_test_name("FeatureCollection with other members");
+
+    std::string geojson = R"({
+        "type": "FeatureCollection",
+        "name": "a \"quoted\" ] name }",
+        "bbox": [0, 0, 10, 10],
+        "features": [
+            {"type": "Feature", "properties": {"s": "{[,"}, "geometry": {"type": "Point", "coordinates": [1, 2]}},
+            {"type": "Feature", "geometry": {"type": "LineString", "coordinates": [[0, 0], [10, 10]]}, "properties": null},
+            {"type": "Feature", "properties": {"n": 3.5, "b": true}, "geometry": {"type": "Polygon", "coordinates": [[[0, 0], [1, 0], [1, 1], [0, 0]]]}}
+        ],
+        "crs": null
+    })";
+
+    checkGeometries(geojson, {
+        "POINT (1 2)",
+        "LINESTRING (0 0, 10 10)",
+        "POLYGON ((0 0, 1 0, 1 1, 0 0))"
+    });
+
+    std::istringstream is(geojson);
+    GeoJSONStreamReader reader(is);
+    auto feature = reader.next();
+    ensure_equals(feature->getProperties().at("s").getString(), "{[,");
+    reader.next();
+    feature = reader.next();
+    ensure_equals(feature->getProperties().at("n").getNumber(), 3.5);
+    ensure(reader.next() == nullptr);
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    set_test_name("single Feature, single Geometry and empty collection");
+
+    checkGeometries(R"({"type":"Feature","geometry":{"type":"Point","coordinates":[3,4]},"properties":{}})",
+                    { "POINT (3 4)" });
+    checkGeometries(R"({"coordinates":[[5,6],[7,8]],"type":"LineString"})",
+                    { "LINESTRING (5 6, 7 8)" });
+    checkGeometries(R"({"type":"FeatureCollection","features":[]})", {});
+}
+
+template<>
+template<>
+void object::test<3>
+()
+{
+    set_test_name("invalid input");
+
+    std::istringstream truncated(R"({"type":"FeatureCollection","features":[{"type":"Feature","geometry":{"type":"Point")");
+    GeoJSONStreamReader reader1(truncated);
+    try {
+        reader1.nextGeometry();
+        fail("ParseException not thrown");
+    } catch (const geos::io::ParseException&) {}
+
+    std::istringstream bad(R"({"type":"FeatureCollection","features":[{"type":"Feature","geometry":{"type":"Point","coordinates":[1,]}}]})");
+    GeoJSONStreamReader reader2(bad);
+    try {
+        reader2.nextGeometry();
+        fail("ParseException not thrown");
+    } catch (const geos::io::ParseException&) {}
+
+    std::istringstream notjson("POINT (1 1)");
+    GeoJSONStreamReader reader3(notjson);
+    try {
+        reader3.nextGeometry();
+        fail("ParseException not thrown");
+    } catch (const geos::io::ParseException&) {}
+}
+
+template<>
+template<>
+void object::test<4>
+()
+{
+    set_test_name("writer round trip");
+
+    std::vector<std::string> wkts = {
+        "POINT (1 2)",
+        "MULTIPOINT ((0 0), (1 1))",
+        "POLYGON ((0 0, 0 1, 1 1, 0 0))"
+    };
+
+    std::ostringstream os;
+    {
+        GeoJSONStreamWriter writer(os);
+        for (const auto& wkt : wkts) {
+            auto g = wktreader.read(wkt);
+            writer.write(g.get());
+        }
+        // finished by destructor
+    }
+    checkGeometries(os.str(), wkts);
+
+    std::ostringstream empty;
+    GeoJSONStreamWriter writer(empty);
+    writer.finish();
+    writer.finish();
+    ensure_equals(empty.str(), R"({"type":"FeatureCollection","features":[]})");
+
+    auto g = wktreader.read("POINT (1 1)");
+    try {
+        writer.write(g.get());
+        fail("IllegalStateException not thrown");
+    } catch (const geos::util::IllegalStateException&) {}
+}
+
+template<>
+template<>
+void object::test<5>
+()
+{
+    set_test_name("missing or extra commas");
+
+    const std::string pt = R"({"type":"Feature","geometry":{"type":"Point","coordinates":[1,2]},"properties":{}})";
+    for (const std::string& geojson : {
+                std::string(R"({"type":"FeatureCollection","features":[)") + pt + pt + "]}",
+                std::string(R"({"type":"FeatureCollection","features":[)") + pt + " " + pt + "]}",
+                std::string(R"({"type":"FeatureCollection","features":[,)") + pt + "]}",
+                std::string(R"({"type":"FeatureCollection","features":[)") + pt + ",]}",
+                std::string(R"({"type":"FeatureCollection" "features":[)") + pt + "]}",
+                std::string(R"({,"type":"FeatureCollection","features":[)") + pt + "]}",
+                std::string(R"({"type":"FeatureCollection","features":[)") + pt + R"(] "crs":null})",
+                std::string(R"({"features":[)") + pt + R"(],"type":"FeatureCollection",})"
+            }) {
+        std::istringstream is(geojson);
+        GeoJSONStreamReader reader(is);
+        try {
+            while (reader.nextGeometry() != nullptr) {}
+            fail("ParseException not thrown for " + geojson);
+        } catch (const geos::io::ParseException&) {}
+    }
+
+    checkGeometries(std::string(R"({"features":[)") + pt + " , " + pt + R"(] , "type":"FeatureCollection"})",
+                    { "POINT (1 2)", "POINT (1 2)" });
+}
+
+} // namespace tut
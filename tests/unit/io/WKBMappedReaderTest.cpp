@@ -0,0 +1,184 @@
+//
+// Test Suite for geos::io::WKBMappedReader
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/io/WKBMappedReader.h>
+#include <geos/io/WKBWriter.h>
+#include <geos/io/WKTReader.h>
+#include <geos/io/ParseException.h>
+#include <geos/io/ByteOrderValues.h>
+#include <geos/geom/Geometry.h>
+#include <geos/util/GEOSException.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using geos::io::WKBMappedReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_wkbmappedreader_data {
+    geos::io::WKTReader wktreader;
+    std::vector<std::string> wkts;
+    std::string buf;
+
+    test_wkbmappedreader_data()
+        : wkts({
+        "POINT (1 2)",
+        "LINESTRING Z (0 0 1, 10 5 2)",
+        "POLYGON ((0 0, 4 0, 4 3, 0 0))",
+        "POINT EMPTY",
+        "MULTIPOINT M ((1 1 3), (-2 7 4))",
+        "GEOMETRYCOLLECTION (POINT (5 5), LINESTRING (1 1, 2 -2))",
+        "CIRCULARSTRING (0 0, 0.2 0.6, 2 0)"
+    })
+    {
+        // Write records alternately in little- and big-endian byte order,
+        // some of them with an SRID
+        std::stringstream ss;
+        geos::io::WKBWriter writer;
+        writer.setOutputDimension(4);
+        writer.setIncludeSRID(true);
+        for (std::size_t i = 0; i < wkts.size(); i++) {
+            auto g = wktreader.read(wkts[i]);
+            g->setSRID(i % 3 == 0 ? 4326 : 0);
+            writer.setByteOrder(i % 2 == 0 ? geos::io::ByteOrderValues::ENDIAN_LITTLE
+                                           : geos::io::ByteOrderValues::ENDIAN_BIG);
+            writer.write(*g, ss);
+        }
+        buf = ss.str();
+    }
+
+    const unsigned char* data() const
+    {
+        return reinterpret_cast<const unsigned char*>(buf.data());
+    }
+
+    void checkReader(const WKBMappedReader& rdr)
+    {
+        ensure_equals("size", rdr.size(), wkts.size());
+        ensure_equals("first offset", rdr.getOffset(0), 0u);
+
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < rdr.size(); i++) {
+            auto expected = wktreader.read(wkts[i]);
+            ensure_equals("offset", rdr.getOffset(i), total);
+            total += rdr.getRecordSize(i);
+
+            ensure("envelope", rdr.getEnvelope(i) == *expected->getEnvelopeInternal());
+
+            auto g = rdr.read(i);
+            ensure_equals_geometry(g.get(), expected.get());
+            ensure_equals("SRID", g->getSRID(), i % 3 == 0 ? 4326 : 0);
+        }
+        ensure_equals("total size", total, buf.size());
+    }
+};
+
+typedef test_group<test_wkbmappedreader_data> group;
+typedef group::object object;
+
+group test_wkbmappedreader_group("geos::io::WKBMappedReader");
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    set_test_name("read from buffer");
+
+    WKBMappedReader rdr(data(), buf.size());
+    checkReader(rdr);
+
+    // envelope of a curved record includes the arc
+    ensure_equals(rdr.getEnvelope(6).getMaxY(), 1.0);
+    ensure(rdr.getEnvelope(3).isNull());
+
+    // records can be read in any order
+    ensure_equals(rdr.read(4)->getNumPoints(), 2u);
+    ensure_equals(rdr.read(0)->getNumPoints(), 1u);
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    set_test_name("read from memory-mapped file");
+
+    std::string fname = "WKBMappedReaderTest.wkb";
+    {
+        std::ofstream f(fname, std::ios::binary);
+        f.write(buf.data(), static_cast<std::streamsize>(buf.size()));
+    }
+
+    {
+        WKBMappedReader rdr(fname);
+        checkReader(rdr);
+    }
+    std::remove(fname.c_str());
+
+    try {
+        WKBMappedReader missing("does-not-exist.wkb");
+        fail("Exception not thrown");
+    } catch (const geos::util::GEOSException&) {}
+}
+
+template<>
+template<>
+void object::test<3>
+()
+{
+    set_test_name("empty and truncated input");
+
+    WKBMappedReader empty(data(), 0);
+    ensure_equals(empty.size(), 0u);
+
+    try {
+        WKBMappedReader truncated(data(), buf.size() - 3);
+        fail("ParseException not thrown");
+    } catch (const geos::io::ParseException&) {}
+
+    std::string garbage = buf + "x";
+    try {
+        WKBMappedReader rdr(reinterpret_cast<const unsigned char*>(garbage.data()), garbage.size());
+        fail("ParseException not thrown");
+    } catch (const geos::io::ParseException&) {}
+}
+
+template<>
+template<>
+void object::test<4>
+()
+{
+    set_test_name("envelopes computed on first use by concurrent callers");
+
+    WKBMappedReader rdr(data(), buf.size());
+
+    std::vector<std::thread> threads;
+    std::vector<int> ok(4, 0);
+    for (std::size_t t = 0; t < ok.size(); t++) {
+        threads.emplace_back([&rdr, &ok, t]() {
+            ok[t] = rdr.getEnvelope(2).getMaxX() == 4.0 && rdr.getEnvelope(6).getMaxY() == 1.0;
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (int r : ok) {
+        ensure(r != 0);
+    }
+    checkReader(rdr);
+}
+
+} // namespace tut
@@ -20,10 +20,12 @@
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h>
 #include <geos/util/GEOSException.h>
+#include <geos/util/TaskPool.h>
 // std
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace tut {
 //
@@ -880,5 +882,111 @@ void object::test<38>
     ensure_THROW(wkbreader.read(buf.data(), buf.size()), geos::io::ParseException);
 }
 
+template<>
+template<>
+void object::test<39>
+()
+{
+    set_test_name("coordinates read in both byte orders and all dimensions");
+
+    geos::io::WKBWriter writer(4, geos::io::WKBConstants::wkbNDR);
+    for (const char* wkt : { "LINESTRING (1.4 2.6, 3 4, 5 6)",
+                             "LINESTRING Z (1.4 2.6 3.3, 4 5 6)",
+                             "LINESTRING M (1.4 2.6 3.3, 4 5 6)",
+                             "LINESTRING ZM (1.4 2.6 3.3 4.4, 5 6 7 8)",
+                             "POLYGON Z ((1 0 1, 10 0 2, 10 10 3, 1 0 1))" }) {
+        auto g = wktreader.read(wkt);
+
+        for (int bo : { geos::io::WKBConstants::wkbNDR, geos::io::WKBConstants::wkbXDR }) {
+            writer.setByteOrder(bo);
+            std::stringstream wkb;
+            writer.write(*g, wkb);
+            std::string bytes = wkb.str();
+            const unsigned char* buf = reinterpret_cast<const unsigned char*>(bytes.data());
+
+            auto result = wkbreader.read(buf, bytes.size());
+            ensure_equals(wkt, result->hasZ(), g->hasZ());
+            ensure_equals(wkt, result->hasM(), g->hasM());
+            // xy ordinates are made precise by the fixed precision model
+            ensure(wkt, result->equalsIdentical(g.get()));
+            ensure_equals(wkt, result->getCoordinates()->getX(0), 1.0);
+
+            // truncated coordinates
+            ensure_THROW(wkbreader.read(buf, bytes.size() - 1), geos::io::ParseException);
+        }
+    }
+}
+
+template<>
+template<>
+void object::test<40>
+()
+{
+    set_test_name("readBatch");
+
+    std::vector<std::string> wkbs;
+    for (int i = 0; i < 500; i++) {
+        auto g = wktreader.read("LINESTRING (" + std::to_string(i) + " 0, 0 " + std::to_string(i) + ")");
+        std::stringstream wkb;
+        ndrwkbwriter.write(*g, wkb);
+        wkbs.push_back(wkb.str());
+    }
+
+    std::vector<const unsigned char*> bufs;
+    std::vector<std::size_t> sizes;
+    for (const auto& wkb : wkbs) {
+        bufs.push_back(reinterpret_cast<const unsigned char*>(wkb.data()));
+        sizes.push_back(wkb.size());
+    }
+
+    geos::util::TaskPool pool(3);
+    for (geos::util::TaskPool* p : { static_cast<geos::util::TaskPool*>(nullptr), &pool }) {
+        auto results = wkbreader.readBatch(bufs.data(), sizes.data(), bufs.size(), p);
+        ensure_equals(results.size(), wkbs.size());
+        for (std::size_t i = 0; i < results.size(); i++) {
+            ensure_equals(results[i]->getCoordinates()->getX(0), static_cast<double>(i));
+        }
+    }
+
+    // an invalid buffer fails the batch
+    sizes[300] = 3;
+    ensure_THROW(wkbreader.readBatch(bufs.data(), sizes.data(), bufs.size(), &pool), geos::io::ParseException);
+}
+
+template<>
+template<>
+void object::test<41>
+()
+{
+    set_test_name("XY coordinates read into a padded sequence");
+
+    auto floating = geos::geom::GeometryFactory::create();
+    geos::io::WKBReader reader(*floating);
+    geos::io::WKTReader floatingWkt(*floating);
+    geos::io::WKBWriter writer(2, geos::io::WKBConstants::wkbNDR);
+
+    auto g = floatingWkt.read("POLYGON ((0.1 0.2, 10.3 0.4, 10.5 10.6, 0.1 0.2), (1.1 1.2, 2.3 1.4, 2.5 2.6, 1.1 1.2))");
+
+    for (int bo : { geos::io::WKBConstants::wkbNDR, geos::io::WKBConstants::wkbXDR }) {
+        writer.setByteOrder(bo);
+        std::stringstream wkb;
+        writer.write(*g, wkb);
+        std::string bytes = wkb.str();
+        const unsigned char* buf = reinterpret_cast<const unsigned char*>(bytes.data());
+
+        auto result = reader.read(buf, bytes.size());
+        ensure(!result->hasZ());
+        ensure(!result->hasM());
+        ensure(result->equalsIdentical(g.get()));
+
+        auto seq = result->getCoordinates();
+        auto expected = g->getCoordinates();
+        for (std::size_t i = 0; i < seq->size(); i++) {
+            ensure_equals(seq->getX(i), expected->getX(i));
+            ensure_equals(seq->getY(i), expected->getY(i));
+        }
+    }
+}
+
 } // namespace tut
 
@@ -9,15 +9,20 @@
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/io/WKBConstants.h>
+#include <geos/io/ByteOrderValues.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h>
 #include <geos/util.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/Machine.h>
 // std
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <memory>
 #include <cmath>
+#include <vector>
 
 namespace tut {
 //
@@ -478,6 +483,129 @@ void object::test<19>
                            "010A0000200E1600000200000001090000000200000001080000000500000000000000000000000000000000000000000000000000004000000000000000000000000000000040000000000000F03F00000000000000400000000000000840000000000000104000000000000008400102000000040000000000000000001040000000000000084000000000000010400000000000001440000000000000F03F000000000000104000000000000000000000000000000000010800000005000000333333333333FB3F000000000000F03F666666666666F63F9A9999999999D93F9A9999999999F93F9A9999999999D93F9A9999999999F93F000000000000E03F333333333333FB3F000000000000F03F");
 }
 
+// Writing to a caller-supplied buffer
+template<>
+template<>
+void object::test<20>
+()
+{
+    geos::io::WKTReader reader;
+    std::vector<std::string> wkts = {
+        "POINT (1 2)",
+        "POINT EMPTY",
+        "LINESTRING Z (1 2 3, 4 5 6, 7 8 9)",
+        "LINESTRING M (1 2 3, 4 5 6)",
+        "POLYGON ZM ((0 0 1 2, 10 0 3 4, 10 10 5 6, 0 0 1 2))",
+        "MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), EMPTY, ((5 5, 6 5, 6 6, 5 5), (5.5 5.4, 5.9 5.6, 5.8 5.5, 5.5 5.4)))",
+        "GEOMETRYCOLLECTION (POINT Z (1 2 3), LINESTRING (0 0, 1 1))",
+        "CURVEPOLYGON (COMPOUNDCURVE (CIRCULARSTRING (0 0, 2 0, 2 1, 2 3, 4 3), (4 3, 4 5, 1 4, 0 0)))",
+    };
+
+    for (const auto& wkt : wkts) {
+        auto geom = reader.read(wkt);
+        geom->setSRID(4326);
+
+        for (int bo : { getMachineByteOrder(), 1 - getMachineByteOrder() }) {
+            for (int dims = 2; dims <= 4; dims++) {
+                geos::io::WKBWriter w(static_cast<uint8_t>(dims), bo, true);
+
+                std::stringstream stream;
+                w.write(*geom, stream);
+                std::string expected = stream.str();
+
+                std::size_t size = w.getWkbSize(*geom);
+                ensure_equals(wkt, size, expected.size());
+
+                // output must not go past the encoded size
+                std::vector<unsigned char> buf(size + 8, 0xAB);
+                ensure_equals(wkt, w.write(*geom, buf.data(), buf.size()), size);
+                ensure(wkt, std::equal(buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(size), expected.begin(),
+                [](unsigned char a, char b) {
+                    return a == static_cast<unsigned char>(b);
+                }));
+                ensure_equals(buf[size], 0xAB);
+
+                auto result = wkbreader.read(buf.data(), size);
+                auto roundTrip = reader.read(wkt);
+                ensure_equals(wkt, result->getNumPoints(), roundTrip->getNumPoints());
+
+                try {
+                    w.write(*geom, buf.data(), size - 1);
+                    fail("IllegalArgumentException expected");
+                }
+                catch (const geos::util::IllegalArgumentException&) {}
+            }
+        }
+    }
+}
+
+// Buffer output matches hand-encoded WKB in both byte orders
+template<>
+template<>
+void object::test<21>
+()
+{
+    geos::io::WKTReader reader;
+    auto geom = reader.read("LINESTRING Z (1 2 3, 4 5 6)");
+
+    geos::io::WKBWriter little(3, geos::io::ByteOrderValues::ENDIAN_LITTLE);
+    geos::io::WKBWriter big(3, geos::io::ByteOrderValues::ENDIAN_BIG);
+
+    std::size_t size = little.getWkbSize(*geom);
+    ensure_equals(size, std::size_t(1 + 4 + 4 + 2 * 3 * 8));
+    ensure_equals(big.getWkbSize(*geom), size);
+
+    std::vector<unsigned char> lbuf(size);
+    std::vector<unsigned char> bbuf(size);
+    little.write(*geom, lbuf.data(), size);
+    big.write(*geom, bbuf.data(), size);
+
+    ensure_equals(lbuf[0], 1);
+    ensure_equals(bbuf[0], 0);
+    for (std::size_t i = 9; i < size; i += 8) {
+        ensure_equals(geos::io::ByteOrderValues::getDouble(&lbuf[i], geos::io::ByteOrderValues::ENDIAN_LITTLE),
+                      geos::io::ByteOrderValues::getDouble(&bbuf[i], geos::io::ByteOrderValues::ENDIAN_BIG));
+        ensure_equals(geos::io::ByteOrderValues::getDouble(&lbuf[i], geos::io::ByteOrderValues::ENDIAN_LITTLE),
+                      static_cast<double>((i - 9) / 8 + 1));
+    }
+}
 
-} // namespace tut
 
+// Ordinates copied from sequences whose stride is larger than the output
+template<>
+template<>
+void object::test<22>
+()
+{
+    geos::io::WKTReader reader;
+    for (const char* wkt : { "LINESTRING (1 2, 3 4, 5 6)",
+                             "LINESTRING ZM (1 2 3 4, 5 6 7 8)",
+                             "LINESTRING M (1 2 3, 4 5 6)" }) {
+        auto geom = reader.read(wkt);
+        for (int dims = 2; dims <= 3; dims++) {
+            geos::io::WKBWriter w(static_cast<uint8_t>(dims));
+            std::vector<unsigned char> buf(w.getWkbSize(*geom));
+            w.write(*geom, buf.data(), buf.size());
+
+            auto result = wkbreader.read(buf.data(), buf.size());
+            ensure_equals(wkt, result->getCoordinateDimension(),
+                          std::min(static_cast<uint8_t>(dims), geom->getCoordinateDimension()));
+
+            auto expected = geom->getCoordinates();
+            auto actual = result->getCoordinates();
+            ensure_equals(wkt, actual->size(), expected->size());
+            for (std::size_t i = 0; i < actual->size(); i++) {
+                ensure_equals(wkt, actual->getX(i), expected->getX(i));
+                ensure_equals(wkt, actual->getY(i), expected->getY(i));
+                if (result->hasZ()) {
+                    ensure_equals(wkt, actual->getZ(i), expected->getZ(i));
+                }
+                if (result->hasM()) {
+                    ensure_equals(wkt, actual->getM(i), expected->getM(i));
+                }
+            }
+        }
+    }
+}
+
+} // namespace tut
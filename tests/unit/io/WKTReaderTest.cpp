@@ -7,6 +7,7 @@
 // geos
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/io/ParseException.h>
 #include <geos/geom/PrecisionModel.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/Geometry.h>
@@ -18,7 +19,9 @@
 #include <geos/util/GEOSException.h>
 #include <geos/util/IllegalArgumentException.h>
 // std
+#include <cmath>
 #include <memory>
+#include <string>
 
 namespace tut {
 //
@@ -503,4 +506,64 @@ void object::test<26>
     ensure_parseexception(wkt);
 }
 
+template<>
+template<>
+void object::test<27>
+()
+{
+    set_test_name("number formats");
+
+    geos::io::WKTReader reader;
+    auto g = reader.read("LINESTRING (+1 -2.5, .25 1e3, 1E-2 -0.0, 0x10 2)");
+    auto seq = g->getCoordinates();
+    ensure_equals(seq->getX(0), 1.0);
+    ensure_equals(seq->getY(0), -2.5);
+    ensure_equals(seq->getX(1), 0.25);
+    ensure_equals(seq->getY(1), 1000.0);
+    ensure_equals(seq->getX(2), 0.01);
+    ensure(std::signbit(seq->getY(2)));
+    ensure_equals(seq->getX(3), 16.0);
+
+    g = reader.read("POINT (1e400 -1e400)");
+    ensure(std::isinf(g->getCoordinate()->x) && g->getCoordinate()->x > 0);
+    ensure(std::isinf(g->getCoordinate()->y) && g->getCoordinate()->y < 0);
+
+    g = reader.read("POINT (inf NaN)");
+    ensure(std::isinf(g->getCoordinate()->x));
+    ensure(std::isnan(g->getCoordinate()->y));
+
+    ensure_parseexception("POINT (1 2x)");
+    ensure_parseexception("POINT (1 --2)");
+    ensure_parseexception("LINESTRING (1 2, 3 4 POINT)");
+    ensure_parseexception("LINESTRING (1 2 3 4");
+}
+
+template<>
+template<>
+void object::test<28>
+()
+{
+    set_test_name("readNext");
+
+    std::string text = "  POINT EMPTY\nLINESTRING (1 2,\n 3 4)POINT Z (1 2 3)\tGEOMETRYCOLLECTION (POINT (5 5))\n\n";
+    std::size_t pos = 0;
+
+    auto g = wktreader.readNext(text, pos);
+    ensure_equals(g->toString(), "POINT EMPTY");
+    g = wktreader.readNext(text, pos);
+    ensure_equals(g->toString(), "LINESTRING (1 2, 3 4)");
+    g = wktreader.readNext(text, pos);
+    ensure_equals(g->toString(), "POINT Z (1 2 3)");
+    g = wktreader.readNext(text, pos);
+    ensure_equals(g->toString(), "GEOMETRYCOLLECTION (POINT (5 5))");
+    ensure(wktreader.readNext(text, pos) == nullptr);
+    ensure_equals(pos, text.size());
+    ensure(wktreader.readNext(text, pos) == nullptr);
+
+    std::string bad = "POINT (1 1) POINT (1";
+    pos = 0;
+    ensure(wktreader.readNext(bad, pos) != nullptr);
+    ensure_THROW(wktreader.readNext(bad, pos), geos::io::ParseException);
+}
+
 } // namespace tut
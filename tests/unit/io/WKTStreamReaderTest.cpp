@@ -0,0 +1,109 @@
+//
+// Test Suite for geos::io::WKTStreamReader
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+// geos
+#include <geos/io/WKTStreamReader.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/ParseException.h>
+// std
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_wktstreamreader_data {};
+
+typedef test_group<test_wktstreamreader_data> group;
+typedef group::object object;
+
+group test_wktstreamreader_group("geos::io::WKTStreamReader");
+
+//
+// Test Cases
+//
+
+// Geometries on one line, across lines and without parentheses
+template<>
+template<>
+void object::test<1>
+()
+{
+    std::istringstream in("POINT (1 1) POINT EMPTY\n"
+                          "POLYGON ((0 0, 1 0,\n"
+                          "  1 1, 0 0))\n"
+                          "\n"
+                          "LINESTRING EMPTY\n");
+    geos::io::WKTStreamReader reader(in);
+
+    ensure_equals(reader.next()->toString(), "POINT (1 1)");
+    ensure_equals(reader.next()->toString(), "POINT EMPTY");
+    ensure_equals(reader.next()->toString(), "POLYGON ((0 0, 1 0, 1 1, 0 0))");
+    ensure_equals(reader.next()->toString(), "LINESTRING EMPTY");
+    ensure(reader.next() == nullptr);
+    ensure(reader.next() == nullptr);
+}
+
+// Empty stream
+template<>
+template<>
+void object::test<2>
+()
+{
+    std::istringstream in("\n");
+    geos::io::WKTStreamReader reader(in);
+    ensure(reader.next() == nullptr);
+}
+
+// Tokens and geometries split across chunks
+template<>
+template<>
+void object::test<3>
+()
+{
+    const std::string text = "POINT (123.456 -7e2) point empty\n"
+                             "GEOMETRYCOLLECTION (POINT EMPTY, LINESTRING (10 20, 30 40))"
+                             "MULTIPOINT ((1 2), (3 4))\tPOLYGON Z EMPTY\n"
+                             "LINESTRING (1.5 2.5, 3.5 4.5)";
+    const std::vector<std::string> expected = {
+        "POINT (123.456 -700)",
+        "POINT EMPTY",
+        "GEOMETRYCOLLECTION (POINT EMPTY, LINESTRING (10 20, 30 40))",
+        "MULTIPOINT ((1 2), (3 4))",
+        "POLYGON Z EMPTY",
+        "LINESTRING (1.5 2.5, 3.5 4.5)"
+    };
+
+    for (std::size_t chunkSize = 1; chunkSize <= text.size() + 1; chunkSize++) {
+        std::istringstream in(text);
+        geos::io::WKTStreamReader reader(in, chunkSize);
+        for (const auto& wkt : expected) {
+            auto g = reader.next();
+            ensure(wkt, g != nullptr);
+            ensure_equals(g->toString(), wkt);
+        }
+        ensure(reader.next() == nullptr);
+    }
+}
+
+// Invalid and truncated text
+template<>
+template<>
+void object::test<4>
+()
+{
+    for (const char* text : { "POINT (1 1) LINESTRING (1 2, 3", "POINT (1 1) POLYGON" }) {
+        std::istringstream in(text);
+        geos::io::WKTStreamReader reader(in, 4);
+        ensure_equals(reader.next()->toString(), "POINT (1 1)");
+        ensure_THROW(reader.next(), geos::io::ParseException);
+    }
+}
+
+} // namespace tut
@@ -6,6 +6,7 @@
 // geos
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/io/Writer.h>
 #include <geos/geom/CircularString.h>
 #include <geos/geom/CompoundCurve.h>
 #include <geos/geom/CurvePolygon.h>
@@ -22,6 +23,7 @@
 // std
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace tut {
 //
@@ -815,4 +817,35 @@ void object::test<22>()
 
 
 
+// Writing to a reused Writer
+template<>
+template<>
+void object::test<23>()
+{
+    std::vector<std::string> wkts = {
+        "POINT (1.5 -2.25)",
+        "LINESTRING Z (0.1 0.2 0.3, 1e-07 2e+20 3)",
+        "POLYGON EMPTY",
+        "GEOMETRYCOLLECTION (POINT (1 1), MULTIPOINT ((2 2), (3 3)))",
+    };
+
+    for (bool trim : { true, false }) {
+        wktwriter.setTrim(trim);
+        geos::io::Writer writer;
+        for (const auto& wkt : wkts) {
+            auto geom = wktreader.read(wkt);
+            std::string expected = wktwriter.write(geom.get());
+
+            writer.clear();
+            wktwriter.write(geom.get(), &writer);
+            ensure_equals(std::string(writer.data(), writer.size()), expected);
+        }
+
+        // output is appended
+        auto geom = wktreader.read(wkts[0]);
+        wktwriter.write(geom.get(), &writer);
+        ensure_equals(writer.toString(), wktwriter.write(wktreader.read(wkts[3]).get()) + wktwriter.write(geom.get()));
+    }
+}
+
 } // namespace tut
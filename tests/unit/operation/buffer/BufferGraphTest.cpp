@@ -0,0 +1,273 @@
+//
+// Test Suite for geos::operation::buffer::BufferGraph class.
+
+// tut
+#include <tut/tut.hpp>
+#include <tut/tut_macros.hpp>
+#include <utility.h>
+// geos
+#include <geos/operation/buffer/BufferGraph.h>
+#include <geos/operation/buffer/BufferOp.h>
+#include <geos/operation/buffer/BufferParameters.h>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/Geometry.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/Surface.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/TopologyException.h>
+// std
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::geom::CoordinateSequence;
+using geos::geom::CoordinateXY;
+using geos::geom::Geometry;
+using geos::geom::Surface;
+using geos::operation::buffer::BufferGraph;
+using geos::operation::buffer::BufferOp;
+using geos::operation::buffer::BufferParameters;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_buffergraph_data {
+    const geos::geom::GeometryFactory& gf;
+    geos::io::WKTReader wktreader;
+
+    test_buffergraph_data()
+        : gf(*geos::geom::GeometryFactory::getDefaultInstance())
+        , wktreader(&gf)
+    {}
+
+    static std::shared_ptr<const CoordinateSequence>
+    section(std::initializer_list<CoordinateXY> pts)
+    {
+        return std::make_shared<CoordinateSequence>(pts);
+    }
+
+    static double
+    area(const std::vector<std::unique_ptr<Surface>>& polys)
+    {
+        double a = 0;
+        for (const auto& p : polys) {
+            a += p->getArea();
+        }
+        return a;
+    }
+
+    void
+    checkPolygon(const Surface& poly, const std::string& expected)
+    {
+        auto expectedGeom = wktreader.read(expected);
+        ensure_equals_geometry(static_cast<const Geometry*>(&poly),
+                               static_cast<const Geometry*>(expectedGeom.get()));
+    }
+
+    // Checks a buffer against the result of the buffer builder
+    // before it used BufferGraph, with 2 quadrant segments.
+    void
+    checkBuffer(const std::string& wkt, double distance, const std::string& expected)
+    {
+        auto geom = wktreader.read(wkt);
+        BufferParameters params(2);
+        auto result = BufferOp::bufferOp(geom.get(), distance, params);
+        auto expectedGeom = wktreader.read(expected);
+        ensure_equals_geometry(result.get(), expectedGeom.get(), 1e-6);
+    }
+};
+
+typedef test_group<test_buffergraph_data> group;
+typedef group::object object;
+
+group test_buffergraph_group("geos::operation::buffer::BufferGraph");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>
+()
+{
+    set_test_name("single ring");
+
+    BufferGraph graph;
+    ensure(graph.isEmpty());
+    graph.addEdge(section({ {0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0} }), 1);
+    ensure(!graph.isEmpty());
+
+    auto polys = graph.getPolygons(&gf);
+    ensure_equals(polys.size(), 1u);
+    checkPolygon(*polys[0], "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+}
+
+template<>
+template<>
+void object::test<2>
+()
+{
+    set_test_name("hole from a clockwise ring");
+
+    BufferGraph graph;
+    graph.addEdge(section({ {0, 0}, {20, 0}, {20, 20}, {0, 20}, {0, 0} }), 1);
+    graph.addEdge(section({ {5, 5}, {5, 15}, {15, 15}, {15, 5}, {5, 5} }), 1);
+
+    auto polys = graph.getPolygons(&gf);
+    ensure_equals(polys.size(), 1u);
+    checkPolygon(*polys[0], "POLYGON ((0 0, 20 0, 20 20, 0 20, 0 0), (5 5, 5 15, 15 15, 15 5, 5 5))");
+}
+
+template<>
+template<>
+void object::test<3>
+()
+{
+    set_test_name("overlapping rings have depth 2 where they overlap");
+
+    BufferGraph graph;
+    // noded at (10 5) and (5 10)
+    graph.addEdge(section({ {0, 0}, {10, 0}, {10, 5} }), 1);
+    graph.addEdge(section({ {10, 5}, {10, 10}, {5, 10} }), 1);
+    graph.addEdge(section({ {5, 10}, {0, 10}, {0, 0} }), 1);
+    graph.addEdge(section({ {5, 5}, {10, 5} }), 1);
+    graph.addEdge(section({ {10, 5}, {15, 5}, {15, 15}, {5, 15}, {5, 10} }), 1);
+    graph.addEdge(section({ {5, 10}, {5, 5} }), 1);
+
+    auto polys = graph.getPolygons(&gf);
+    ensure_equals(polys.size(), 1u);
+    ensure_equals(area(polys), 175.0);
+    ensure_equals(polys[0]->getNumInteriorRing(), 0u);
+}
+
+template<>
+template<>
+void object::test<4>
+()
+{
+    set_test_name("rings touching at a vertex");
+
+    BufferGraph graph;
+    graph.addEdge(section({ {10, 10}, {0, 10}, {0, 0}, {10, 0}, {10, 10} }), 1);
+    graph.addEdge(section({ {10, 10}, {20, 10}, {20, 20}, {10, 20}, {10, 10} }), 1);
+
+    auto polys = graph.getPolygons(&gf);
+    ensure_equals(polys.size(), 2u);
+    ensure_equals(area(polys), 200.0);
+}
+
+template<>
+template<>
+void object::test<5>
+()
+{
+    set_test_name("coincident edges in opposite directions cancel");
+
+    BufferGraph graph;
+    graph.addEdge(section({ {10, 0}, {10, 10} }), 1);
+    graph.addEdge(section({ {10, 10}, {0, 10}, {0, 0}, {10, 0} }), 1);
+    graph.addEdge(section({ {10, 10}, {10, 0} }), 1);
+    graph.addEdge(section({ {10, 0}, {20, 0}, {20, 10}, {10, 10} }), 1);
+
+    auto polys = graph.getPolygons(&gf);
+    ensure_equals(polys.size(), 1u);
+    // the nodes of the cancelled edge remain as vertices
+    checkPolygon(*polys[0], "POLYGON ((0 0, 10 0, 20 0, 20 10, 10 10, 0 10, 0 0))");
+}
+
+template<>
+template<>
+void object::test<6>
+()
+{
+    set_test_name("ring fully inside another has no boundary");
+
+    BufferGraph graph;
+    graph.addEdge(section({ {0, 0}, {20, 0}, {20, 20}, {0, 20}, {0, 0} }), 1);
+    graph.addEdge(section({ {5, 5}, {15, 5}, {15, 15}, {5, 15}, {5, 5} }), 1);
+
+    auto polys = graph.getPolygons(&gf);
+    ensure_equals(polys.size(), 1u);
+    ensure_equals(polys[0]->getNumInteriorRing(), 0u);
+    ensure_equals(area(polys), 400.0);
+}
+
+template<>
+template<>
+void object::test<7>
+()
+{
+    set_test_name("inconsistent depths");
+
+    BufferGraph graph;
+    graph.addEdge(section({ {0, 0}, {10, 0} }), 1);
+
+    ensure_THROW(graph.getPolygons(&gf), geos::util::TopologyException);
+}
+
+template<>
+template<>
+void object::test<8>
+()
+{
+    set_test_name("empty graph");
+
+    BufferGraph graph;
+    ensure(graph.getPolygons(&gf).empty());
+}
+
+template<>
+template<>
+void object::test<9>
+()
+{
+    set_test_name("same buffers as before BufferGraph, holes");
+
+    const std::string wkt = "POLYGON ((0 0, 20 0, 20 20, 0 20, 0 0), (5 5, 15 5, 15 15, 5 15, 5 5))";
+
+    checkBuffer(wkt, 2,
+                "POLYGON ((-2 0, -2 20, -1.414214 21.414214, 0 22, 20 22, 21.414214 21.414214, 22 20, 22 0, 21.414214 -1.414214, 20 -2, 0 -2, -1.414214 -1.414214, -2 0), (7 7, 13 7, 13 13, 7 13, 7 7))");
+    checkBuffer(wkt, -2,
+                "POLYGON ((2 2, 2 18, 18 18, 18 2, 2 2), (3 5, 3.585786 3.585786, 5 3, 15 3, 16.414214 3.585786, 17 5, 17 15, 16.414214 16.414214, 15 17, 5 17, 3.585786 16.414214, 3 15, 3 5))");
+    checkBuffer(wkt, 3,
+                "POLYGON ((-3 0, -3 20, -2.12132 22.12132, 0 23, 20 23, 22.12132 22.12132, 23 20, 23 0, 22.12132 -2.12132, 20 -3, 0 -3, -2.12132 -2.12132, -3 0), (8 8, 12 8, 12 12, 8 12, 8 8))");
+    checkBuffer("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (0 0, 5 2, 10 0, 5 8, 0 0))", 1,
+                "POLYGON ((-1 0, -1 10, -0.707107 10.707107, 0 11, 10 11, 10.707107 10.707107, 11 10, 11 0, 10.707107 -0.707107, 10 -1, 0 -1, -0.707107 -0.707107, -1 0), (2.469858 2.064976, 4.628609 2.928477, 5.371391 2.928477, 7.530142 2.064976, 5 6.113204, 2.469858 2.064976))");
+}
+
+template<>
+template<>
+void object::test<10>
+()
+{
+    set_test_name("same buffers as before BufferGraph, touching rings");
+
+    checkBuffer("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((10 10, 20 10, 20 20, 10 20, 10 10)))", 1,
+                "POLYGON ((-1 0, -1 10, -0.707107 10.707107, 0 11, 9 11, 9 20, 9.292893 20.707107, 10 21, 20 21, 20.707107 20.707107, 21 20, 21 10, 20.707107 9.292893, 20 9, 11 9, 11 0, 10.707107 -0.707107, 10 -1, 0 -1, -0.707107 -0.707107, -1 0))");
+    checkBuffer("MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((10 0, 20 0, 20 10, 10 10, 10 0)))", -1,
+                "MULTIPOLYGON (((11 1, 11 9, 19 9, 19 1, 11 1)), ((1 1, 1 9, 9 9, 9 1, 1 1)))");
+    checkBuffer("LINESTRING (0 0, 10 0, 10 10, 0 10, 0 1)", 1,
+                "POLYGON ((-0.792893 0.5, -1 1, -1 10, -0.707107 10.707107, 0 11, 10 11, 10.707107 10.707107, 11 10, 11 0, 10.707107 -0.707107, 10 -1, 0 -1, -0.707107 -0.707107, -1 0, -0.792893 0.5), (1 1, 9 1, 9 9, 1 9, 1 1))");
+}
+
+template<>
+template<>
+void object::test<11>
+()
+{
+    set_test_name("same buffers as before BufferGraph, negative distances and collapses");
+
+    checkBuffer("POLYGON ((0 0, 10 0, 10 10, 5 5, 0 10, 0 0))", -2,
+                "POLYGON ((2 2, 2 5.171573, 3.585786 3.585786, 5 3, 6.414214 3.585786, 8 5.171573, 8 2, 2 2))");
+    checkBuffer("POLYGON ((0 0, 30 0, 30 10, 0 10, 0 0))", -4,
+                "POLYGON ((4 4, 4 6, 26 6, 26 4, 4 4))");
+    checkBuffer("POLYGON ((0 0, 30 0, 30 1, 0 1, 0 0))", -1,
+                "POLYGON EMPTY");
+}
+
+} // namespace tut
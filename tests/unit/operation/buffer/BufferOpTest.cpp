@@ -16,9 +16,11 @@
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/geom/CoordinateSequence.h>
+#include <geos/util/TaskPool.h>
 // std
 #include <memory>
 #include <string>
+#include <vector>
 
 using namespace geos::operation::buffer;
 
@@ -715,6 +717,42 @@ void object::test<34> ()
     checkBufferPolygonEmpty(*geom, 1, true);
 }
 
+template<>
+template<>
+void object::test<35> ()
+{
+    set_test_name("bufferBatch gives the same results as bufferOp");
 
+    std::vector<std::unique_ptr<Geometry>> inputs;
+    inputs.push_back(wktreader.read("POINT (0 0)"));
+    inputs.push_back(wktreader.read("POLYGON EMPTY"));
+    inputs.push_back(wktreader.read("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0), (2 2, 8 2, 8 8, 2 8, 2 2))"));
+    for (int i = 0; i < 40; i++) {
+        double x = 3 * i;
+        std::string wkt = "LINESTRING (" + std::to_string(x) + " 0, " + std::to_string(x + 5) + " 7, "
+            + std::to_string(x - 1) + " 3, " + std::to_string(x + 4) + " -2)";
+        inputs.push_back(wktreader.read(wkt));
+    }
+    std::vector<const Geometry*> geoms;
+    for (const auto& g : inputs) {
+        geoms.push_back(g.get());
+    }
+
+    BufferParameters params;
+    params.setQuadrantSegments(4);
+    params.setEndCapStyle(BufferParameters::CAP_SQUARE);
+
+    geos::util::TaskPool pool(3);
+    for (geos::util::TaskPool* p : { static_cast<geos::util::TaskPool*>(nullptr), &pool }) {
+        auto results = BufferOp::bufferBatch(geoms.data(), geoms.size(), 1.5, params, p);
+        ensure_equals(results.size(), geoms.size());
+        for (std::size_t i = 0; i < geoms.size(); i++) {
+            auto expected = BufferOp::bufferOp(geoms[i], 1.5, params);
+            ensure(results[i]->equalsIdentical(expected.get()));
+        }
+    }
+
+    ensure(BufferOp::bufferBatch(geoms.data(), 0, 1.5, params, &pool).empty());
+}
 
 } // namespace tut
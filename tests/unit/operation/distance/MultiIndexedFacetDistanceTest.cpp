@@ -0,0 +1,182 @@
+//
+// Test Suite for geos::operation::distance::MultiIndexedFacetDistance class.
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+// tut
+#include <tut/tut.hpp>
+#include <utility.h>
+// geos
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+#include <geos/operation/distance/MultiIndexedFacetDistance.h>
+
+using geos::operation::distance::MultiIndexedFacetDistance;
+using geos::geom::Geometry;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by tests
+struct test_multiindexedfacetdistance_data {
+
+    geos::io::WKTReader reader;
+    std::vector<std::unique_ptr<Geometry>> geoms;
+
+    MultiIndexedFacetDistance build(const std::vector<std::string>& wkts)
+    {
+        for (const auto& wkt : wkts) {
+            geoms.push_back(reader.read(wkt));
+        }
+        return MultiIndexedFacetDistance(ptrs());
+    }
+
+    std::vector<const Geometry*> ptrs() const
+    {
+        std::vector<const Geometry*> ret;
+        for (const auto& g : geoms) {
+            ret.push_back(g.get());
+        }
+        return ret;
+    }
+
+    // Brute-force facet distances, sorted
+    std::vector<std::pair<double, std::size_t>> bruteForce(const Geometry* q)
+    {
+        std::vector<std::pair<double, std::size_t>> ret;
+        for (std::size_t i = 0; i < geoms.size(); i++) {
+            if (geoms[i]->isEmpty()) continue;
+            auto bnd = geoms[i]->getDimension() == 2 ? geoms[i]->getBoundary() : geoms[i]->clone();
+            ret.emplace_back(bnd->distance(q), i);
+        }
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+};
+
+typedef test_group<test_multiindexedfacetdistance_data> group;
+typedef group::object object;
+
+group test_multiindexedfacetdistance_group("geos::operation::distance::MultiIndexedFacetDistance");
+
+//
+// Test Cases
+//
+
+// k nearest geometries with exact distances
+template<>
+template<>
+void object::test<1>()
+{
+    auto index = build({
+        "POINT (10 0)",
+        "LINESTRING (0 5, 10 5)",
+        "POLYGON ((20 20, 20 30, 30 30, 30 20, 20 20))",
+        "MULTIPOINT ((3 4.5), (100 100))",
+        "LINESTRING EMPTY",
+    });
+
+    auto q = reader.read("POINT (0 0)");
+    auto result = index.nearest(q.get(), 3);
+
+    ensure_equals(result.size(), 3u);
+    ensure_equals(result[0].index, 1u);
+    ensure_equals(result[0].distance, 5.0);
+    ensure_equals(result[1].index, 3u);
+    ensure_equals(result[1].distance, std::sqrt(29.25));
+    ensure_equals(result[2].index, 0u);
+    ensure_equals(result[2].distance, 10.0);
+
+    // more neighbours requested than non-empty geometries
+    result = index.nearest(q.get(), 10);
+    ensure_equals(result.size(), 4u);
+    ensure_equals(result[3].index, 2u);
+}
+
+// Geometries within a distance
+template<>
+template<>
+void object::test<2>()
+{
+    auto index = build({
+        "POINT (10 0)",
+        "LINESTRING (0 5, 10 5)",
+        "POLYGON ((20 20, 20 30, 30 30, 30 20, 20 20))",
+        "MULTIPOINT ((3 4), (100 100))",
+    });
+
+    auto q = reader.read("LINESTRING (0 0, 1 0)");
+
+    auto result = index.withinDistance(q.get(), 5.0);
+    ensure_equals(result.size(), 2u);
+    ensure_equals(result[0].index, 3u);
+    ensure_equals(result[0].distance, std::sqrt(20.0));
+    ensure_equals(result[1].index, 1u);
+    ensure_equals(result[1].distance, 5.0);
+
+    // distance is inclusive
+    result = index.withinDistance(q.get(), 9.0);
+    ensure_equals(result.size(), 3u);
+    ensure_equals(result[2].index, 0u);
+
+    ensure(index.withinDistance(q.get(), 1.0).empty());
+}
+
+// Results agree with brute force
+template<>
+template<>
+void object::test<3>()
+{
+    std::vector<std::string> wkts;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            double x = i * 10 + (j % 3);
+            double y = j * 10 + (i % 4);
+            wkts.push_back("LINESTRING (" + std::to_string(x) + " " + std::to_string(y) + ", "
+                           + std::to_string(x + 4) + " " + std::to_string(y + 3) + ", "
+                           + std::to_string(x + 1) + " " + std::to_string(y + 6) + ")");
+        }
+    }
+    auto index = build(wkts);
+    ensure_equals(index.size(), 400u);
+
+    auto q = reader.read("LINESTRING (33.3 71.7, 58.2 77.1)");
+    auto expected = bruteForce(q.get());
+
+    auto result = index.nearest(q.get(), 15);
+    ensure_equals(result.size(), 15u);
+    for (std::size_t i = 0; i < result.size(); i++) {
+        ensure_distance(result[i].distance, expected[i].first, 1e-12);
+    }
+
+    double d = expected[30].first;
+    result = index.withinDistance(q.get(), d);
+    std::size_t n = 0;
+    while (n < expected.size() && expected[n].first <= d) n++;
+    ensure_equals(result.size(), n);
+}
+
+// Empty query or index
+template<>
+template<>
+void object::test<4>()
+{
+    auto index = build({ "POINT (1 1)" });
+    auto empty = reader.read("POINT EMPTY");
+    ensure(index.nearest(empty.get(), 1).empty());
+
+    MultiIndexedFacetDistance emptyIndex({});
+    auto q = reader.read("POINT (0 0)");
+    ensure(emptyIndex.nearest(q.get(), 1).empty());
+    ensure(emptyIndex.withinDistance(q.get(), 10).empty());
+}
+
+} // namespace tut
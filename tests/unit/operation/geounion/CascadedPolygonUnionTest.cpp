@@ -12,6 +12,7 @@
 #include <geos/geom/Point.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/util/TaskPool.h>
 // std
 #include <memory>
 #include <string>
@@ -108,7 +109,7 @@ void object::test<1>
 }
 
 void
-create_discs(geos::geom::GeometryFactory& gf, int num, double radius,
+create_discs(const geos::geom::GeometryFactory& gf, int num, double radius,
              std::vector<geos::geom::Polygon*>* g)
 {
     for(int i = 0; i < num; ++i) {
@@ -149,5 +150,41 @@ create_discs(geos::geom::GeometryFactory& gf, int num, double radius,
 //         std::for_each(g.begin(), g.end(), delete_geometry);
 //     }
 
+template<>
+template<>
+void object::test<4>()
+{
+    set_test_name("union using a task pool matches sequential union");
+
+    std::vector<geos::geom::Polygon*> discs;
+    create_discs(gf, 12, 0.7, &discs);
+    std::vector<const geos::geom::Surface*> g(discs.begin(), discs.end());
+
+    using geos::operation::geounion::CascadedPolygonUnion;
+    using geos::operation::geounion::ClassicUnionStrategy;
+
+    ClassicUnionStrategy strategy;
+    geos::util::TaskPool pool(3);
+
+    std::size_t numCalls = 0;
+    double lastProgress = 0;
+    geos::util::ProgressFunction progress = [&numCalls, &lastProgress](double p, const char*) {
+        ensure(p >= lastProgress);
+        lastProgress = p;
+        numCalls++;
+    };
+
+    auto expected = CascadedPolygonUnion::Union(g);
+    auto result = CascadedPolygonUnion::Union(g, &strategy, &progress, &pool);
+
+    ensure_equals(numCalls, g.size());
+    ensure_equals(lastProgress, 1.0);
+    ensure(result->equalsExact(expected.get()));
+
+    for (auto& p : discs) {
+        delete p;
+    }
+}
+
 } // namespace tut
 
@@ -0,0 +1,181 @@
+//
+// Test Suite for geos::operation::join::SpatialJoin
+
+// tut
+#include <tut/tut.hpp>
+// geos
+#include <geos/operation/join/SpatialJoin.h>
+#include <geos/geom/Geometry.h>
+#include <geos/io/WKTReader.h>
+#include <geos/util/IllegalArgumentException.h>
+#include <geos/util/TaskPool.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using geos::geom::Geometry;
+using geos::operation::join::SpatialJoin;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_spatialjoin_data {
+    geos::io::WKTReader reader;
+    std::vector<std::unique_ptr<Geometry>> owned;
+
+    std::vector<const Geometry*>
+    readAll(const std::vector<std::string>& wkts)
+    {
+        std::vector<const Geometry*> result;
+        for (const auto& wkt : wkts) {
+            owned.push_back(reader.read(wkt));
+            result.push_back(owned.back().get());
+        }
+        return result;
+    }
+
+    static std::string
+    toString(const std::vector<SpatialJoin::IndexPair>& pairs)
+    {
+        std::string s;
+        for (const auto& p : pairs) {
+            s += "(" + std::to_string(p.first) + ", " + std::to_string(p.second) + ")";
+        }
+        return s;
+    }
+
+    static void
+    ensure_pairs(const std::string& msg,
+                 const std::vector<SpatialJoin::IndexPair>& actual,
+                 const std::vector<SpatialJoin::IndexPair>& expected)
+    {
+        ensure_equals(msg, toString(actual), toString(expected));
+    }
+};
+
+typedef test_group<test_spatialjoin_data> group;
+typedef group::object object;
+
+group test_spatialjoin_group("geos::operation::join::SpatialJoin");
+
+// Basic predicates
+template<>
+template<>
+void object::test<1>
+()
+{
+    auto left = readAll({
+        "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))",
+        "POLYGON ((20 0, 30 0, 30 10, 20 10, 20 0))",
+        "POINT (5 5)",
+        "POLYGON EMPTY"
+    });
+    auto right = readAll({
+        "POINT (1 1)",
+        "POINT (9 9)",
+        "LINESTRING (5 5, 25 5)",
+        "POINT (35 5)",
+        "POLYGON ((4 4, 6 4, 6 6, 4 6, 4 4))"
+    });
+    left.push_back(nullptr);
+
+    SpatialJoin sj(left, right);
+
+    ensure_pairs("intersects", sj.intersects(),
+                  {{0, 0}, {0, 1}, {0, 2}, {0, 4}, {1, 2}, {2, 2}, {2, 4}});
+    ensure_pairs("contains", sj.contains(),
+                  {{0, 0}, {0, 1}, {0, 4}});
+    ensure_pairs("within", sj.within(),
+                  {{2, 4}});
+    ensure_pairs("isWithinDistance", sj.isWithinDistance(5),
+                  {{0, 0}, {0, 1}, {0, 2}, {0, 4}, {1, 2}, {1, 3}, {2, 2}, {2, 4}});
+    ensure_pairs("relate", sj.relate("T*F**F***"),
+                  {{2, 4}});
+}
+
+// Empty inputs and invalid arguments
+template<>
+template<>
+void object::test<2>
+()
+{
+    auto geoms = readAll({ "POINT (1 1)" });
+    std::vector<const Geometry*> none;
+
+    ensure("empty left", SpatialJoin(none, geoms).intersects().empty());
+    ensure("empty right", SpatialJoin(geoms, none).intersects().empty());
+
+    try {
+        SpatialJoin(geoms, geoms).isWithinDistance(-1);
+        fail("IllegalArgumentException not thrown");
+    } catch (const geos::util::IllegalArgumentException&) {}
+}
+
+// Joining on a TaskPool returns the same pairs as a nested loop
+template<>
+template<>
+void object::test<3>
+()
+{
+    std::vector<std::string> lwkt;
+    std::vector<std::string> rwkt;
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 40; j++) {
+            lwkt.push_back("POINT (" + std::to_string(i) + " " + std::to_string(j) + ")");
+        }
+    }
+    for (int i = 0; i < 20; i++) {
+        double x = (i * 7) % 37;
+        double y = (i * 11) % 31;
+        rwkt.push_back("POLYGON ((" +
+                       std::to_string(x) + " " + std::to_string(y) + ", " +
+                       std::to_string(x + 4.5) + " " + std::to_string(y) + ", " +
+                       std::to_string(x) + " " + std::to_string(y + 4.5) + ", " +
+                       std::to_string(x) + " " + std::to_string(y) + "))");
+    }
+    auto left = readAll(lwkt);
+    auto right = readAll(rwkt);
+
+    std::vector<SpatialJoin::IndexPair> expected;
+    for (std::size_t i = 0; i < left.size(); i++) {
+        for (std::size_t j = 0; j < right.size(); j++) {
+            if (left[i]->within(right[j])) {
+                expected.emplace_back(i, j);
+            }
+        }
+    }
+    ensure("test produces matches", !expected.empty());
+
+    geos::util::TaskPool pool(4);
+    SpatialJoin sj(left, right);
+    ensure_pairs("sequential", sj.within(), expected);
+
+    sj.setTaskPool(&pool);
+    ensure_pairs("parallel", sj.within(), expected);
+}
+
+// Patterns not requiring interaction would miss envelope-disjoint pairs
+template<>
+template<>
+void object::test<4>
+()
+{
+    auto left = readAll({ "POINT (0 0)" });
+    auto right = readAll({ "POINT (10 10)", "POINT (0 0)" });
+    SpatialJoin sj(left, right);
+
+    for (const std::string pattern : { "FF*FF****", "F********", "*********", "FF*FF*212" }) {
+        try {
+            sj.relate(pattern);
+            fail("IllegalArgumentException not thrown for " + pattern);
+        } catch (const geos::util::IllegalArgumentException&) {}
+    }
+
+    ensure_pairs("II", sj.relate("0********"), {{0, 1}});
+    ensure_pairs("BB", sj.relate("FFFF0FFF*"), {});
+}
+
+} // namespace tut
@@ -0,0 +1,120 @@
+//
+// Test Suite for geos::operation::overlayng::OverlayContext class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/operation/overlayng/OverlayContext.h>
+#include <geos/operation/overlayng/OverlayNG.h>
+#include <geos/operation/overlayng/OverlayNGRobust.h>
+
+// std
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::operation::overlayng;
+using geos::io::WKTReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_overlaycontext_data {
+
+    WKTReader r;
+    OverlayContext context;
+
+    void
+    checkOverlay(const std::string& a, const std::string& b, int opCode, double scaleFactor)
+    {
+        std::unique_ptr<PrecisionModel> pm;
+        if (scaleFactor > 0)
+            pm.reset(new PrecisionModel(scaleFactor));
+        else
+            pm.reset(new PrecisionModel());
+
+        auto geom_a = r.read(a);
+        auto geom_b = r.read(b);
+        auto expected = OverlayNG::overlay(geom_a.get(), geom_b.get(), opCode, pm.get());
+        auto result = context.overlay(geom_a.get(), geom_b.get(), opCode, pm.get());
+        ensure_equals_exact_geometry(expected.get(), result.get(), 0);
+    }
+};
+
+typedef test_group<test_overlaycontext_data> group;
+typedef group::object object;
+
+group test_overlaycontext_group("geos::operation::overlayng::OverlayContext");
+
+//
+// Test Cases
+//
+
+// Reused context gives the same results as a fresh operation
+template<>
+template<>
+void object::test<1> ()
+{
+    const std::string a = "POLYGON ((1 1, 1 9, 9 9, 9 1, 1 1), (3 3, 7 3, 7 7, 3 7, 3 3))";
+    const std::string b = "POLYGON ((5 0, 5 10, 12 10, 12 0, 5 0))";
+    for (int opCode : { OverlayNG::INTERSECTION, OverlayNG::UNION,
+                        OverlayNG::DIFFERENCE, OverlayNG::SYMDIFFERENCE }) {
+        checkOverlay(a, b, opCode, 0);
+        checkOverlay(a, b, opCode, 1);
+    }
+}
+
+// Alternating large and small inputs, and lines
+template<>
+template<>
+void object::test<2> ()
+{
+    checkOverlay("POLYGON ((0 0, 0 100, 100 100, 100 0, 0 0))",
+                 "MULTIPOLYGON (((10 10, 10 20, 20 20, 20 10, 10 10)), ((50 50, 50 150, 150 150, 150 50, 50 50)))",
+                 OverlayNG::UNION, 0);
+    checkOverlay("LINESTRING (0 0, 10 10)", "LINESTRING (0 10, 10 0)",
+                 OverlayNG::INTERSECTION, 0);
+    checkOverlay("POLYGON ((0 0, 0 1, 1 1, 1 0, 0 0))", "LINESTRING (-1 0.5, 2 0.5)",
+                 OverlayNG::INTERSECTION, 0);
+    checkOverlay("POLYGON ((0 0, 0 1, 1 1, 1 0, 0 0))", "POLYGON ((2 2, 2 3, 3 3, 3 2, 2 2))",
+                 OverlayNG::INTERSECTION, 0);
+}
+
+// Context is usable after an operation fails
+template<>
+template<>
+void object::test<3> ()
+{
+    auto geom_a = r.read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    auto mixed = r.read("GEOMETRYCOLLECTION (POLYGON ((0 0, 0 1, 1 1, 1 0, 0 0)), LINESTRING (0 0, 2 2))");
+    PrecisionModel pm;
+    try {
+        context.overlay(mixed.get(), geom_a.get(), OverlayNG::INTERSECTION, &pm);
+        fail("expected exception");
+    }
+    catch (const geos::util::GEOSException&) {
+    }
+
+    checkOverlay("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))",
+                 "POLYGON ((5 5, 5 15, 15 15, 15 5, 5 5))",
+                 OverlayNG::INTERSECTION, 0);
+}
+
+// overlayRobust matches OverlayNGRobust
+template<>
+template<>
+void object::test<4> ()
+{
+    auto geom_a = r.read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    auto geom_b = r.read("POLYGON ((5 5, 5 15, 15 15, 15 5, 5 5))");
+    for (int i = 0; i < 3; i++) {
+        auto expected = OverlayNGRobust::Overlay(geom_a.get(), geom_b.get(), OverlayNG::DIFFERENCE);
+        auto result = context.overlayRobust(geom_a.get(), geom_b.get(), OverlayNG::DIFFERENCE);
+        ensure_equals_exact_geometry(expected.get(), result.get(), 0);
+    }
+}
+
+} // namespace tut
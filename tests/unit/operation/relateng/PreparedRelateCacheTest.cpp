@@ -0,0 +1,171 @@
+//
+// Test Suite for geos::operation::relateng::PreparedRelateCache class.
+
+#include <tut/tut.hpp>
+#include <utility.h>
+
+// geos
+#include <geos/io/WKTReader.h>
+#include <geos/geom/CoordinateFilter.h>
+#include <geos/geom/Geometry.h>
+#include <geos/operation/relateng/PreparedRelateCache.h>
+#include <geos/operation/relateng/RelateNG.h>
+
+// std
+#include <memory>
+
+using namespace geos::geom;
+using namespace geos::operation::relateng;
+using geos::io::WKTReader;
+
+namespace tut {
+//
+// Test Group
+//
+
+// Common data used by all tests
+struct test_preparedrelatecache_data {
+
+    WKTReader r;
+
+    std::unique_ptr<Geometry> square = r.read("POLYGON ((0 0, 0 10, 10 10, 10 0, 0 0))");
+    std::unique_ptr<Geometry> line = r.read("LINESTRING (0 0, 5 5, 10 0, 15 5)");
+    std::unique_ptr<Geometry> point = r.read("POINT (5 5)");
+
+};
+
+typedef test_group<test_preparedrelatecache_data> group;
+typedef group::object object;
+
+group test_preparedrelatecache_group("geos::operation::relateng::PreparedRelateCache");
+
+// Geometry is prepared on the first lookup and reused afterwards
+template<>
+template<>
+void object::test<1> ()
+{
+    PreparedRelateCache cache(1 << 20);
+    ensure(cache.get(square.get()) == nullptr);
+    cache.add(square.get());
+
+    RelateNG* prep = cache.get(square.get());
+    ensure(prep != nullptr);
+    ensure(prep->contains(point.get()));
+    ensure(cache.get(square.get()) == prep);
+
+    ensure_equals("hits", cache.getHits(), 1u);
+    ensure_equals("misses", cache.getMisses(), 1u);
+    ensure_equals("size", cache.size(), 1u);
+    ensure_equals("memory", cache.getMemoryUsed(), PreparedRelateCache::estimateMemory(square.get()));
+}
+
+// Least recently used geometry is evicted to stay within the budget
+template<>
+template<>
+void object::test<2> ()
+{
+    std::size_t budget = PreparedRelateCache::estimateMemory(square.get())
+        + PreparedRelateCache::estimateMemory(line.get());
+    PreparedRelateCache cache(budget);
+    cache.add(square.get());
+    cache.add(line.get());
+    cache.add(point.get());
+
+    ensure(cache.get(square.get()) != nullptr);
+    ensure(cache.get(line.get()) != nullptr);
+    ensure_equals(cache.size(), 2u);
+
+    // touch square so that line is least recently used
+    ensure(cache.get(square.get()) != nullptr);
+    ensure(cache.get(point.get()) != nullptr);
+    ensure_equals(cache.size(), 2u);
+    ensure(cache.getMemoryUsed() <= budget);
+
+    ensure_equals("hits", cache.getHits(), 1u);
+    // line was evicted, so it is a miss again
+    cache.get(line.get());
+    ensure_equals("hits after eviction", cache.getHits(), 1u);
+}
+
+// Geometry larger than the budget is never cached
+template<>
+template<>
+void object::test<3> ()
+{
+    PreparedRelateCache cache(PreparedRelateCache::estimateMemory(point.get()));
+    cache.add(square.get());
+    cache.add(point.get());
+
+    ensure(cache.get(square.get()) == nullptr);
+    ensure(cache.get(point.get()) != nullptr);
+    ensure_equals(cache.size(), 1u);
+}
+
+// Changed geometry at the same address is not matched
+template<>
+template<>
+void object::test<4> ()
+{
+    PreparedRelateCache cache(1 << 20);
+    cache.add(square.get());
+
+    RelateNG* prep = cache.get(square.get());
+    ensure(prep != nullptr);
+    ensure(prep->intersects(point.get()));
+
+    struct Translate : public CoordinateFilter {
+        void filter_rw(CoordinateXY* c) const override { c->x += 100; }
+    } translate;
+    square->apply_rw(&translate);
+    square->geometryChanged();
+
+    prep = cache.get(square.get());
+    ensure(prep != nullptr);
+    ensure_equals("hits", cache.getHits(), 0u);
+    ensure(! prep->intersects(point.get()));
+}
+
+// Removed and cleared geometries are no longer cached
+template<>
+template<>
+void object::test<5> ()
+{
+    PreparedRelateCache cache(1 << 20);
+    cache.add(square.get());
+    cache.add(line.get());
+
+    cache.get(square.get());
+    cache.get(line.get());
+    ensure_equals(cache.size(), 2u);
+
+    cache.remove(square.get());
+    ensure_equals(cache.size(), 1u);
+    ensure_equals(cache.getMemoryUsed(), PreparedRelateCache::estimateMemory(line.get()));
+    ensure(! cache.contains(square.get()));
+    ensure(cache.get(square.get()) == nullptr);
+
+    cache.clear();
+    ensure_equals(cache.size(), 0u);
+    ensure_equals(cache.getMemoryUsed(), 0u);
+    ensure(cache.isEmpty());
+    ensure(cache.get(line.get()) == nullptr);
+}
+
+// Geometries which have not been added are ignored
+template<>
+template<>
+void object::test<6> ()
+{
+    PreparedRelateCache cache(1 << 20);
+    cache.add(line.get());
+
+    ensure(cache.get(square.get()) == nullptr);
+    ensure(cache.get(square.get()) == nullptr);
+    ensure(cache.get(line.get()) != nullptr);
+
+    ensure_equals("hits", cache.getHits(), 0u);
+    ensure_equals("misses", cache.getMisses(), 1u);
+    ensure_equals("size", cache.size(), 1u);
+}
+
+} // namespace tut
@@ -16,8 +16,10 @@
 #include <geos/operation/valid/IsValidOp.h>
 #include <geos/operation/valid/TopologyValidationError.h>
 #include <geos/util.h>
+#include <geos/util/TaskPool.h>
 // std
 #include <cmath>
+#include <sstream>
 #include <string>
 #include <memory>
 
@@ -397,5 +399,59 @@ void object::test<28> ()
         "POLYGON ((70 250, 70 500, 80 400, 40 400, 70 250))");
 }
 
+template<>
+template<>
+void object::test<30> ()
+{
+    set_test_name("validating with a TaskPool reports the same error");
+
+    // a grid of 20x20 squares, with holes in some of them
+    std::ostringstream grid;
+    for (int i = 0; i < 400; i++) {
+        int x = 10 * (i % 20);
+        int y = 10 * (i / 20);
+        grid << (i == 0 ? "" : ", ") << "((" << x << " " << y << ", " << x + 8 << " " << y << ", "
+             << x + 8 << " " << y + 8 << ", " << x << " " << y + 8 << ", " << x << " " << y << ")";
+        if (i % 7 == 0) {
+            grid << ", (" << x + 2 << " " << y + 2 << ", " << x + 6 << " " << y + 2 << ", "
+                 << x + 4 << " " << y + 6 << ", " << x + 2 << " " << y + 2 << ")";
+        }
+        grid << ")";
+    }
+    std::string squares = grid.str();
+
+    std::vector<std::string> wkts = {
+        "MULTIPOLYGON (" + squares + ")",
+        // nested shells
+        "MULTIPOLYGON (" + squares + ", ((111 101, 112 101, 112 102, 111 101)), ((21 11, 22 11, 22 12, 21 11)))",
+        // holes outside their shells
+        "MULTIPOLYGON (" + squares + ", ((300 0, 310 0, 310 10, 300 0), (400 0, 401 0, 401 1, 400 0)), "
+            "((320 0, 330 0, 330 10, 320 0), (500 0, 501 0, 501 1, 500 0)))",
+        // too few points
+        "MULTIPOLYGON (" + squares + ", ((300 0, 310 0, 310 0, 300 0)), ((320 0, 330 0, 330 0, 320 0)))",
+        "GEOMETRYCOLLECTION (POINT (1 1), MULTIPOLYGON (" + squares + "), LINESTRING (0 0, 1 1), "
+            "POLYGON ((0 0, 10 0, 0 10, 10 10, 0 0)), POLYGON ((20 20, 30 20, 20 30, 30 30, 20 20)))",
+        "GEOMETRYCOLLECTION (POLYGON ((0 0, 1 0, 1 1, 0 0)), MULTIPOLYGON (" + squares + "))",
+    };
+
+    geos::util::TaskPool pool(3);
+
+    for (const auto& wkt : wkts) {
+        auto geom = wktreader.read(wkt);
+
+        IsValidOp seqOp(geom.get());
+        const TopologyValidationError* seqErr = seqOp.getValidationError();
+
+        IsValidOp parOp(geom.get());
+        parOp.setTaskPool(&pool);
+        const TopologyValidationError* parErr = parOp.getValidationError();
+
+        ensure_equals(parErr == nullptr, seqErr == nullptr);
+        if (seqErr != nullptr) {
+            ensure_equals(parErr->getErrorType(), seqErr->getErrorType());
+            ensure(parErr->getCoordinate().equals2D(seqErr->getCoordinate()));
+        }
+    }
+}
 
 } // namespace tut
@@ -10,6 +10,7 @@
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTWriter.h>
 #include <geos/util.h>
+#include <geos/util/TaskPool.h>
 
 #include <utility.h>
 
@@ -138,5 +139,27 @@ void object::test<4>()
                            "92115.51207431706 463462.2069374289,92127.546 463452.075))");
 }
 
+template<>
+template<>
+void object::test<5>()
+{
+    set_test_name("repairing a collection with a TaskPool");
+
+    geos::io::WKTReader reader;
+    auto g = reader.read(
+        "GEOMETRYCOLLECTION (POLYGON ((0 0, 10 0, 0 10, 10 10, 0 0)), LINESTRING (0 0, 0 0), "
+        "POINT (5 5), POLYGON ((20 0, 30 0, 30 10, 20 10, 20 0)), "
+        "MULTIPOLYGON (((40 0, 50 0, 50 10, 40 10, 40 0)), ((42 2, 48 2, 48 8, 42 8, 42 2))))");
+
+    MakeValid mv;
+    auto expected = mv.build(g.get());
+
+    geos::util::TaskPool pool(3);
+    mv.setTaskPool(&pool);
+    auto result = mv.build(g.get());
+
+    ensure(result->isValid());
+    ensure(result->equalsIdentical(expected.get()));
+}
 
 } // namespace tut
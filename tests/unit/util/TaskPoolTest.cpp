@@ -0,0 +1,170 @@
+//
+// Test Suite for geos::util::TaskPool
+
+#include <tut/tut.hpp>
+// geos
+#include <geos/util/GEOSException.h>
+#include <geos/util/Interrupt.h>
+#include <geos/util/TaskPool.h>
+// std
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using geos::util::TaskGroup;
+using geos::util::TaskPool;
+
+namespace tut {
+//
+// Test Group
+//
+
+struct test_taskpool_data {
+
+    static std::size_t
+    fib(TaskPool* pool, std::size_t n)
+    {
+        if (n < 2) {
+            return n;
+        }
+        std::size_t a = 0;
+        TaskGroup tasks(pool);
+        tasks.run([pool, n, &a]() {
+            a = fib(pool, n - 1);
+        });
+        std::size_t b = fib(pool, n - 2);
+        tasks.wait();
+        return a + b;
+    }
+
+    static int
+    interruptAfterMaxCalls(void* data)
+    {
+        return ++*static_cast<int*>(data) >= 10;
+    }
+};
+
+typedef test_group<test_taskpool_data> group;
+typedef group::object object;
+
+group test_taskpool_group("geos::util::TaskPool");
+
+//
+// Test Cases
+//
+
+template<>
+template<>
+void object::test<1>()
+{
+    set_test_name("parallelFor visits each index once");
+
+    TaskPool pool(3);
+    ensure_equals(pool.getConcurrency(), 4u);
+
+    std::vector<std::atomic<int>> visits(1000);
+    geos::util::parallelFor(&pool, visits.size(), [&visits](std::size_t i) {
+        visits[i]++;
+    }, 7);
+
+    for (const auto& v : visits) {
+        ensure_equals(v.load(), 1);
+    }
+}
+
+template<>
+template<>
+void object::test<2>()
+{
+    set_test_name("nested task groups");
+
+    TaskPool pool(4);
+    ensure_equals(fib(&pool, 20), 6765u);
+    ensure_equals(fib(nullptr, 20), 6765u);
+}
+
+template<>
+template<>
+void object::test<3>()
+{
+    set_test_name("exception in a task is rethrown by wait");
+
+    TaskPool pool(2);
+    std::atomic<int> completed(0);
+
+    TaskGroup tasks(&pool);
+    for (int i = 0; i < 100; i++) {
+        tasks.run([i, &completed]() {
+            if (i == 10) {
+                throw std::runtime_error("task failed");
+            }
+            completed++;
+        });
+    }
+
+    try {
+        tasks.wait();
+        fail("exception not rethrown");
+    }
+    catch (const std::runtime_error& e) {
+        ensure_equals(std::string(e.what()), "task failed");
+    }
+
+    ensure(completed.load() < 100);
+
+    // the group may be reused after the failure
+    tasks.run([&completed]() {
+        completed = 1000;
+    });
+    tasks.wait();
+    ensure_equals(completed.load(), 1000);
+}
+
+template<>
+template<>
+void object::test<4>()
+{
+    set_test_name("thread interrupt callback is honored by workers");
+
+    TaskPool pool(3);
+    int numCalls = 0;
+
+    geos::util::CurrentThreadInterrupt::registerCallback(interruptAfterMaxCalls, &numCalls);
+
+    bool interrupted = false;
+    try {
+        geos::util::parallelFor(&pool, 10000, [](std::size_t) {
+            GEOS_CHECK_FOR_INTERRUPTS();
+        });
+    }
+    catch (const geos::util::GEOSException&) {
+        interrupted = true;
+    }
+
+    geos::util::CurrentThreadInterrupt::registerCallback(nullptr, nullptr);
+
+    ensure(interrupted);
+    ensure(numCalls >= 10);
+}
+
+template<>
+template<>
+void object::test<5>()
+{
+    set_test_name("pool without workers runs tasks on the calling thread");
+
+    TaskPool pool(0);
+    ensure_equals(pool.getConcurrency(), 1u);
+
+    std::vector<std::size_t> order;
+    geos::util::parallelFor(&pool, 5, [&order](std::size_t i) {
+        order.push_back(i);
+    });
+
+    ensure_equals(order.size(), 5u);
+    for (std::size_t i = 0; i < order.size(); i++) {
+        ensure_equals(order[i], i);
+    }
+}
+
+} // namespace tut
@@ -1104,6 +1104,16 @@ bool GeometryOp::isAggregate()
     return _isAggregate;
 }
 
+bool GeometryOp::isGeometryResult()
+{
+    return resultType == Result::typeGeometry || resultType == Result::typeGeomList;
+}
+
+bool GeometryOp::isBoolResult()
+{
+    return resultType == Result::typeBool;
+}
+
 int GeometryOp::nParam()
 {
     return numParam;
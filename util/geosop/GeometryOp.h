@@ -268,6 +268,8 @@ public:
     std::string name();
     bool isBinary();
     bool isAggregate();
+    bool isGeometryResult();
+    bool isBoolResult();
     int nParam();
     std::string signature();
 
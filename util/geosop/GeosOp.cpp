@@ -18,10 +18,13 @@
 #include <geos/geom/Point.h>
 #include <geos/geom/GeometryFactory.h>
 #include <geos/operation/valid/MakeValid.h>
+#include <geos/io/GeoJSONStreamReader.h>
+#include <geos/io/GeoJSONStreamWriter.h>
 #include <geos/io/GeoJSONWriter.h>
 #include <geos/io/WKTReader.h>
 #include <geos/io/WKTStreamReader.h>
 #include <geos/io/WKTWriter.h>
+#include <geos/io/WKBMappedReader.h>
 #include <geos/io/WKBReader.h>
 #include <geos/io/WKBStreamReader.h>
 #include <geos/io/WKBWriter.h>
@@ -89,7 +92,7 @@ int main(int argc, char** argv) {
         ("o,offseta", "Skip reading first N geometries of A", cxxopts::value<int>( cmdArgs.offsetA ) )
         ("c,collect", "Collect input into single geometry (automatic for AGG ops)", cxxopts::value<bool>( cmdArgs.isCollect ))
         ("e,explode", "Explode results into component geometries", cxxopts::value<bool>( cmdArgs.isExplode))
-        ("f,format", "Output format (wkt, wkb, txt or geojson)", cxxopts::value<std::string>( ))
+        ("f,format", "Output format (wkt, wkb, txt, geojson or geojsonfc)", cxxopts::value<std::string>( ))
         ("p,precision", "Set number of decimal places in output coordinates", cxxopts::value<int>( cmdArgs.precision ) )
         ("q,quiet", "Disable result output", cxxopts::value<bool>( cmdArgs.isQuiet ) )
         ("r,repeat", "Repeat operation N times", cxxopts::value<int>( cmdArgs.repeatNum ) )
@@ -155,6 +158,9 @@ int main(int argc, char** argv) {
         else if (fmt == "geojson" || fmt == "json") {
             cmdArgs.format = GeosOpArgs::fmtGeoJSON;
         }
+        else if (fmt == "geojsonfc") {
+            cmdArgs.format = GeosOpArgs::fmtGeoJSONCollection;
+        }
         else {
             std::cerr << "Invalid format value: " << fmt << std::endl;
             exit(1);
@@ -293,11 +299,55 @@ readWKBFile(std::istream& in, int limit, int offset) {
     return geoms;
 }
 
+std::vector<std::unique_ptr<Geometry>>
+readWKBBinaryFile(std::string src, int limit, int offset) {
+    WKBMappedReader rdr( src );
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    std::size_t start = offset < 0 ? 0 : static_cast<std::size_t>(offset) + 1;
+    for (std::size_t i = start; i < rdr.size(); i++) {
+        if (limit >= 0 && (int) geoms.size() >= limit)
+            break;
+        geoms.push_back(rdr.read(i));
+    }
+    return geoms;
+}
+
+std::vector<std::unique_ptr<Geometry>>
+readGeoJSONFile(std::string src, int limit, int offset) {
+    std::ifstream f( src, std::ios::binary );
+    if (! f) {
+        throw geos::util::GEOSException("Cannot open file " + src);
+    }
+    GeoJSONStreamReader rdr( f );
+    std::vector<std::unique_ptr<Geometry>> geoms;
+    int count = 0;
+    while (limit < 0 || (int) geoms.size() < limit) {
+        auto geom = rdr.nextGeometry();
+        if (geom == nullptr)
+            break;
+        if (count > offset) {
+            geoms.push_back(std::move(geom));
+        }
+        count++;
+    }
+    return geoms;
+}
+
+bool isWKBBinaryFile(std::string src) {
+    // binary WKB starts with a byte order flag, hex WKB with a digit
+    std::ifstream f( src, std::ios::binary );
+    int c = f.get();
+    return c == 0 || c == 1;
+}
+
 std::vector<std::unique_ptr<Geometry>>
 readWKBFile(std::string src, int limit, int offset) {
     if (src == "-.wkb" || src == "stdin.wkb" ) {
         return readWKBFile( std::cin, limit, offset );
     }
+    if (isWKBBinaryFile(src)) {
+        return readWKBBinaryFile( src, limit, offset );
+    }
     std::ifstream f( src );
     auto geoms = readWKBFile( f, limit, offset );
     f.close();
@@ -334,6 +384,10 @@ GeosOp::readInput(std::string name, std::string src, int limit, int offset) {
         log(srcDesc + "WKB file " + src);
         geoms = readWKBFile( src, limit, offset );
     }
+    else if (endsWith(src, ".geojson") || endsWith(src, ".json")) {
+        log(srcDesc + "GeoJSON file " + src);
+        geoms = readGeoJSONFile( src, limit, offset );
+    }
     else {
         log(srcDesc + "WKT file " + src);
         geoms = readWKTFile( src, limit, offset );
@@ -403,6 +457,16 @@ void GeosOp::run(OpArguments& opArgs) {
 
     geomB = loadInput("B", args.srcB, -1, -1);
 
+    if (args.format == GeosOpArgs::fmtGeoJSONCollection && ! args.isQuiet) {
+        //-- only geometries can be written as features
+        bool isSelectOp = (args.isSelect || args.isSelectNot) && op->isBoolResult();
+        if (! op->isGeometryResult() && ! isSelectOp) {
+            std::cerr << "Format geojsonfc requires an operation returning geometries: " << op->name() << std::endl;
+            exit(1);
+        }
+        featureWriter.reset(new GeoJSONStreamWriter(std::cout));
+    }
+
     //------------------------
 
     try {
@@ -450,6 +514,11 @@ void GeosOp::run(OpArguments& opArgs) {
         exit(1);
     }
 
+    if (featureWriter) {
+        featureWriter->finish();
+        std::cout << std::endl;
+    }
+
     if (args.isShowTime || args.isVerbose) {
         std::cerr
             << "Ran " <<  formatNum( opCount ) << " " << args.opName << " ops ( "
@@ -606,6 +675,9 @@ void GeosOp::outputExplode(std::unique_ptr<Geometry>& geom) {
 
 void GeosOp::outputGeometry(const Geometry * geom) {
     if (geom == nullptr) {
+        if (featureWriter) {
+            throw geos::util::GEOSException("Format geojsonfc cannot write a null geometry");
+        }
         std::cout << "null" << std::endl;
         return;
     }
@@ -616,6 +688,10 @@ void GeosOp::outputGeometry(const Geometry * geom) {
         writer.writeHEX(*geom, std::cout);
         std::cout << std::endl;
     }
+    else if (args.format == GeosOpArgs::fmtGeoJSONCollection ) {
+        // output as a feature of a single FeatureCollection
+        featureWriter->write(geom);
+    }
     else if (args.format == GeosOpArgs::fmtGeoJSON ) {
         // output as GeoJSON
         // TODO: enable args.precision to output
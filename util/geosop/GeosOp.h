@@ -16,6 +16,7 @@
 
 #include <geos/geom/GeometryFactory.h>
 #include <geos/geom/PrecisionModel.h>
+#include <geos/io/GeoJSONStreamWriter.h>
 
 using namespace geos;
 using namespace geos::geom;
@@ -35,6 +36,7 @@ public:
         fmtText,
         fmtWKB,
         fmtGeoJSON,
+        fmtGeoJSONCollection,
     } format = fmtText;
 
     bool isShowTime = false;
@@ -79,6 +81,8 @@ private:
 
     std::vector<std::unique_ptr<Geometry>> geomB;
 
+    std::unique_ptr<geos::io::GeoJSONStreamWriter> featureWriter;
+
     std::vector<std::unique_ptr<Geometry>> readInput(std::string name, std::string src, int limit, int offset);
     std::vector<std::unique_ptr<Geometry>> loadInput(std::string name, std::string src, int limit, int offset);
     GeometryOp* getOp();